@@ -179,8 +179,14 @@ class CPUAllocator : public IAllocator {
 
   CPUAllocator() : IAllocator(OrtMemoryInfo(CPU, OrtAllocatorType::OrtDeviceAllocator)) {}
 
+  // Allocations prefer the memory of the given NUMA node. -1 leaves the placement to the OS.
+  explicit CPUAllocator(int numa_node) : CPUAllocator() { numa_node_ = numa_node; }
+
   void* Alloc(size_t size) override;
   void Free(void* p) override;
+
+ private:
+  int numa_node_ = -1;
 };
 
 using AllocatorPtr = std::shared_ptr<IAllocator>;
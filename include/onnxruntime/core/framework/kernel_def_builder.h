@@ -75,6 +75,14 @@ class KernelDef {
     return variadic_alias_offsets_;
   }
 
+  const std::vector<std::pair<int, int>>& MayView() const {
+    return may_view_map_;
+  }
+
+  const optional<std::pair<int, int>>& VariadicMayView() const {
+    return variadic_may_view_;
+  }
+
   OrtMemType InputMemoryType(size_t input_index) const {
     auto it = input_memory_type_args_.find(input_index);
     if (it == input_memory_type_args_.end())
@@ -162,6 +170,13 @@ class KernelDef {
   // output 'i + output_offset' is an alias of input 'i + input_offset' for all i >= 0
   optional<std::pair<int, int>> variadic_alias_offsets_;
 
+  // An element <i, j> means that output j may be a view of a contiguous range of input i.
+  std::vector<std::pair<int, int>> may_view_map_;
+
+  // This variable stores <input_index, output_offset> for the variadic view mapping
+  // output 'i + output_offset' may be a view of a contiguous range of input 'input_index' for all i >= 0
+  optional<std::pair<int, int>> variadic_may_view_;
+
   // Require input tensors to be allocated contiguously.
   bool allocate_inputs_contiguously_ = false;
 
@@ -292,6 +307,20 @@ class KernelDefBuilder {
   */
   KernelDefBuilder& VariadicAlias(int input_offset, int output_offset);
 
+  /**
+     View mapping from inputs to outputs. The output is planned to share the
+     buffer of the input like an alias, but the kernel decides at runtime whether
+     it can be a view of a contiguous range of the input (e.g. a Slice along the
+     outermost axis) by setting the output's byte offset. If it cannot, the
+     kernel must give the output storage of its own before writing to it.
+  */
+  KernelDefBuilder& MayView(int input_index, int output_index);
+
+  /**
+     Apply MayView(input_index, i + output_offset) for i >= 0
+  */
+  KernelDefBuilder& VariadicMayView(int input_index, int output_offset);
+
   /**
      Specify that this kernel requires input tensors to be allocated
      contiguously. This allows kernels to execute as a single large
@@ -32,6 +32,7 @@
 #pragma warning(disable : 4127)
 #pragma warning(disable : 4805)
 #endif
+#include <chrono>
 #include <memory>
 #include "unsupported/Eigen/CXX11/ThreadPool"
 
@@ -44,6 +45,7 @@
 #include "core/common/spin_pause.h"
 #include "core/platform/ort_mutex.h"
 #include "core/platform/Barrier.h"
+#include "core/platform/threadpool.h"
 
 // ORT thread pool overview
 // ------------------------
@@ -69,6 +71,9 @@
 //
 //   This spin-then-block behavior is configured via a flag provided
 //   when creating the thread pool, and by the constant spin_count.
+//   With ThreadOptions::adaptive_spinning, each worker instead spins
+//   for a duration derived from the idle gaps it recently observed
+//   between tasks (see WorkerData::SpinBudgetMicros).
 //
 // - Although all tasks are simple void()->void functions,
 //   conceptually there are three different kinds:
@@ -324,6 +329,7 @@ class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
                              unsigned n, std::ptrdiff_t block_size) = 0;
   virtual void StartProfiling()  = 0;
   virtual std::string StopProfiling() = 0;
+  virtual ThreadPoolStats GetStats() const = 0;
 };
 
 
@@ -686,6 +692,17 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
     return profiler_.Stop();
   }
 
+  ThreadPoolStats GetStats() const override {
+    ThreadPoolStats stats;
+    for (const auto& td : worker_data_) {
+      stats.spins += td.spins.load(std::memory_order_relaxed);
+      stats.steals += td.steals.load(std::memory_order_relaxed);
+      stats.parks += td.parks.load(std::memory_order_relaxed);
+      stats.wakeups += td.wakeups.load(std::memory_order_relaxed);
+    }
+    return stats;
+  }
+
   struct Tag {
     constexpr Tag() : v_(0) {
     }
@@ -729,6 +746,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
         env_(env),
         num_threads_(num_threads),
         allow_spinning_(allow_spinning),
+        adaptive_spinning_(thread_options.adaptive_spinning),
         set_denormal_as_zero_(thread_options.set_denormal_as_zero),
         worker_data_(num_threads),
         all_coprimes_(num_threads),
@@ -1233,8 +1251,19 @@ void RunInParallelSection(ThreadPoolParallelSection &ps,
   assert(ps.dispatch_q_idx == -1);
   profiler_.LogEndAndStart(ThreadPoolProfiler::DISTRIBUTION);
 
-  // Run work in the main thread
-  loop.fn(0);
+  // Run work in the main thread.  If it throws, the workers must still
+  // leave the loop before the exception unwinds the state it captures.
+  ORT_TRY {
+    loop.fn(0);
+  }
+  ORT_CATCH(...) {
+    ps.current_loop = 0;
+    while (ps.workers_in_loop) {
+      onnxruntime::concurrency::SpinPause();
+    }
+    profiler_.LogEnd(ThreadPoolProfiler::RUN);
+    ORT_RETHROW
+  }
   profiler_.LogEndAndStart(ThreadPoolProfiler::RUN);
 
   // Wait for workers to exit the loop
@@ -1265,7 +1294,15 @@ void RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, std::ptrdif
   StartParallelSectionInternal(*pt, ps);
   RunInParallelInternal(*pt, ps, n, true, fn);  // select dispatcher and do job distribution;
   profiler_.LogEndAndStart(ThreadPoolProfiler::DISTRIBUTION);
-  fn(0);  // run fn(0)
+  ORT_TRY {
+    fn(0);  // run fn(0)
+  }
+  ORT_CATCH(...) {
+    // the workers may still be running fn, so wait for them before the exception unwinds its state
+    EndParallelSectionInternal(*pt, ps);
+    profiler_.LogEnd(ThreadPoolProfiler::RUN);
+    ORT_RETHROW
+  }
   profiler_.LogEndAndStart(ThreadPoolProfiler::RUN);
   EndParallelSectionInternal(*pt, ps);  // wait for all
   profiler_.LogEnd(ThreadPoolProfiler::WAIT);
@@ -1385,6 +1422,7 @@ int CurrentThreadId() const final {
         assert(seen != ThreadStatus::Blocking);
         if (seen == ThreadStatus::Blocked) {
           status = ThreadStatus::Waking;
+          wakeups.fetch_add(1, std::memory_order_relaxed);
           cv.notify_one();
         }
       }
@@ -1417,15 +1455,46 @@ int CurrentThreadId() const final {
       status = ThreadStatus::Spinning;
     }
 
+    // Adaptive spinning.  The worker spins for about twice the average idle gap it
+    // saw between tasks, so that it catches the next loop when parallel loops come
+    // back to back, and blocks quickly when they do not (e.g. a multi-tenant host
+    // where other processes need the CPU).  Gaps longer than the maximum spin are
+    // not worth spinning for at all.
+
+    static constexpr double kMinSpinMicros = 5.0;
+    static constexpr double kMaxSpinMicros = 2000.0;
+
+    double SpinBudgetMicros() const {
+      if (idle_gap_micros >= kMaxSpinMicros) {
+        return kMinSpinMicros;
+      }
+      return std::min(kMaxSpinMicros, std::max(kMinSpinMicros, 2 * idle_gap_micros));
+    }
+
+    void RecordIdleGap(double gap_micros) {
+      idle_gap_micros += 0.25 * (gap_micros - idle_gap_micros);
+    }
+
+    // Wait counters, see ThreadPoolStats.  Written by the worker itself, except
+    // for wakeups which is updated by the waking thread.
+    std::atomic<uint64_t> spins{0};
+    std::atomic<uint64_t> steals{0};
+    std::atomic<uint64_t> parks{0};
+    std::atomic<uint64_t> wakeups{0};
+
   private:
     std::atomic<ThreadStatus> status{ThreadStatus::Spinning};
     OrtMutex mutex;
     OrtCondVar cv;
+
+    // Moving average of the idle gaps between tasks, only used by the worker itself
+    double idle_gap_micros = 0.0;
   };
 
   Environment& env_;
   const unsigned num_threads_;
   const bool allow_spinning_;
+  const bool adaptive_spinning_;
   const bool set_denormal_as_zero_;
   Eigen::MaxSizeVector<WorkerData> worker_data_;
   Eigen::MaxSizeVector<Eigen::MaxSizeVector<unsigned>> all_coprimes_;
@@ -1464,14 +1533,33 @@ int CurrentThreadId() const final {
     while (!should_exit) {
       Task t = q.PopFront();
       if (!t) {
+        const bool adaptive = adaptive_spinning_ && spin_count > 0;
+        std::chrono::steady_clock::time_point idle_start;
+        std::chrono::steady_clock::time_point spin_deadline;
+        if (adaptive) {
+          idle_start = std::chrono::steady_clock::now();
+          spin_deadline = idle_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                           std::chrono::duration<double, std::micro>(td.SpinBudgetMicros()));
+        }
+
         // Spin waiting for work.
         for (int i = 0; i < spin_count && !t && !done_; i++) {
           if (((i+1)%steal_count == 0)) {
             t = Steal(StealAttemptKind::TRY_ONE);
+            if (t) {
+              td.steals.fetch_add(1, std::memory_order_relaxed);
+            }
           } else {
             t = q.PopFront();
           }
           onnxruntime::concurrency::SpinPause();
+          // Reading the clock every iteration would slow down the spin loop
+          if (adaptive && (i & 63) == 63 && std::chrono::steady_clock::now() >= spin_deadline) {
+            break;
+          }
+        }
+        if (t) {
+          td.spins.fetch_add(1, std::memory_order_relaxed);
         }
 
         // Attempt to block
@@ -1526,6 +1614,11 @@ int CurrentThreadId() const final {
                               }
                             }
                           }
+                          // Count the park when we commit to blocking, so that workers blocked
+                          // right now show up in the statistics.
+                          if (should_block) {
+                            td.parks.fetch_add(1, std::memory_order_relaxed);
+                          }
                           return should_block;
                         },
                         // Post-block update (executed only if we blocked)
@@ -1536,7 +1629,16 @@ int CurrentThreadId() const final {
           // blocking, or are exiting, then either work was pushed to
           // us, or it was pushed to an overloaded queue
           if (!t) t = q.PopFront();
-          if (!t) t = Steal(StealAttemptKind::TRY_ALL);
+          if (!t) {
+            t = Steal(StealAttemptKind::TRY_ALL);
+            if (t) {
+              td.steals.fetch_add(1, std::memory_order_relaxed);
+            }
+          }
+        }
+
+        if (adaptive && t) {
+          td.RecordIdleGap(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - idle_start).count());
         }
       }
       if (t) {
@@ -16,6 +16,8 @@ limitations under the License.
 /* Modifications Copyright (c) Microsoft. */
 
 #pragma once
+#include <array>
+#include <atomic>
 #include <string>
 #include <vector>
 #include <functional>
@@ -95,6 +97,16 @@ limitations under the License.
 //   rates in per-core caches across the series of short loops used in
 //   operators like GRU.
 //
+// - Loops and tasks carry the WorkPriority of the thread that submits
+//   them (see ThreadPool::PriorityScope).  While a loop is running,
+//   the pool's threads that help lower-priority loops stop claiming
+//   batches of iterations from them, leaving the remaining iterations
+//   to the threads that started those loops.  Hence a high-priority
+//   loop preempts lower-priority work at the granularity of a batch,
+//   without the work queues needing to be reordered.  Once no
+//   higher-priority loop runs, the thread that started a loop schedules
+//   the helpers that left it back into the loop.
+//
 // There are some known areas for exploration here:
 //
 // - The cost-based heuristics were developed prior to recent changes
@@ -137,6 +149,23 @@ class ExtendedThreadPoolInterface;
 class LoopCounter;
 class ThreadPoolParallelSection;
 
+// Counters of how the worker threads of a pool waited for work, summed over the workers.
+struct ThreadPoolStats {
+  uint64_t spins = 0;    // Idle periods ended by work found while spinning
+  uint64_t steals = 0;   // Tasks taken from the queue of another worker
+  uint64_t parks = 0;    // Idle periods in which the worker blocked in the OS
+  uint64_t wakeups = 0;  // Notifications sent to wake blocked workers
+};
+
+// Scheduling priority of the parallel loops and tasks that a thread submits to a pool.
+enum class WorkPriority : int {
+  kLow = 0,
+  kNormal = 1,
+  kHigh = 2,
+};
+
+constexpr int kNumWorkPriorities = 3;
+
 class ThreadPool {
  public:
 #ifdef _WIN32
@@ -221,6 +250,27 @@ class ThreadPool {
                   "Per-thread state should be trivially destructible");
   };
 
+  // Sets the priority of the loops and tasks that the current thread submits to any
+  // pool for the lifetime of the scope, restoring the previous priority on exit.
+  // Tasks passed to Schedule run with the priority of the thread that scheduled them,
+  // so work that an inter-op task hands on keeps the priority of the request.
+  //
+  // Worker threads helping a loop stop claiming iterations from it while a loop of
+  // higher priority is running in the same pool; the thread that started the loop
+  // always completes it.  Workers that joined a ParallelSection stay in it until it ends.
+  class PriorityScope {
+   public:
+    explicit PriorityScope(WorkPriority priority);
+    ~PriorityScope();
+
+   private:
+    WorkPriority previous_priority_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PriorityScope);
+  };
+
+  // Returns the priority of the work submitted by the current thread, kNormal outside a PriorityScope.
+  static WorkPriority GetCurrentPriority();
+
   // Schedules fn() for execution in the pool of threads.  The function may run
   // synchronously if it cannot be enqueued.  This will occur if the thread pool's
   // degree-of-parallelism is 1, but it may also occur for implementation-dependent
@@ -366,6 +416,9 @@ class ThreadPool {
   static void StartProfiling(concurrency::ThreadPool* tp);
   static std::string StopProfiling(concurrency::ThreadPool* tp);
 
+  // Returns the wait counters of the worker threads since the pool was created, all zero if tp is nullptr.
+  static ThreadPoolStats GetStats(const concurrency::ThreadPool* tp);
+
  private:
   friend class LoopCounter;
 
@@ -415,8 +468,19 @@ class ThreadPool {
 
   std::string StopProfiling();
 
+  ThreadPoolStats GetStats() const;
+
+  // Returns whether a parallel loop with a priority above the given one is running in the pool.
+  bool HigherPriorityLoopActive(WorkPriority priority) const;
+
+  // Priority of the work submitted by the current thread.
+  static thread_local WorkPriority current_priority;
+
   ThreadOptions thread_options_;
 
+  // Number of parallel loops of each priority currently running in the pool, indexed by WorkPriority.
+  std::array<std::atomic<int>, kNumWorkPriorities> active_loops_{};
+
   // If a thread pool is created with degree_of_parallelism != 1 then an underlying
   // EigenThreadPool is used to create OS threads and handle work distribution to them.
   // If degree_of_parallelism == 1 then underlying_threadpool_ is left as nullptr
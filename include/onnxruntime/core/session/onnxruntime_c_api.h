@@ -342,6 +342,28 @@ typedef enum OrtCudnnConvAlgoSearch {
   OrtCudnnConvAlgoSearchDefault,     // default algorithm using CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_PRECOMP_GEMM
 } OrtCudnnConvAlgoSearch;
 
+/** \brief Wait counters of a thread pool
+*
+* Returned by OrtApi::SessionGetThreadPoolStats.
+*/
+typedef struct OrtThreadPoolStats {
+  uint64_t spins;    ///< Idle periods of worker threads that ended because work was found while spinning
+  uint64_t steals;   ///< Tasks worker threads took from the queues of other threads
+  uint64_t parks;    ///< Times worker threads blocked because no work arrived while spinning
+  uint64_t wakeups;  ///< Notifications sent to wake blocked worker threads
+} OrtThreadPoolStats;
+
+/** \brief Callback invoked when a run queued with OrtApi::RunAsync completes
+*
+* \param[in] user_data The user_data passed to OrtApi::RunAsync
+* \param[in] outputs The outputs array passed to OrtApi::RunAsync. On success the entries that were nullptr point
+*     to newly allocated ::OrtValue%s that must be freed with OrtApi::ReleaseValue.
+* \param[in] num_outputs Number of elements in the outputs array
+* \param[in] status nullptr on success, otherwise the error of the run. Must be freed with OrtApi::ReleaseStatus.
+*/
+typedef void(ORT_API_CALL* RunAsyncCallbackFn)(_In_opt_ void* user_data, _Inout_updates_all_(num_outputs) OrtValue** outputs,
+                                               size_t num_outputs, _In_opt_ OrtStatusPtr status);
+
 /** \brief CUDA Provider Options
 *
 * \see OrtApi::SessionOptionsAppendExecutionProvider_CUDA
@@ -3329,6 +3351,59 @@ struct OrtApi {
   ORT_API2_STATUS(AddExternalInitializers, _In_ OrtSessionOptions* options,
                   _In_reads_(input_len) const char* const* initializer_names,
                   _In_reads_(input_len) const OrtValue* const* initializers, size_t initializers_num);
+
+  /** \brief Get the wait counters of a thread pool used by the session
+  *
+  * The counters accumulate from the creation of the thread pool. When the session uses the global thread pools
+  * of the ::OrtEnv the counters include the work of every session sharing them.
+  *
+  * \param[in] session
+  * \param[in] inter_op 0 for the intra-op thread pool, any other value for the inter-op thread pool
+  * \param[out] out Counters of the thread pool. All zero if the session has no such thread pool.
+  *
+  * \snippet{doc} snippets.dox OrtStatus Return Value
+  *
+  * \since Version 1.12.
+  */
+  ORT_API2_STATUS(SessionGetThreadPoolStats, _In_ const OrtSession* session, int inter_op,
+                  _Out_ OrtThreadPoolStats* out);
+
+  /** \brief Run the model in an ::OrtSession without waiting for it to complete
+  *
+  * Queues the run on the intra-op thread pool of the session and returns. The run_async_callback is invoked on the
+  * thread that executed the run once it completes, so a few threads can serve many concurrent requests.
+  * If the session has no intra-op thread pool (an intra-op thread count of 1) the run and the callback happen
+  * before this function returns. The same happens when the run is handed to a thread pool worker whose queue is full,
+  * i.e. already holds 1024 tasks that have not started. Callers that may queue that many runs and need this
+  * function not to block must bound the number of outstanding runs themselves.
+  *
+  * The inputs are referenced by the queued run and may be released once this function returns. The run_options
+  * (if not nullptr) and the outputs array must stay valid, and the session must not be released, until the
+  * callback was invoked.
+  *
+  * \param[in] session
+  * \param[in] run_options If nullptr, will use a default ::OrtRunOptions
+  * \param[in] input_names Array of null terminated UTF8 encoded strings of the input names
+  * \param[in] input Array of ::OrtValue%s of the input values
+  * \param[in] input_len Number of elements in the input_names and inputs arrays
+  * \param[in] output_names Array of null terminated UTF8 encoded strings of the output names
+  * \param[in] output_names_len Number of elements in the output_names and outputs array
+  * \param[out] output Array of ::OrtValue%s that the outputs are stored in, as for OrtApi::Run. It is passed
+  *     to run_async_callback.
+  * \param[in] run_async_callback Callback invoked with the outputs and the status of the run
+  * \param[in] user_data Passed through to run_async_callback
+  *
+  * \snippet{doc} snippets.dox OrtStatus Return Value
+  *     The returned status only reports errors found before the run was queued.
+  *
+  * \since Version 1.12.
+  */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* session, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** output,
+                  _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
 };
 
 /*
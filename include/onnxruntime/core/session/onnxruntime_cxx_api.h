@@ -427,6 +427,23 @@ struct Session : Base<OrtSession> {
 
   void Run(const RunOptions& run_options, const struct IoBinding&);  ///< Wraps OrtApi::RunWithBinding
 
+  /** \brief Run the model without waiting for it to complete, wraps OrtApi::RunAsync
+  *
+  * \param[in] run_options Must stay valid until callback is invoked
+  * \param[in] input_names Array of null terminated strings of length input_count that is the list of input names
+  * \param[in] input_values Array of Value objects of length input_count
+  * \param[in] input_count Number of elements in the input_names and inputs arrays
+  * \param[in] output_names Array of null terminated strings of length output_count that is the list of output names
+  * \param[out] output_values Array of Value objects of length output_count, filled in before callback is invoked.
+  *     Must stay valid until then.
+  * \param[in] output_count Number of elements in the output_names and outputs array
+  * \param[in] callback Invoked with user_data, the outputs and the status of the run (owned by the callback)
+  * \param[in] user_data Passed through to callback
+  */
+  void RunAsync(const RunOptions& run_options, const char* const* input_names, const Value* input_values, size_t input_count,
+                const char* const* output_names, Value* output_values, size_t output_count, RunAsyncCallbackFn callback,
+                void* user_data);
+
   size_t GetInputCount() const;                   ///< Returns the number of model inputs
   size_t GetOutputCount() const;                  ///< Returns the number of model outputs
   size_t GetOverridableInitializerCount() const;  ///< Returns the number of inputs that have defaults that can be overridden
@@ -436,6 +453,7 @@ struct Session : Base<OrtSession> {
   char* GetOverridableInitializerName(size_t index, OrtAllocator* allocator) const;  ///< Wraps OrtApi::SessionGetOverridableInitializerName
   char* EndProfiling(OrtAllocator* allocator) const;                                 ///< Wraps OrtApi::SessionEndProfiling
   uint64_t GetProfilingStartTimeNs() const;                                          ///< Wraps OrtApi::SessionGetProfilingStartTimeNs
+  OrtThreadPoolStats GetThreadPoolStats(bool inter_op = false) const;                ///< Wraps OrtApi::SessionGetThreadPoolStats
   ModelMetadata GetModelMetadata() const;                                            ///< Wraps OrtApi::SessionGetModelMetadata
 
   TypeInfo GetInputTypeInfo(size_t index) const;                   ///< Wraps OrtApi::SessionGetInputTypeInfo
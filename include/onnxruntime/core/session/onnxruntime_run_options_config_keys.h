@@ -25,3 +25,28 @@
 // Example usage: "cpu:0;gpu:0" (or) "gpu:0"
 // By default, the value for this key is empty (i.e.) no memory arenas are shrunk
 static const char* const kOrtRunOptionsConfigEnableMemoryArenaShrinkage = "memory.enable_memory_arena_shrinkage";
+
+// Identifies the stream a Run() belongs to when the session is configured with stateful input/output pairs using
+// kOrtSessionOptionsConfigStatefulIOPairs. State is kept separately for each stream id, so concurrent streams can
+// use the same session. Runs for the same stream must not be concurrent.
+// By default, the empty stream id is used.
+static const char* const kOrtRunOptionsConfigStatefulStreamId = "stateful.stream_id";
+
+// If set to "1", any state kept for the stream is discarded before the Run(), so the stateful inputs are taken from
+// the provided feeds (or the graph defaults). The default is "0".
+static const char* const kOrtRunOptionsConfigStatefulReset = "stateful.reset";
+
+// If set to "1", the state for the stream is not kept after the Run(). Use this for the last Run() of a stream to
+// release its state. The default is "0".
+static const char* const kOrtRunOptionsConfigStatefulEndStream = "stateful.end_stream";
+
+// Scheduling priority of the Run() in the intra-op and inter-op thread pools: "low", "normal" or "high".
+// While a higher-priority Run() has a parallel loop in a thread pool, the pool's threads stop helping the loops of
+// lower-priority runs after the iterations they already claimed, which matters most when sessions share the global
+// thread pools. The default is "normal".
+static const char* const kOrtRunOptionsConfigPriority = "run.priority";
+
+// Time budget of the Run() in milliseconds, measured from the start of the Run(). Once it is exceeded, the Run()
+// fails before executing the next node of the main graph, in the same way as when RunOptions::terminate is set.
+// By default, or if set to "0", there is no deadline.
+static const char* const kOrtRunOptionsConfigDeadlineMs = "run.deadline_ms";
@@ -71,6 +71,15 @@ static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "
 static const char* const kOrtSessionOptionsConfigAllowInterOpSpinning = "session.inter_op.allow_spinning";
 static const char* const kOrtSessionOptionsConfigAllowIntraOpSpinning = "session.intra_op.allow_spinning";
 
+// Configure whether the inter_op/intra_op threads adapt how long they spin before blocking, when spinning is allowed.
+// "0": default, threads spin a fixed number of times before blocking
+// "1": each thread spins for about twice the idle gaps it recently observed between tasks, and blocks almost at once
+//      when those gaps are long. This keeps the wake-up latency of back to back parallel loops low without burning
+//      idle CPU between requests, which suits multi-tenant deployments.
+// The resulting spin, steal, park and wake-up counts are available through OrtApi::SessionGetThreadPoolStats.
+static const char* const kOrtSessionOptionsConfigInterOpAdaptiveSpinning = "session.inter_op.adaptive_spinning";
+static const char* const kOrtSessionOptionsConfigIntraOpAdaptiveSpinning = "session.intra_op.adaptive_spinning";
+
 // Key for using model bytes directly for ORT format
 // If a session is created using an input byte array contains the ORT format model data,
 // By default we will copy the model bytes at the time of session creation to ensure the model bytes
@@ -113,3 +122,43 @@ static const char* const kOrtSessionOptionsConfigNnapiEpPartitioningStopOps = "e
 // The feature will not function by default, specify any positive integer, e.g. "4", to enable it.
 // Available since version 1.11.
 static const char* const kOrtSessionOptionsConfigDynamicBlockBase = "session.dynamic_block_base";
+
+// Enables stateful runs where graph outputs are fed back as graph inputs on the next Run() of the same stream,
+// e.g. the hidden and cell state of an LSTM/GRU/Scan model used for streaming inference.
+// The value is a ";"-delimited list of "output_name:input_name" pairs. For example "Y_h:initial_h;Y_c:initial_c".
+// The output of each pair is kept by the session after a Run() and used as the input of the pair in the next Run()
+// with the same stream id, unless the input is explicitly provided. The OrtValue is handed over without a copy.
+// The input must be provided explicitly (or be optional) in the first Run() of a stream. The outputs of the pairs
+// should not be bound to pre-allocated buffers, as the buffer is fed back as an input in the next Run().
+// See kOrtRunOptionsConfigStatefulStreamId and related run options config keys for managing streams.
+// If not specified (default), no state is kept between Run() calls.
+static const char* const kOrtSessionOptionsConfigStatefulIOPairs = "session.stateful_io_pairs";
+
+// Pins the session to a NUMA node, e.g. "0" or "1" on a dual socket host.
+// The per session intra-op and inter-op threads run on the processors of the node. Unless its size is set,
+// the intra-op thread pool has one thread per processor of the node.
+// The memory arena of the default CPU execution provider prefers pages of the node, so that tensors and weights
+// are local to the threads using them regardless of which thread first touches them.
+// Running one session per node, each pinned to its node, keeps all the work of a session on one socket.
+// Ignored where the NUMA topology is not known (currently supported on Linux only).
+// If not specified (default), the session is not pinned.
+static const char* const kOrtSessionOptionsConfigNumaNode = "session.numa_node";
+
+// If set to "1", runs of the session that repeat the input shapes of an earlier run replay a flat trace of the
+// kernel calls, with the addresses of intermediate tensors in the memory pattern buffers worked out in advance,
+// instead of walking the execution plan. This trims the per node overhead that dominates the latency of small models.
+// The trace is recorded once the memory pattern for the input shapes is cached, i.e. after a warmup run with
+// those shapes. Requires memory pattern optimization, and is used only if every node runs on the CPU execution
+// provider. Runs with profiling enabled or with only_execute_path_to_fetches set don't replay.
+// The default is "0".
+static const char* const kOrtSessionOptionsConfigEnableCpuGraphReplay = "session.enable_cpu_graph_replay";
+
+// Maximum number of execution frame states the session keeps between runs, from "0" to "16". The default is "16".
+// When a run ends, the session keeps the value vector and the memory pattern buffers of the run for the next run
+// with the same input shapes, so that it doesn't need to allocate them again. One state is kept per concurrent run,
+// up to this number, and each graph and subgraph keeps its own. A kept state holds the memory pattern buffers of the
+// input shapes it last ran with, i.e. the peak activation memory of such a run. Lower the limit, or set it to "0" to
+// keep none, if the memory held between runs matters more than the allocation cost of a run.
+// The kept states are also freed when the memory arenas are shrunk after a run (kOrtRunOptionsConfigEnableMemoryArenaShrinkage).
+static const char* const kOrtSessionOptionsConfigMaxKeptExecutionFrameStates =
+    "session.max_kept_execution_frame_states";
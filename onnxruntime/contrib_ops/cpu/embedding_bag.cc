@@ -0,0 +1,222 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "embedding_bag.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/cpu/tensor/gather.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_KERNEL_EX(
+    EmbeddingBag,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", BuildKernelDefConstraints<float, MLFloat16, int8_t, uint8_t>())
+        .TypeConstraint("Tind", BuildKernelDefConstraints<int32_t, int64_t>()),
+    EmbeddingBag);
+
+namespace {
+
+// Rows of a float16 table are converted in chunks of this many elements
+constexpr int64_t kHalfRowChunk = 256;
+
+// Adds weight * dequantize(row) to output. scale and zero_point are only used by 8-bit tables.
+template <typename T>
+void AccumulateRow(const T* row, float weight, float scale, float zero_point, float* output, int64_t size) {
+  const float k = weight * scale;
+  EigenVectorArrayMap<float>(output, size) += ConstEigenVectorArrayMap<T>(row, size).template cast<float>() * k -
+                                              k * zero_point;
+}
+
+template <>
+void AccumulateRow<float>(const float* row, float weight, float, float, float* output, int64_t size) {
+  EigenVectorArrayMap<float>(output, size) += ConstEigenVectorArrayMap<float>(row, size) * weight;
+}
+
+template <>
+void AccumulateRow<MLFloat16>(const MLFloat16* row, float weight, float, float, float* output, int64_t size) {
+  float buffer[kHalfRowChunk];
+  for (int64_t start = 0; start < size; start += kHalfRowChunk) {
+    const int64_t count = std::min(kHalfRowChunk, size - start);
+    MlasConvertHalfToFloatBuffer(reinterpret_cast<const unsigned short*>(row + start), buffer,
+                                 static_cast<size_t>(count));
+    EigenVectorArrayMap<float>(output + start, count) += ConstEigenVectorArrayMap<float>(buffer, count) * weight;
+  }
+}
+
+template <typename T>
+float ZeroPointToFloat(T zero_point) {
+  return static_cast<float>(zero_point);
+}
+
+}  // namespace
+
+EmbeddingBag::EmbeddingBag(const OpKernelInfo& info) : OpKernel(info) {
+  const std::string mode = info.GetAttrOrDefault<std::string>("mode", "sum");
+  ORT_ENFORCE(mode == "sum" || mode == "mean", "Unsupported EmbeddingBag mode: ", mode);
+  mean_mode_ = mode == "mean";
+}
+
+Status EmbeddingBag::Compute(OpKernelContext* context) const {
+  const Tensor* weight = context->Input<Tensor>(0);
+  const bool int64_indices = context->Input<Tensor>(1)->IsDataType<int64_t>();
+
+  if (weight->IsDataType<float>()) {
+    return int64_indices ? ComputeImpl<float, int64_t>(context) : ComputeImpl<float, int32_t>(context);
+  }
+  if (weight->IsDataType<MLFloat16>()) {
+    return int64_indices ? ComputeImpl<MLFloat16, int64_t>(context) : ComputeImpl<MLFloat16, int32_t>(context);
+  }
+  if (weight->IsDataType<int8_t>()) {
+    return int64_indices ? ComputeImpl<int8_t, int64_t>(context) : ComputeImpl<int8_t, int32_t>(context);
+  }
+  return int64_indices ? ComputeImpl<uint8_t, int64_t>(context) : ComputeImpl<uint8_t, int32_t>(context);
+}
+
+template <typename T, typename Tind>
+Status EmbeddingBag::ComputeImpl(OpKernelContext* context) const {
+  constexpr bool is_quantized = std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value;
+
+  const Tensor* weight = context->Input<Tensor>(0);
+  const Tensor* indices = context->Input<Tensor>(1);
+  const Tensor* offsets = context->Input<Tensor>(2);
+  const Tensor* per_sample_weights = context->Input<Tensor>(3);
+  const Tensor* scale = context->Input<Tensor>(4);
+  const Tensor* zero_point = context->Input<Tensor>(5);
+
+  const auto& weight_shape = weight->Shape();
+  ORT_RETURN_IF_NOT(weight_shape.NumDimensions() == 2, "weight must be 2-D, got ", weight_shape);
+  const int64_t num_embeddings = weight_shape[0];
+  const int64_t embedding_size = weight_shape[1];
+
+  const auto& indices_shape = indices->Shape();
+  const int64_t num_indices = indices_shape.Size();
+  int64_t num_bags = 0;
+  if (offsets != nullptr) {
+    ORT_RETURN_IF_NOT(indices_shape.NumDimensions() == 1, "indices must be 1-D when offsets is given, got ",
+                      indices_shape);
+    ORT_RETURN_IF_NOT(offsets->Shape().NumDimensions() == 1, "offsets must be 1-D, got ", offsets->Shape());
+    num_bags = offsets->Shape()[0];
+  } else {
+    ORT_RETURN_IF_NOT(indices_shape.NumDimensions() == 2, "indices must be 2-D when offsets is not given, got ",
+                      indices_shape);
+    num_bags = indices_shape[0];
+  }
+
+  if (per_sample_weights != nullptr) {
+    ORT_RETURN_IF_NOT(!mean_mode_, "per_sample_weights is only supported in sum mode");
+    ORT_RETURN_IF_NOT(per_sample_weights->Shape() == indices_shape,
+                      "per_sample_weights must have the shape of indices, got ", per_sample_weights->Shape());
+  }
+
+  if (is_quantized) {
+    ORT_RETURN_IF_NOT(scale != nullptr, "scale is required for an 8-bit embedding table");
+    ORT_RETURN_IF_NOT(scale->Shape().Size() == num_embeddings, "scale must hold one value per row");
+    ORT_RETURN_IF_NOT(zero_point == nullptr || zero_point->Shape().Size() == num_embeddings,
+                      "zero_point must hold one value per row");
+  } else {
+    ORT_RETURN_IF_NOT(scale == nullptr && zero_point == nullptr,
+                      "scale and zero_point are only supported for 8-bit embedding tables");
+  }
+
+  Tensor* output = context->Output(0, {num_bags, embedding_size});
+  if (num_bags == 0 || embedding_size == 0) {
+    return Status::OK();
+  }
+
+  const T* weight_data = weight->Data<T>();
+  const Tind* indices_data = indices->Data<Tind>();
+  const Tind* offsets_data = offsets != nullptr ? offsets->Data<Tind>() : nullptr;
+  const float* per_sample_weights_data = per_sample_weights != nullptr ? per_sample_weights->Data<float>() : nullptr;
+  const float* scale_data = scale != nullptr ? scale->Data<float>() : nullptr;
+  const T* zero_point_data = zero_point != nullptr ? zero_point->Data<T>() : nullptr;
+  float* output_data = output->MutableData<float>();
+
+  // Check the indices and the offsets first so that the lookups need no checks.
+  for (int64_t i = 0; i < num_indices; ++i) {
+    const Tind idx = indices_data[i];
+    if (idx < -num_embeddings || idx >= num_embeddings) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "indices element out of data bounds, idx=", idx,
+                             " must be within the inclusive range [", -num_embeddings, ",", num_embeddings - 1, "]");
+    }
+  }
+  if (offsets_data != nullptr) {
+    for (int64_t b = 0; b < num_bags; ++b) {
+      const int64_t end = b + 1 < num_bags ? static_cast<int64_t>(offsets_data[b + 1]) : num_indices;
+      if (offsets_data[b] < 0 || offsets_data[b] > end || end > num_indices) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "offsets must be non-decreasing and within [0, ", num_indices, "], offsets[", b,
+                               "]=", offsets_data[b]);
+      }
+    }
+  }
+
+  const int64_t bag_size = offsets_data != nullptr ? 0 : indices_shape[1];
+  const size_t row_bytes = static_cast<size_t>(embedding_size) * sizeof(T);
+
+  auto row_index = [=](int64_t position) {
+    const int64_t idx = static_cast<int64_t>(indices_data[position]);
+    return idx < 0 ? idx + num_embeddings : idx;
+  };
+
+  const double rows_per_bag = static_cast<double>(num_indices) / static_cast<double>(num_bags);
+  const TensorOpCost cost{rows_per_bag * static_cast<double>(row_bytes),
+                          static_cast<double>(embedding_size * sizeof(float)),
+                          rows_per_bag * static_cast<double>(embedding_size) * 2.0};
+
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), num_bags, cost,
+      [&](std::ptrdiff_t first_bag, std::ptrdiff_t last_bag) {
+        for (std::ptrdiff_t b = first_bag; b < last_bag; ++b) {
+          int64_t begin;
+          int64_t end;
+          if (offsets_data != nullptr) {
+            begin = static_cast<int64_t>(offsets_data[b]);
+            end = b + 1 < num_bags ? static_cast<int64_t>(offsets_data[b + 1]) : num_indices;
+          } else {
+            begin = b * bag_size;
+            end = begin + bag_size;
+          }
+
+          float* bag_output = output_data + b * embedding_size;
+          std::fill_n(bag_output, embedding_size, 0.0f);
+
+          for (int64_t p = begin, prefetch_end = std::min(end, begin + kGatherPrefetchDistance); p < prefetch_end; ++p) {
+            PrefetchGatherRow(weight_data + row_index(p) * embedding_size, row_bytes);
+          }
+
+          for (int64_t p = begin; p < end; ++p) {
+            if (p + kGatherPrefetchDistance < end) {
+              PrefetchGatherRow(weight_data + row_index(p + kGatherPrefetchDistance) * embedding_size, row_bytes);
+            }
+
+            const int64_t row = row_index(p);
+            const float sample_weight = per_sample_weights_data != nullptr ? per_sample_weights_data[p] : 1.0f;
+            const float row_scale = scale_data != nullptr ? scale_data[row] : 1.0f;
+            const float row_zero_point = zero_point_data != nullptr ? ZeroPointToFloat(zero_point_data[row]) : 0.0f;
+            AccumulateRow<T>(weight_data + row * embedding_size, sample_weight, row_scale, row_zero_point,
+                             bag_output, embedding_size);
+          }
+
+          if (mean_mode_ && end > begin) {
+            EigenVectorArrayMap<float>(bag_output, embedding_size) /= static_cast<float>(end - begin);
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "image_preprocess.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_KERNEL_EX(
+    ImagePreprocess,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", BuildKernelDefConstraints<uint8_t, float>()),
+    ImagePreprocess);
+
+namespace {
+
+// Source pixels and weights of one output coordinate. Matches the half_pixel bilinear Resize.
+struct InterpolationTap {
+  int64_t index1;
+  int64_t index2;
+  float weight1;
+  float weight2;
+};
+
+std::vector<InterpolationTap> ComputeTaps(int64_t input_size, int64_t output_size) {
+  std::vector<InterpolationTap> taps(static_cast<size_t>(output_size));
+  const float scale = static_cast<float>(output_size) / static_cast<float>(input_size);
+  for (int64_t i = 0; i < output_size; ++i) {
+    float in = (static_cast<float>(i) + 0.5f) / scale - 0.5f;
+    in = std::max(0.0f, std::min(in, static_cast<float>(input_size - 1)));
+
+    auto& tap = taps[static_cast<size_t>(i)];
+    tap.index1 = std::min(static_cast<int64_t>(in), input_size - 1);
+    tap.index2 = std::min(tap.index1 + 1, input_size - 1);
+    // The weight of each source pixel is the distance to the other one
+    tap.weight1 = std::abs(static_cast<float>(tap.index2) - in);
+    tap.weight2 = std::abs(in - static_cast<float>(tap.index1));
+    if (tap.index1 == tap.index2) {
+      tap.weight1 = 0.5f;
+      tap.weight2 = 0.5f;
+    }
+  }
+  return taps;
+}
+
+}  // namespace
+
+ImagePreprocess::ImagePreprocess(const OpKernelInfo& info) : OpKernel(info) {
+  scale_ = info.GetAttrsOrDefault<float>("scale");
+  bias_ = info.GetAttrsOrDefault<float>("bias");
+  output_height_ = info.GetAttrOrDefault<int64_t>("output_height", 0);
+  output_width_ = info.GetAttrOrDefault<int64_t>("output_width", 0);
+  ORT_ENFORCE(output_height_ >= 0 && output_width_ >= 0, "output_height and output_width must not be negative.");
+}
+
+Status ImagePreprocess::Compute(OpKernelContext* context) const {
+  if (context->Input<Tensor>(0)->IsDataType<uint8_t>()) {
+    return ComputeImpl<uint8_t>(context);
+  }
+  return ComputeImpl<float>(context);
+}
+
+template <typename T>
+Status ImagePreprocess::ComputeImpl(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  const TensorShape& shape = X->Shape();
+  ORT_RETURN_IF_NOT(shape.NumDimensions() == 4, "ImagePreprocess requires a 4-D input in NHWC layout.");
+
+  const int64_t N = shape[0];
+  const int64_t H = shape[1];
+  const int64_t W = shape[2];
+  const int64_t C = shape[3];
+  const int64_t OH = output_height_ > 0 ? output_height_ : H;
+  const int64_t OW = output_width_ > 0 ? output_width_ : W;
+
+  ORT_RETURN_IF_NOT(scale_.empty() || scale_.size() == 1 || static_cast<int64_t>(scale_.size()) == C,
+                    "The scale attribute must have 1 or ", C, " values. Got ", scale_.size());
+  ORT_RETURN_IF_NOT(bias_.empty() || bias_.size() == 1 || static_cast<int64_t>(bias_.size()) == C,
+                    "The bias attribute must have 1 or ", C, " values. Got ", bias_.size());
+
+  Tensor* Y = context->Output(0, {N, C, OH, OW});
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+  ORT_RETURN_IF_NOT(H > 0 && W > 0, "ImagePreprocess cannot resize an empty image.");
+
+  std::vector<float> scale(static_cast<size_t>(C), 1.0f);
+  std::vector<float> bias(static_cast<size_t>(C), 0.0f);
+  for (size_t c = 0; c < scale.size(); ++c) {
+    if (!scale_.empty()) {
+      scale[c] = scale_[scale_.size() == 1 ? 0 : c];
+    }
+    if (!bias_.empty()) {
+      bias[c] = bias_[bias_.size() == 1 ? 0 : c];
+    }
+  }
+
+  const bool resize = OH != H || OW != W;
+  const std::vector<InterpolationTap> row_taps = resize ? ComputeTaps(H, OH) : std::vector<InterpolationTap>{};
+  const std::vector<InterpolationTap> column_taps = resize ? ComputeTaps(W, OW) : std::vector<InterpolationTap>{};
+
+  const T* X_data = X->Data<T>();
+  float* Y_data = Y->MutableData<float>();
+  const int64_t output_plane = OH * OW;
+
+  // Each task produces one output row of every channel, reading the input once
+  const double row_elements = static_cast<double>(OW * C);
+  const TensorOpCost cost{row_elements * (resize ? 4 : 1) * sizeof(T), row_elements * sizeof(float),
+                          row_elements * (resize ? 10 : 2)};
+
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), N * OH, cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t n = row / OH;
+          const int64_t oy = row % OH;
+          const T* image = X_data + n * H * W * C;
+          float* output = Y_data + n * C * output_plane + oy * OW;
+
+          if (!resize) {
+            const T* input = image + oy * W * C;
+            for (int64_t c = 0; c < C; ++c) {
+              const float a = scale[c];
+              const float b = bias[c];
+              float* y = output + c * output_plane;
+              for (int64_t ox = 0; ox < OW; ++ox) {
+                y[ox] = a * static_cast<float>(input[ox * C + c]) + b;
+              }
+            }
+            continue;
+          }
+
+          const auto& row_tap = row_taps[static_cast<size_t>(oy)];
+          const T* input1 = image + row_tap.index1 * W * C;
+          const T* input2 = image + row_tap.index2 * W * C;
+          for (int64_t c = 0; c < C; ++c) {
+            // The affine transform is applied after interpolating as the weights add up to 1
+            const float a = scale[c];
+            const float b = bias[c];
+            float* y = output + c * output_plane;
+            for (int64_t ox = 0; ox < OW; ++ox) {
+              const auto& column_tap = column_taps[static_cast<size_t>(ox)];
+              const int64_t x1 = column_tap.index1 * C + c;
+              const int64_t x2 = column_tap.index2 * C + c;
+              const float top = column_tap.weight1 * static_cast<float>(input1[x1]) +
+                                column_tap.weight2 * static_cast<float>(input1[x2]);
+              const float bottom = column_tap.weight1 * static_cast<float>(input2[x1]) +
+                                   column_tap.weight2 * static_cast<float>(input2[x2]);
+              y[ox] = a * (row_tap.weight1 * top + row_tap.weight2 * bottom) + b;
+            }
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
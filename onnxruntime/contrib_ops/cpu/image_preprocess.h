@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+class ImagePreprocess final : public OpKernel {
+ public:
+  explicit ImagePreprocess(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  template <typename T>
+  Status ComputeImpl(OpKernelContext* context) const;
+
+  std::vector<float> scale_;
+  std::vector<float> bias_;
+  int64_t output_height_;
+  int64_t output_width_;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "reduce_mean_sub_pow.h"
+#include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/common.h"
+#include "core/util/math_cpuonly.h"
+#include "core/mlas/inc/mlas.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+ONNX_OPERATOR_KERNEL_EX(
+    ReduceMeanSubPow,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    ReduceMeanSubPow);
+
+Status ReduceMeanSubPow::Compute(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  const TensorShape& shape = X->Shape();
+  ORT_RETURN_IF_NOT(shape.NumDimensions() > 0, "ReduceMeanSubPow requires an input of rank 1 or higher.");
+
+  const int64_t axis = HandleNegativeAxis(axis_, shape.NumDimensions());
+  const int64_t N = shape.SizeToDimension(axis);
+  const int64_t D = shape.SizeFromDimension(axis);
+
+  Tensor* centered = context->Output(0, shape);
+  Tensor* squared = context->Output(1, shape);
+  if (N == 0 || D == 0) {
+    return Status::OK();
+  }
+
+  const float* X_data = X->Data<float>();
+  float* centered_data = centered->MutableData<float>();
+  float* squared_data = squared->MutableData<float>();
+
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), N,
+      TensorOpCost{static_cast<double>(D * sizeof(float)),
+                   static_cast<double>(2 * D * sizeof(float)),
+                   static_cast<double>(D * 4)},
+      [=](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          const float* x = X_data + i * D;
+          float* c = centered_data + i * D;
+
+          float sum;
+          MlasReduceRows(MlasReduceSum, x, &sum, 1, static_cast<size_t>(D), static_cast<size_t>(D), false);
+          const float mean = sum / static_cast<float>(D);
+
+          EigenVectorArrayMap<float>(c, D) = ConstEigenVectorArrayMap<float>(x, D) - mean;
+          EigenVectorArrayMap<float>(squared_data + i * D, D) = ConstEigenVectorArrayMap<float>(c, D).square();
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -389,6 +389,119 @@ ThreadPool::ThreadPool(Env* env,
 
 ThreadPool::~ThreadPool() = default;
 
+// Counts a parallel loop as running in the pool for the lifetime of the object, so that the count
+// is restored if the loop body throws on the calling thread.
+class ActiveLoopCount {
+ public:
+  explicit ActiveLoopCount(std::atomic<int>& count) : count_(count) {
+    count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  ~ActiveLoopCount() {
+    count_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int>& count_;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ActiveLoopCount);
+};
+
+// Brings the workers that left a loop for a higher-priority loop back to it.  The thread that started
+// the loop schedules a task for each worker that left, once no higher-priority loop runs anymore.
+// Such a task may only run after the loop ended, so it shares its state with the loop and does nothing
+// once the loop is closed.  Close() waits for the tasks that already rejoined the loop.
+class LoopRejoin {
+ public:
+  LoopRejoin() : state_(std::make_shared<State>()) {}
+
+  // Called by a worker as it leaves the loop.
+  void Leave(unsigned idx) {
+    std::lock_guard<OrtMutex> lock(state_->mutex);
+    left_.push_back(idx);
+    num_left_.store(static_cast<int>(left_.size()), std::memory_order_relaxed);
+  }
+
+  bool AnyLeft() const {
+    return num_left_.load(std::memory_order_relaxed) > 0;
+  }
+
+  // Returns a task for each worker that left, running run_work with the index of that worker.
+  std::vector<std::function<void()>> TakeRejoinTasks(const std::function<void(unsigned)>& run_work) {
+    std::vector<unsigned> left;
+    {
+      std::lock_guard<OrtMutex> lock(state_->mutex);
+      left.swap(left_);
+      num_left_.store(0, std::memory_order_relaxed);
+    }
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(left.size());
+    for (unsigned idx : left) {
+      tasks.push_back([state = state_, run_work = &run_work, idx]() {
+        {
+          std::lock_guard<OrtMutex> lock(state->mutex);
+          if (state->closed) {
+            return;
+          }
+          state->running++;
+        }
+        Running running(*state);
+        (*run_work)(idx);
+      });
+    }
+    return tasks;
+  }
+
+  void Close() {
+    std::unique_lock<OrtMutex> lock(state_->mutex);
+    state_->closed = true;
+    state_->cv.wait(lock, [this]() { return state_->running == 0; });
+  }
+
+  // Closes the loop when it goes out of scope, also when the loop body throws on the calling thread.
+  class CloseOnExit {
+   public:
+    explicit CloseOnExit(LoopRejoin& rejoin) : rejoin_(rejoin) {}
+
+    ~CloseOnExit() {
+      rejoin_.Close();
+    }
+
+   private:
+    LoopRejoin& rejoin_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CloseOnExit);
+  };
+
+ private:
+  struct State {
+    OrtMutex mutex;
+    OrtCondVar cv;
+    bool closed = false;
+    int running = 0;
+  };
+
+  // Counts a rejoined worker as running until it leaves the loop, even if the loop body throws.
+  class Running {
+   public:
+    explicit Running(State& state) : state_(state) {}
+
+    ~Running() {
+      std::lock_guard<OrtMutex> lock(state_.mutex);
+      if (--state_.running == 0) {
+        state_.cv.notify_all();
+      }
+    }
+
+   private:
+    State& state_;
+    ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Running);
+  };
+
+  std::shared_ptr<State> state_;
+  std::vector<unsigned> left_;
+  std::atomic<int> num_left_{0};
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(LoopRejoin);
+};
+
 // Base case for parallel loops, running iterations 0..total, divided into blocks
 // of block_size iterations, and calling into a function that takes a start..end
 // range of indices to run.
@@ -403,6 +516,30 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
     return;
   }
 
+  // Workers other than the calling thread (idx 0) leave the loop while a loop of higher priority runs
+  // in the pool, and the calling thread goes on with the iterations that are left.  Once no loop of
+  // higher priority runs anymore, the calling thread schedules the workers that left back into the loop.
+  const WorkPriority priority = current_priority;
+  ActiveLoopCount active_loop_count(active_loops_[static_cast<int>(priority)]);
+  LoopRejoin rejoin;
+
+  // Returns whether the thread running work item idx of run_work may claim more iterations
+  auto keep_claiming = [&](unsigned idx, const std::function<void(unsigned)>& run_work) {
+    if (idx == 0) {
+      if (rejoin.AnyLeft() && !HigherPriorityLoopActive(priority)) {
+        for (auto& task : rejoin.TakeRejoinTasks(run_work)) {
+          Schedule(std::move(task));
+        }
+      }
+      return true;
+    }
+    if (HigherPriorityLoopActive(priority)) {
+      rejoin.Leave(idx);
+      return false;
+    }
+    return true;
+  };
+
   auto d_of_p = DegreeOfParallelism(this);
   if (thread_options_.dynamic_block_base_ <= 0) {
     // Split the work across threads in the pool.  Each work item will run a loop claiming iterations,
@@ -417,14 +554,16 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
       unsigned my_home_shard = lc.GetHomeShard(idx);
       unsigned my_shard = my_home_shard;
       uint64_t my_iter_start, my_iter_end;
-      while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, block_size)) {
+      while (keep_claiming(idx, run_work) &&
+             lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, block_size)) {
         fn(static_cast<std::ptrdiff_t>(my_iter_start),
            static_cast<std::ptrdiff_t>(my_iter_end));
       }
     };
     // Run the work in the thread pool (and in the current thread).  Synchronization with helping
-    // threads is handled within RunInParallel, hence we can deallocate lc and other state captured by
-    // run_work.
+    // threads is handled within RunInParallel, and with the workers that rejoined the loop by
+    // close_rejoin, hence we can deallocate lc and other state captured by run_work.
+    LoopRejoin::CloseOnExit close_rejoin(rejoin);
     RunInParallel(run_work, num_work_items, block_size);
   } else {
     int num_of_blocks = d_of_p * thread_options_.dynamic_block_base_;
@@ -436,7 +575,8 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
       unsigned my_home_shard = lc.GetHomeShard(idx);
       unsigned my_shard = my_home_shard;
       uint64_t my_iter_start, my_iter_end;
-      while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, b)) {
+      while (keep_claiming(idx, run_work) &&
+             lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end, b)) {
         fn(static_cast<std::ptrdiff_t>(my_iter_start),
            static_cast<std::ptrdiff_t>(my_iter_end));
         auto todo = left.fetch_sub(static_cast<std::ptrdiff_t>(my_iter_end - my_iter_start), std::memory_order_relaxed);
@@ -447,10 +587,20 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
     };
     // Distribute task among all threads in the pool, reduce number of work items if 
     // num_of_blocks is smaller than number of threads.
+    LoopRejoin::CloseOnExit close_rejoin(rejoin);
     RunInParallel(run_work, std::min(NumThreads() + 1, num_of_blocks), base_block_size);
   }
 }
 
+bool ThreadPool::HigherPriorityLoopActive(WorkPriority priority) const {
+  for (int p = static_cast<int>(priority) + 1; p < kNumWorkPriorities; ++p) {
+    if (active_loops_[p].load(std::memory_order_relaxed) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void ThreadPool::SimpleParallelFor(std::ptrdiff_t total, const std::function<void(std::ptrdiff_t)>& fn) {
   ParallelForFixedBlockSizeScheduling(total, 1, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
     for (std::ptrdiff_t idx = first; idx < last; idx++) {
@@ -461,6 +611,14 @@ void ThreadPool::SimpleParallelFor(std::ptrdiff_t total, const std::function<voi
 
 void ThreadPool::Schedule(std::function<void()> fn) {
   if (underlying_threadpool_) {
+    // Worker threads run at normal priority between tasks, so only other priorities need to be carried over
+    const WorkPriority priority = current_priority;
+    if (priority != WorkPriority::kNormal) {
+      fn = [priority, fn = std::move(fn)]() {
+        PriorityScope priority_scope(priority);
+        fn();
+      };
+    }
     underlying_threadpool_->Schedule(std::move(fn));
   } else {
     fn();
@@ -481,6 +639,28 @@ std::string ThreadPool::StopProfiling() {
   }
 }
 
+ThreadPoolStats ThreadPool::GetStats() const {
+  if (underlying_threadpool_) {
+    return underlying_threadpool_->GetStats();
+  } else {
+    return {};
+  }
+}
+
+thread_local WorkPriority ThreadPool::current_priority{WorkPriority::kNormal};
+
+ThreadPool::PriorityScope::PriorityScope(WorkPriority priority) : previous_priority_(current_priority) {
+  current_priority = priority;
+}
+
+ThreadPool::PriorityScope::~PriorityScope() {
+  current_priority = previous_priority_;
+}
+
+WorkPriority ThreadPool::GetCurrentPriority() {
+  return current_priority;
+}
+
 thread_local ThreadPool::ParallelSection* ThreadPool::ParallelSection::current_parallel_section{nullptr};
 
 ThreadPool::ParallelSection::ParallelSection(ThreadPool* tp) {
@@ -650,6 +830,14 @@ std::string ThreadPool::StopProfiling(concurrency::ThreadPool* tp) {
   }
 }
 
+ThreadPoolStats ThreadPool::GetStats(const concurrency::ThreadPool* tp) {
+  if (tp) {
+    return tp->GetStats();
+  } else {
+    return {};
+  }
+}
+
 // Return the number of threads created by the pool.
 int ThreadPool::NumThreads() const {
   if (underlying_threadpool_) {
@@ -3,6 +3,7 @@
 
 #include "core/framework/allocation_planner.h"
 #include <list>
+#include <map>
 #include <unordered_map>
 #include <algorithm>
 #include <sstream>
@@ -90,7 +91,10 @@ std::ostream& operator<<(std::ostream& out, std::pair<const SequentialExecutionP
     if (0 <= index && static_cast<size_t>(index) < plan_size) {
       auto& elt_plan = plan.allocation_plan[index];
       out << elt_plan.alloc_kind;
-      if (elt_plan.alloc_kind == AllocKind::kReuse) out << " " << elt_plan.reused_buffer;
+      if (elt_plan.alloc_kind == AllocKind::kReuse) {
+        out << " " << elt_plan.reused_buffer;
+        if (elt_plan.is_view) out << " (view of " << elt_plan.reused_input << ")";
+      }
 
       auto& loc = elt_plan.location;
       out << ", " << loc.ToString();
@@ -209,6 +213,11 @@ class PlannerImpl {
   // they became free (more recently freed earlier in the list).
   std::list<FreeBufferInfo> freelist_;
 
+  // view_last_use_ : the step after which each view (see KernelDefBuilder::MayView) is no longer used, directly or
+  // through a value that reuses it. The kernel may have given a view storage of its own, so it is freed after that
+  // step rather than with the buffer it was planned to share.
+  std::map<OrtValueIndex, size_t> view_last_use_;
+
   OrtValueIndex Index(const OrtValueName& name) {
     OrtValueIndex result;
     auto status = ort_value_name_idx_map_.GetIdx(name, result);
@@ -222,6 +231,17 @@ class PlannerImpl {
   }
   int& UseCount(const OrtValueName& name) { return UseCount(Index(name)); }
 
+  // Records a use of value n at program_counter, which is also a use of any view that n is addressed through.
+  void UpdateViewLastUse(OrtValueIndex n, size_t program_counter) {
+    while (n >= 0 && AllocPlan(n).alloc_kind == AllocKind::kReuse) {
+      const auto& value_plan = AllocPlan(n);
+      if (value_plan.is_view) {
+        view_last_use_[n] = program_counter;
+      }
+      n = value_plan.reused_input;
+    }
+  }
+
   int DecrementUseCount(OrtValueIndex n) {
     int& use_count = --UseCount(n);
     assert(use_count >= 0);
@@ -286,7 +306,10 @@ class PlannerImpl {
 #endif
 
   // Find if there exists some input tensor that we can use in-place for output_arg_num-th input in the node.
-  bool FindReusableInput(const onnxruntime::Node& node, int output_arg_num, OrtValueIndex* reusable_input) {
+  // *is_view is set if the output may be a view of part of that input rather than an alias of all of it.
+  bool FindReusableInput(const onnxruntime::Node& node, int output_arg_num, OrtValueIndex* reusable_input,
+                         bool* is_view) {
+    *is_view = false;
 #ifdef ENABLE_TRAINING
     // Inputs of Yields are essentially the outputs for FW partial subgraph
     // Thses tensors will be pass back to pytorch, thus cannot share the buffer with other tensors
@@ -338,6 +361,29 @@ class PlannerImpl {
       }
     }
 
+    // a view never writes to the input, so like an alias it can share the input's buffer even if the input is
+    // used again later. the kernel picks the offset into the buffer at runtime.
+    auto view_input_index = [&ci, output_arg_num]() {
+      for (auto& pair : ci.kernel_def->MayView()) {
+        if (pair.second == output_arg_num) {
+          return pair.first;
+        }
+      }
+      const auto& variadic_may_view = ci.kernel_def->VariadicMayView();
+      if (variadic_may_view.has_value() && output_arg_num >= variadic_may_view->second) {
+        return variadic_may_view->first;
+      }
+      return -1;
+    }();
+    if ((0 <= view_input_index) && (static_cast<size_t>(view_input_index) < input_args.size())) {
+      auto p_input_arg = input_args[view_input_index];
+      if (p_input_arg->Exists()) {
+        *reusable_input = Index(p_input_arg->Name());
+        *is_view = true;
+        return true;
+      }
+    }
+
     const auto& inplace_map = ci.kernel_def->MayInplace();
     for (auto& pair : inplace_map) {
       if (pair.second == output_arg_num) {
@@ -898,6 +944,7 @@ class PlannerImpl {
         // Declare OrtValue index of the reused buffer.
         // The the OrtValue indexed by current may reuse the memory in the OrtValue indexed by reused.
         OrtValueIndex reused;
+        bool is_view = false;
         if (has_external_outputs) {
           ORT_ENFORCE(!IsNonTensor(*node_output), "Only tensors are supported for external outputs for now.");
           AllocPlan(current).alloc_kind = AllocKind::kAllocatedExternally;
@@ -944,11 +991,13 @@ class PlannerImpl {
             }
           }
         } else if (!context_.IsParallelExecutionEnabled() &&
-                   FindReusableInput(*pnode, static_cast<int>(output_arg_def_index), &reused)) {
+                   FindReusableInput(*pnode, static_cast<int>(output_arg_def_index), &reused, &is_view)) {
           // Re-using inputs is applicable for tensors, sequence tensors,
           // and optional types if the kernel has marked certain inputs as
           // possible candidates for re-use
           Reuse(reused, current, AllocKind::kReuse);
+          AllocPlan(current).reused_input = reused;
+          AllocPlan(current).is_view = is_view;
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
           InplaceReuse(reused, current);
 #endif
@@ -984,6 +1033,7 @@ class PlannerImpl {
             AllocPlan(current).life_interval.second = program_counter;
           }
 #endif
+          UpdateViewLastUse(Index(sym), program_counter);
           if ((original != -1) && (0 == DecrementUseCount(original))) {
             freelist_.push_front(FreeBufferInfo(original, program_counter));
             if (AllocPlan(original).alloc_kind == AllocKind::kAllocate) {
@@ -1006,6 +1056,7 @@ class PlannerImpl {
             AllocPlan(current).life_interval.second = program_counter;
           }
 #endif
+          UpdateViewLastUse(Index(sym), program_counter);
           if ((original != -1) && (0 == DecrementUseCount(original))) {
             freelist_.push_front(FreeBufferInfo(original, program_counter));
             if (AllocPlan(original).alloc_kind == AllocKind::kAllocate) {
@@ -1028,6 +1079,7 @@ class PlannerImpl {
             AllocPlan(current).life_interval.second = program_counter;
           }
 #endif
+          UpdateViewLastUse(Index(sym), program_counter);
           if (0 == DecrementUseCount(original)) {
             freelist_.push_front(FreeBufferInfo(original, program_counter));
             if (AllocPlan(original).alloc_kind == AllocKind::kAllocate) {
@@ -1149,14 +1201,24 @@ class PlannerImpl {
     // Store (indices of) ml-values to be freed in plan->to_be_freed
     // Set plan->execution_plan[n].free_from_index/free_to_index for every n that must free some ml-value.
 
-    plan_.to_be_freed.reserve(freelist_.size());
+    // The freelist is in reverse order of deallocate_point. Merge the views in, which are freed after their own
+    // last use as they may have storage of their own.
+    std::vector<FreeBufferInfo> to_be_freed(freelist_.rbegin(), freelist_.rend());
+    for (const auto& view : view_last_use_) {
+      to_be_freed.emplace_back(view.first, view.second);
+    }
+    std::stable_sort(to_be_freed.begin(), to_be_freed.end(),
+                     [](const FreeBufferInfo& a, const FreeBufferInfo& b) {
+                       return a.deallocate_point < b.deallocate_point;
+                     });
+
+    plan_.to_be_freed.reserve(to_be_freed.size());
     bool has_prev_dealloc_point = false;
     size_t prev_dealloc_point = 0;
     //TODO: should be size_t
     int current = 0;  // current index into the to_be_freed vector
 
-    // Copy all items from freelist to to_be_freed in reverse order
-    for (auto it = freelist_.rbegin(), end = freelist_.rend(); it != end; ++it) {
+    for (auto it = to_be_freed.cbegin(), end = to_be_freed.cend(); it != end; ++it) {
       plan_.to_be_freed.push_back(it->ml_value);
       //
       if (it->deallocate_point != prev_dealloc_point) {
@@ -6,6 +6,7 @@
 #include "core/framework/allocatormgr.h"
 #include "core/mlas/inc/mlas.h"
 #include "core/framework/utils.h"
+#include "core/platform/env.h"
 #include "core/session/ort_apis.h"
 #include <cstdlib>
 #include <sstream>
@@ -103,7 +104,11 @@ void AllocatorDefaultFree(void* p) {
 #endif  // USE_MIMALLOC
 
 void* CPUAllocator::Alloc(size_t size) {
-  return AllocatorDefaultAlloc(size);
+  void* p = AllocatorDefaultAlloc(size);
+  if (numa_node_ >= 0 && p != nullptr) {
+    Env::Default().SetPreferredNumaNode(p, size, numa_node_);
+  }
+  return p;
 }
 
 void CPUAllocator::Free(void* p) {
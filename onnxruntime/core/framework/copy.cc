@@ -3,8 +3,55 @@
 // Licensed under the MIT License.
 #include "core/framework/copy.h"
 
+#if defined(_M_AMD64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define ORT_COPY_HAS_SSE2_STREAMING
+#endif
+
 namespace onnxruntime {
 
+namespace strided_copy_detail {
+
+void NonTemporalMemcpy(void* dst, const void* src, size_t count) {
+#if defined(ORT_COPY_HAS_SSE2_STREAMING)
+  // not worth aligning the destination and fencing for small copies
+  constexpr size_t kMinStreamingBytes = 256;
+  if (count >= kMinStreamingBytes) {
+    auto* d = static_cast<uint8_t*>(dst);
+    const auto* s = static_cast<const uint8_t*>(src);
+
+    // non-temporal stores need a 16 byte aligned destination
+    const size_t head = (16 - (reinterpret_cast<uintptr_t>(d) & 15)) & 15;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    count -= head;
+
+    const size_t streamed = count & ~size_t{63};
+    for (size_t i = 0; i < streamed; i += 64) {
+      __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+      __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 16));
+      __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 32));
+      __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 48));
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + i), v0);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 16), v1);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 32), v2);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(d + i + 48), v3);
+    }
+
+    // make the streamed data visible before the thread pool signals completion
+    _mm_sfence();
+
+    memcpy(d + streamed, s + streamed, count - streamed);
+    return;
+  }
+#endif
+
+  memcpy(dst, src, count);
+}
+
+}  // namespace strided_copy_detail
+
 TensorShapeVector StridesForTensor(const Tensor& tensor) {
   const auto& shape = tensor.Shape();
   TensorShapeVector strides(shape.NumDimensions());
@@ -17,6 +64,21 @@ TensorShapeVector StridesForTensor(const Tensor& tensor) {
   return strides;
 }
 
+bool MakeViewIfSharingBuffer(const Tensor& input, Tensor& output, bool can_view, std::ptrdiff_t byte_offset,
+                             const AllocatorPtr& allocator) {
+  if (output.DataRaw() != input.DataRaw() || output.Shape().Size() == 0) {
+    return false;
+  }
+
+  if (can_view) {
+    output.SetByteOffset(output.ByteOffset() + byte_offset);
+    return true;
+  }
+
+  output = Tensor(input.DataType(), output.Shape(), allocator);
+  return false;
+}
+
 namespace {
 /*
     Check if we can coalesce dim with dim + 1.
@@ -17,8 +17,22 @@ void CoalesceDimensions(
 
 TensorShapeVector StridesForTensor(const Tensor& tensor);
 
+// Outputs of kernels registered with KernelDefBuilder::MayView are planned to share the buffer of the input.
+// If 'output' does, it is made a view that starts 'byte_offset' bytes into 'input' when 'can_view' is true, or
+// otherwise given storage of its own from 'allocator' so the result can be written to it.
+// Returns true if 'output' is now a view of 'input' and nothing needs to be copied.
+bool MakeViewIfSharingBuffer(const Tensor& input, Tensor& output, bool can_view, std::ptrdiff_t byte_offset,
+                             const AllocatorPtr& allocator);
+
+// StridedCopy writes outputs of at least this many bytes with non-temporal stores. They are too large to stay in the
+// last level cache, so streaming them out avoids evicting the source data that is still being read.
+constexpr size_t kStridedCopyNonTemporalThreshold = size_t{16} * 1024 * 1024;
+
 namespace strided_copy_detail {
 
+// memcpy that uses non-temporal stores where the platform supports them. Falls back to memcpy otherwise.
+void NonTemporalMemcpy(void* dst, const void* src, size_t count);
+
 template <typename T>
 void Copy1DNonContiguous(T* dst, int64_t dst_stride, const T* src, int64_t src_stride, std::ptrdiff_t count) {
   for (std::ptrdiff_t i = 0; i < count; i++) {
@@ -29,22 +43,29 @@ void Copy1DNonContiguous(T* dst, int64_t dst_stride, const T* src, int64_t src_s
 }
 
 template <typename T>
-void Copy1DContiguous(T* dst, const T* src, std::ptrdiff_t count) {
+void Copy1DContiguous(T* dst, const T* src, std::ptrdiff_t count, bool non_temporal = false) {
   if constexpr (std::is_same_v<std::string, T>) {
+    ORT_UNUSED_PARAMETER(non_temporal);
     Copy1DNonContiguous(dst, 1, src, 1, count);
   } else {
-    memcpy(dst, src, count * sizeof(T));
+    if (non_temporal) {
+      NonTemporalMemcpy(dst, src, count * sizeof(T));
+    } else {
+      memcpy(dst, src, count * sizeof(T));
+    }
   }
 }
 
 template <typename T>
-void Copy1D(T* dst, int64_t dst_stride, const T* src, int64_t src_stride, std::ptrdiff_t count) {
+void Copy1D(T* dst, int64_t dst_stride, const T* src, int64_t src_stride, std::ptrdiff_t count,
+            bool non_temporal = false) {
   if constexpr (std::is_same_v<std::string, T>) {
     // strings should always be copied using the for loop
+    ORT_UNUSED_PARAMETER(non_temporal);
     Copy1DNonContiguous(dst, dst_stride, src, src_stride, count);
   } else {
     if (dst_stride == 1 && src_stride == 1) {
-      Copy1DContiguous(dst, src, count);
+      Copy1DContiguous(dst, src, count, non_temporal);
     } else {
       Copy1DNonContiguous(dst, dst_stride, src, src_stride, count);
     }
@@ -131,10 +152,16 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
 
   if (num_iterations <= 1) {
     // scalar edge case
-    dst[0] = src[0];
+    if (num_iterations == 1) {
+      dst[0] = src[0];
+    }
     return;
   }
 
+  // stream large outputs past the cache. strings own heap memory so they are always assigned.
+  const bool non_temporal = !std::is_same_v<std::string, T> &&
+                            static_cast<size_t>(num_iterations) * sizeof(T) >= kStridedCopyNonTemporalThreshold;
+
   // TODOs for when we have strided tensors:
   // - Reorder dimensions so that we iterate along the smallest strides first
 
@@ -153,7 +180,8 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
     concurrency::ThreadPool::TryParallelFor(
         thread_pool, static_cast<std::ptrdiff_t>(num_iterations),
         {static_cast<float>(sizeof(T)), static_cast<float>(sizeof(T)), 1.0F},
-        [src_stride, dst_stride, dst, src, contiguous_span_size](std::ptrdiff_t first, std::ptrdiff_t last) {
+        [src_stride, dst_stride, dst, src, contiguous_span_size, non_temporal](std::ptrdiff_t first,
+                                                                                std::ptrdiff_t last) {
           // get the current inner and outer index
           std::ptrdiff_t inner = first % contiguous_span_size;
           std::ptrdiff_t outer = first / contiguous_span_size;
@@ -166,7 +194,7 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
             auto elements_to_copy = contiguous_span_size - inner;
             // never copy more than what is in our partition
             elements_to_copy = std::min<std::ptrdiff_t>(elements_to_copy, last - first);
-            strided_copy_detail::Copy1DContiguous<T>(dst + dst_idx, src + src_idx, elements_to_copy);
+            strided_copy_detail::Copy1DContiguous<T>(dst + dst_idx, src + src_idx, elements_to_copy, non_temporal);
             inner = 0;
             outer++;
             first += elements_to_copy;
@@ -178,7 +206,8 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
 
           // Step 2: copy contiguous span by contiguous span until we reach the penultimate span
           while (first < last - contiguous_span_size) {
-            strided_copy_detail::Copy1DContiguous<T>(dst + dst_idx, src + src_idx, contiguous_span_size);
+            strided_copy_detail::Copy1DContiguous<T>(dst + dst_idx, src + src_idx, contiguous_span_size,
+                                                     non_temporal);
             dst_idx += dst_stride;
             src_idx += src_stride;
             first += contiguous_span_size;
@@ -187,7 +216,7 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
           // element in our partition
           ORT_ENFORCE(last >= first);
           auto last_span_size = last - first;
-          strided_copy_detail::Copy1DContiguous<T>(dst + dst_idx, src + src_idx, last_span_size);
+          strided_copy_detail::Copy1DContiguous<T>(dst + dst_idx, src + src_idx, last_span_size, non_temporal);
         });
   } else {
     // enforce that the lambda doesn't change anything
@@ -198,8 +227,8 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
     concurrency::ThreadPool::TryParallelFor(
         thread_pool, static_cast<std::ptrdiff_t>(num_iterations),
         {static_cast<float>(sizeof(T)), static_cast<float>(sizeof(T)), 1.0F},
-        [&const_copy_shape, &const_dst_strides, dst, src, &const_src_strides, dims](std::ptrdiff_t first,
-                                                                                    std::ptrdiff_t last) {
+        [&const_copy_shape, &const_dst_strides, dst, src, &const_src_strides, dims,
+         non_temporal](std::ptrdiff_t first, std::ptrdiff_t last) {
           strided_copy_detail::NdCounter counter(const_copy_shape, first, last);
 
           auto last_dst_stride = const_dst_strides[dims - 1];
@@ -215,7 +244,8 @@ void StridedCopy(concurrency::ThreadPool* thread_pool,
               src_idx += static_cast<std::ptrdiff_t>(counter.current_index[dim] * const_src_strides[dim]);
             }
             // we can copy until the current dimension is done (or until we hit the last element we are trying to copy)
-            strided_copy_detail::Copy1D<T>(dst + dst_idx, last_dst_stride, src + src_idx, last_src_stride, iter_size);
+            strided_copy_detail::Copy1D<T>(dst + dst_idx, last_dst_stride, src + src_idx, last_src_stride, iter_size,
+                                           non_temporal);
 
             counter.Step(iter_size);
             iter_size = counter.NextStepSize();
@@ -234,7 +264,8 @@ inline bool StridedCopyIfEnabled(concurrency::ThreadPool* thread_pool,
                                  const TensorShapeVector& dst_strides,
                                  const TensorShape& copy_shape,
                                  const Tensor& src,
-                                 const TensorShapeVector& src_strides) {
+                                 const TensorShapeVector& src_strides,
+                                 std::ptrdiff_t src_offset = 0) {
   constexpr bool enabled = utils::HasTypeWithSameSize<EnabledTypes, T>();
   if constexpr (enabled) {
     // T doesn't necessarily match the data type in src or dst so use reinterpret_cast.
@@ -242,7 +273,7 @@ inline bool StridedCopyIfEnabled(concurrency::ThreadPool* thread_pool,
     StridedCopy<T>(thread_pool,
                    reinterpret_cast<T*>(dst.MutableDataRaw()) + dst_offset,
                    dst_strides, copy_shape,
-                   reinterpret_cast<const T*>(src.DataRaw()),
+                   reinterpret_cast<const T*>(src.DataRaw()) + src_offset,
                    src_strides);
   }
 
@@ -252,6 +283,7 @@ inline bool StridedCopyIfEnabled(concurrency::ThreadPool* thread_pool,
 // EnabledTypes is an onnxruntime::TypeList with the enabled types in this build.
 // see "core/framework/element_type_lists.h" for default lists or the usage in
 // onnxruntime/core/providers/cpu/tensor/concat.cc
+// dst_offset and src_offset are in elements.
 template <typename EnabledDataTypes>
 Status DispatchStridedCopy(concurrency::ThreadPool* thread_pool,
                            Tensor& dst,
@@ -259,7 +291,8 @@ Status DispatchStridedCopy(concurrency::ThreadPool* thread_pool,
                            const TensorShapeVector& dst_strides,
                            const TensorShape& copy_shape,
                            const Tensor& src,
-                           const TensorShapeVector& src_strides) {
+                           const TensorShapeVector& src_strides,
+                           std::ptrdiff_t src_offset = 0) {
   ORT_ENFORCE(dst.DataType() == src.DataType(), "src and dst types must match");
 
   bool supported = false;
@@ -267,27 +300,31 @@ Status DispatchStridedCopy(concurrency::ThreadPool* thread_pool,
     if (utils::HasType<EnabledDataTypes, std::string>()) {
       supported = true;
       StridedCopy(thread_pool, dst.MutableData<std::string>() + dst_offset, dst_strides, copy_shape,
-                  src.Data<std::string>(), src_strides);
+                  src.Data<std::string>() + src_offset, src_strides);
     }
   } else {
     const auto element_size = src.DataType()->Size();
     switch (element_size) {
       case sizeof(uint32_t):
         supported = StridedCopyIfEnabled<EnabledDataTypes, uint32_t>(thread_pool, dst, dst_offset, dst_strides,
-                                                                     copy_shape, src, src_strides);
+                                                                     copy_shape, src, src_strides,
+                                                                     src_offset);
         break;
       case sizeof(uint64_t):
         supported = StridedCopyIfEnabled<EnabledDataTypes, uint64_t>(thread_pool, dst, dst_offset, dst_strides,
-                                                                     copy_shape, src, src_strides);
+                                                                     copy_shape, src, src_strides,
+                                                                     src_offset);
         break;
       case sizeof(uint16_t):
         supported = StridedCopyIfEnabled<EnabledDataTypes, uint16_t>(thread_pool, dst, dst_offset, dst_strides,
-                                                                     copy_shape, src, src_strides);
+                                                                     copy_shape, src, src_strides,
+                                                                     src_offset);
         break;
       case sizeof(uint8_t):
         static_assert(sizeof(bool) == sizeof(uint8_t), "Need to enable separate case for 'bool' on this platform.");
         supported = StridedCopyIfEnabled<EnabledDataTypes, uint8_t>(thread_pool, dst, dst_offset, dst_strides,
-                                                                    copy_shape, src, src_strides);
+                                                                    copy_shape, src, src_strides,
+                                                                    src_offset);
         break;
       // It's possible that bool is not 1 byte. static_assert above checks if we need to enable this on a platform.
       //case sizeof(bool):
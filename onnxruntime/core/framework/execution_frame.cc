@@ -7,6 +7,7 @@
 
 #include "core/framework/mem_pattern_planner.h"
 #include "core/framework/execution_plan_base.h"
+#include "core/framework/execution_trace.h"
 #include "core/framework/sequential_execution_plan.h"
 #include "core/framework/ort_value_pattern_planner.h"
 #include "core/framework/tensorprotoutils.h"
@@ -333,7 +334,15 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
     : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs),
       session_state_(session_state),
       mem_patterns_(nullptr),
-      planner_(nullptr) {
+      planner_(nullptr),
+      inferred_shapes_(nullptr),
+      trace_(nullptr),
+      state_(session_state.AcquireExecutionFrameState()) {
+  if (state_ == nullptr) {
+    state_ = std::make_unique<ExecutionFrameState>();
+  }
+  SwapAllValues(state_->all_values);
+
   Init(
       feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
 #if !defined(DISABLE_SPARSE_TENSORS)
@@ -382,11 +391,26 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
 
     //if there are some traditional ml value type in inputs disable the memory pattern optimization.
     if (all_tensors) {
-      mem_patterns_ = session_state.GetMemoryPatternGroup(feeds, feed_mlvalue_idxs, inferred_shapes_);
-      // if no existing patterns, generate one in this executionframe
+      mem_patterns_ = session_state.GetMemoryPatternGroup(feeds, feed_mlvalue_idxs, inferred_shapes_, trace_);
+
+      // the buffers of the previous frame fit if it ran with the same patterns, otherwise free them now
+      std::map<OrtMemoryInfo, BufferUniquePtr> reused_buffers;
+      if (mem_patterns_ != nullptr && state_->mem_patterns == mem_patterns_) {
+        reused_buffers.swap(state_->buffers);
+      } else {
+        state_->buffers.clear();
+      }
+
+      // if no existing patterns, generate one in this executionframe unless the cache has no room left for it
       if (!mem_patterns_) {
-        planner_ = std::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan());
+        if (!session_state.IsMemoryPatternCacheFull()) {
+          planner_ = std::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan());
+        }
       } else {
+        if (trace_ != nullptr) {
+          pattern_buffers_.resize(mem_patterns_->locations.size(), nullptr);
+        }
+
         // pre-allocate the big chunk requested in memory pattern.
         // all the internal kernel's input/output tensors will be allocated on these buffer.
         for (size_t i = 0; i < mem_patterns_->locations.size(); i++) {
@@ -414,7 +438,12 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
               // Memory dynamically allocated when executing kernels is not recorded using this field.
               static_activation_memory_sizes_in_byte_[location.name] = peak_size;
 #endif
-              buffer = alloc->Alloc(peak_size);
+              auto reused_buffer = reused_buffers.find(location);
+              if (reused_buffer != reused_buffers.end()) {
+                buffer = reused_buffer->second.release();
+              } else {
+                buffer = alloc->Alloc(peak_size);
+              }
               // handle allocator that doesn't throw
               if (buffer == nullptr) {
                 // INFO level as this may fire on every run and there may not be much a user can do
@@ -431,6 +460,9 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
 
             if (buffer != nullptr) {
               buffers_[location] = BufferUniquePtr(buffer, alloc);
+              if (trace_ != nullptr) {
+                pattern_buffers_[i] = buffer;
+              }
             }
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
             //Record activation memory pattern
@@ -450,7 +482,17 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
   }
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+ExecutionFrame::~ExecutionFrame() {
+  // release the values before handing their storage to the next frame, as some of them live in buffers_
+  SwapAllValues(state_->all_values);
+  for (auto& value : state_->all_values) {
+    value = OrtValue();
+  }
+
+  state_->mem_patterns = mem_patterns_;
+  state_->buffers = std::move(buffers_);
+  session_state_.ReleaseExecutionFrameState(std::move(state_));
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
@@ -500,6 +542,19 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
     ort_value.SetFence(f);
   }
 
+  // a trace has the address in the pre-allocated big chunk at hand. it only places values of the memory pattern.
+  if (trace_ != nullptr) {
+    const auto& placement = trace_->placements[ort_value_index];
+    if (placement.location >= 0 && placement.size == size) {
+      void* buffer = pattern_buffers_[placement.location];
+      if (buffer != nullptr) {
+        return AllocateTensorWithPreAllocateBufferHelper(
+            ort_value, static_cast<void*>(static_cast<char*>(buffer) + placement.offset), element_type, location,
+            shape);
+      }
+    }
+  }
+
   // if we have pre-calculated memory pattern, and the ort_value is not output mlvalue
   // try to allocated on pre-allocated big chunk.
   const auto& per_alloc_plan = GetAllocationPlan(ort_value_index);
@@ -563,15 +618,17 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
 
 Status ExecutionFrame::AllocateMLValueTensorPreAllocateBuffer(OrtValue& ort_value, int ort_value_index_reuse,
                                                               MLDataType element_type, const OrtMemoryInfo& location,
-                                                              const TensorShape& shape, bool create_fence) {
+                                                              const TensorShape& shape, bool create_fence,
+                                                              bool is_view) {
   OrtValue& ort_value_reuse = GetMutableMLValue(ort_value_index_reuse);
 
   auto* reuse_tensor = ort_value_reuse.GetMutable<Tensor>();
   auto buffer_num_elements = reuse_tensor->Shape().Size();
   auto required_num_elements = shape.Size();
 
-  // check number of elements matches. shape may not be an exact match (e.g. Reshape op)
-  if (buffer_num_elements != required_num_elements) {
+  // check number of elements matches. shape may not be an exact match (e.g. Reshape op).
+  // a view covers part of the buffer so may be smaller.
+  if (buffer_num_elements != required_num_elements && !(is_view && buffer_num_elements > required_num_elements)) {
     // could be an allocation planner bug (less likely) or the model incorrectly uses something like 'None'
     // as a dim_param, or -1 in dim_value in multiple places making the planner think those shapes are equal.
     auto message = onnxruntime::MakeString(
@@ -715,8 +772,15 @@ Status ExecutionFrame::AllocateAsPerAllocationPlan(OrtValue& ort_value, int ort_
 
         ORT_RETURN_IF_ERROR(AllocateReusedOrtValueIfNotAllocatedHelper(reuse_mlvalue_index, shape));
 
+        // address the data through the node input being reused. it may be a view that starts part way into the
+        // buffer, or a view that was given storage of its own by its kernel.
+        if (per_alloc_plan.reused_input >= 0 && GetMLValue(per_alloc_plan.reused_input).IsAllocated()) {
+          reuse_mlvalue_index = per_alloc_plan.reused_input;
+        }
+
         ORT_RETURN_IF_ERROR(AllocateMLValueTensorPreAllocateBuffer(
-            ort_value, reuse_mlvalue_index, ml_data_type, alloc_info, *shape, per_alloc_plan.create_fence_if_async));
+            ort_value, reuse_mlvalue_index, ml_data_type, alloc_info, *shape, per_alloc_plan.create_fence_if_async,
+            per_alloc_plan.is_view));
         break;
       }
       case AllocKind::kShare: {
@@ -846,6 +910,11 @@ void ExecutionFrame::TraceFree(int ort_value_idx) {
     ORT_ENFORCE(ort_value_idx >= 0 && static_cast<size_t>(ort_value_idx) < alloc_plan.size());
     const auto& per_alloc_plan = alloc_plan[ort_value_idx];
 
+    // views are released with the buffer they share but were never traced as allocations
+    if (per_alloc_plan.alloc_kind == AllocKind::kReuse) {
+      return;
+    }
+
     // only trace tensors
     auto ml_type = per_alloc_plan.value_type;
     if (ml_type->IsTensorType()) {
@@ -884,8 +953,12 @@ bool ExecutionFrame::TryGetInferredShape(int index, TensorShape& shape) const {
 
   // Search for inferred shape.
   // If inferred shape is found, it's assigned to "shape" so that caller can use it.
-  auto it = inferred_shapes_.find(ort_value_idx);
-  if (it != inferred_shapes_.end()) {
+  if (inferred_shapes_ == nullptr) {
+    return false;
+  }
+
+  auto it = inferred_shapes_->find(ort_value_idx);
+  if (it != inferred_shapes_->end()) {
     shape = it->second;
     return true;
   }
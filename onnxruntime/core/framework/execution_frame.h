@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
 #include <mutex>
 #include <vector>
 #include <unordered_map>
@@ -25,6 +27,7 @@ class OrtValueNameIdxMap;
 class OrtValuePatternPlanner;
 struct MemoryPatternGroup;
 class NodeIndexInfo;
+struct ExecutionTrace;
 
 class IExecutionFrame {
  protected:
@@ -92,6 +95,10 @@ class IExecutionFrame {
   // returns true if the ort_value_idx is an output from the graph
   bool IsOutput(int ort_value_idx) const;
 
+  // Swap all_values_ with a vector that is kept between frames. Before Init the vector must be empty or only
+  // contain empty values.
+  void SwapAllValues(std::vector<OrtValue>& all_values) { all_values_.swap(all_values); }
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(IExecutionFrame);
 
@@ -126,6 +133,18 @@ class IExecutionFrame {
   const OrtValueNameIdxMap& ort_value_idx_map_;
 };
 
+// The part of an ExecutionFrame that the SessionState keeps after the frame is destroyed, so that the next frame
+// doesn't need to reallocate it. For a run with the same input shapes as the previous one this is the value vector
+// and the memory pattern buffers.
+struct ExecutionFrameState {
+  // all_values_ of the frame, with every value released
+  std::vector<OrtValue> all_values;
+
+  // the memory patterns the buffers were allocated for
+  const MemoryPatternGroup* mem_patterns = nullptr;
+  std::map<OrtMemoryInfo, BufferUniquePtr> buffers;
+};
+
 class ExecutionFrame final : public IExecutionFrame {
  public:
   ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const std::vector<OrtValue>& feeds,
@@ -145,7 +164,7 @@ class ExecutionFrame final : public IExecutionFrame {
 
   Status AllocateMLValueTensorPreAllocateBuffer(OrtValue& ort_value, int ort_value_index_reuse, MLDataType element_type,
                                                 const OrtMemoryInfo& location, const TensorShape& shape,
-                                                bool create_fence = false);
+                                                bool create_fence = false, bool is_view = false);
 
   // thread-safe
   Status GeneratePatterns(MemoryPatternGroup* out) const;
@@ -154,6 +173,11 @@ class ExecutionFrame final : public IExecutionFrame {
     return planner_ != nullptr;
   }
 
+  // The trace recorded for the memory pattern of this frame, or nullptr if the run can't be replayed.
+  const ExecutionTrace* GetExecutionTrace() const {
+    return trace_;
+  }
+
   // This function try retrieve the inferred shapes for the given NodeArg index.
   // If the retrival is sucessful, this function returns true and false otherwise.
   bool TryGetInferredShape(int index, TensorShape& shape) const override;
@@ -224,10 +248,17 @@ class ExecutionFrame final : public IExecutionFrame {
   std::map<OrtMemoryInfo, BufferUniquePtr> buffers_;
 
   // Given the input shapes of the executed graph, ExecutionFrame tries inferring
-  // all symbolic shapes. inferred_shapes_[i] is the shape of OrtValue indexed
+  // all symbolic shapes. (*inferred_shapes_)[i] is the shape of OrtValue indexed
   // by i, if the key i exists.
-  // inferred_shapes_ is generated together with mem_patterns_.
-  std::unordered_map<int, TensorShape> inferred_shapes_;
+  // inferred_shapes_ is generated together with mem_patterns_ and cached with them in the SessionState.
+  const std::unordered_map<int, TensorShape>* inferred_shapes_;
+
+  // ExecutionTrace cached with mem_patterns_, if any, and the memory pattern buffers by location index for it.
+  const ExecutionTrace* trace_;
+  std::vector<void*> pattern_buffers_;
+
+  // State of an earlier frame that this one reuses, and returns to the SessionState when it is destroyed.
+  std::unique_ptr<ExecutionFrameState> state_;
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   // Size of virtual memory allocated before any kernel execution.
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// An ExecutionTrace is replayed without the per node diagnostics and instrumentation of these builds, so they
+// always walk the plan
+#if !defined(DEBUG_NODE_INPUTS_OUTPUTS) && !(!defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)) && \
+    !defined(ENABLE_NVTX_PROFILE) && !defined(CONCURRENCY_VISUALIZER) && !defined(ONNXRUNTIME_ENABLE_INSTRUMENT)
+#define REPLAY_EXECUTION_TRACE
+#endif
+
+namespace onnxruntime {
+class OpKernel;
+
+/**
+ * Flat record of how a run of a SessionState with a cached memory pattern executes, so that later runs with the
+ * same input shapes can replay it instead of walking the execution plan and looking up memory pattern blocks.
+ * Only created for sessions that enable replay and run every node synchronously on the CPU.
+ */
+struct ExecutionTrace {
+  struct Step {
+    const OpKernel* kernel;
+
+    // range of SequentialExecutionPlan::to_be_freed to release after the kernel ran
+    int free_from_index;
+    int free_to_index;
+  };
+
+  // where a tensor lives in the memory pattern buffers
+  struct Placement {
+    // index into MemoryPatternGroup::locations, -1 for a value that isn't in the memory pattern
+    int location = -1;
+    size_t offset = 0;
+    size_t size = 0;
+  };
+
+  // the kernels to call, in execution plan order
+  std::vector<Step> steps;
+
+  // placement of each OrtValue, indexed by OrtValue index
+  std::vector<Placement> placements;
+};
+
+}  // namespace onnxruntime
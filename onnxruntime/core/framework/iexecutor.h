@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "core/common/common.h"
 #include "core/common/status.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/ort_value.h"
@@ -24,6 +25,11 @@ class IExecutor {
 
   virtual ~IExecutor() = default;
 
+  // Returns whether a run with the given deadline has run out of time. TimePoint::max() means no deadline.
+  static bool DeadlineExceeded(const TimePoint& deadline) {
+    return deadline != TimePoint::max() && std::chrono::high_resolution_clock::now() > deadline;
+  }
+
   /**
    * The lifetime of 'fetches' is limited by 'session_state'
    */
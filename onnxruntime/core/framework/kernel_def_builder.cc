@@ -262,6 +262,17 @@ KernelDefBuilder& KernelDefBuilder::VariadicAlias(int input_offset, int output_o
   return *this;
 }
 
+KernelDefBuilder& KernelDefBuilder::MayView(int input_index, int output_index) {
+  kernel_def_->may_view_map_.emplace_back(input_index, output_index);
+  return *this;
+}
+
+KernelDefBuilder& KernelDefBuilder::VariadicMayView(int input_index, int output_offset) {
+  ORT_ENFORCE(input_index >= 0 && output_offset >= 0);
+  kernel_def_->variadic_may_view_ = std::make_pair(input_index, output_offset);
+  return *this;
+}
+
 #ifdef ENABLE_TRAINING
 KernelDefBuilder& KernelDefBuilder::MayStridedInput(int input_index) {
   kernel_def_->may_strided_inputs_.emplace_back(input_index);
@@ -56,6 +56,9 @@ std::optional<HashValue> GetInternalNhwcOpHash(const Node& node) {
       // first input is a tensor. could be uint8 or int8
       bool is_uint8 = input_0_type.tensor_type().elem_type() == utils::ToTensorProtoElementType<uint8_t>();
       return is_uint8 ? 8512357837341844248ULL : 11773579655431087496ULL;
+    } else if (op_type == "RoiAlign") {
+      // only float is supported
+      return 5549839173608779200ULL;
     }
   }
 
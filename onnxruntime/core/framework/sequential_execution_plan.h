@@ -32,6 +32,12 @@ struct AllocPlanPerValue {
   // reused_buffer is valid only if alloc_kind == kReuse. It indicates
   // which OrtValue's buffer must be reused for this OrtValue.
   OrtValueIndex reused_buffer{0};
+  // reused_input is set if the value reuses a node input (alias, in-place or view). The data is addressed
+  // through that input as it may itself be a view that starts at an offset into reused_buffer.
+  OrtValueIndex reused_input{-1};
+  // the value may be a view of part of reused_input (see KernelDefBuilder::MayView). The kernel may also give
+  // it storage of its own, so it is released after its own last use rather than together with reused_buffer.
+  bool is_view{false};
   // if the value is used in async kernel, a fence object would be created
   // note the fence object would be shared between MLValues reusing the same buffer
   bool create_fence_if_async{false};
@@ -11,6 +11,7 @@
 #include "core/common/logging/logging.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
+#include "core/framework/execution_trace.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
@@ -136,11 +137,23 @@ static void CalculateTotalInputSizes(const OpKernelContextInternal* op_kernel_co
   input_type_shape = ss.str();
 }
 
+static Status CheckRunNotStopped(const bool& terminate_flag, const TimePoint& deadline,
+                                 const logging::Logger& logger);
+
+static Status ComputeKernel(const OpKernel& kernel, OpKernelContextInternal& op_kernel_context,
+                            const logging::Logger& logger);
+
 static Status ReleaseNodeMLValues(ExecutionFrame& frame,
                                   const SequentialExecutionPlan& seq_exec_plan,
-                                  const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan,
+                                  int free_from_index, int free_to_index,
                                   const logging::Logger& logger);
 
+#ifdef REPLAY_EXECUTION_TRACE
+static Status ReplayExecutionTrace(const SessionState& session_state, const ExecutionTrace& trace,
+                                   ExecutionFrame& frame, const bool& terminate_flag, const TimePoint& deadline,
+                                   const logging::Logger& logger);
+#endif
+
 Status SequentialExecutor::Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                                    const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
                                    std::vector<OrtValue>& fetches,
@@ -173,6 +186,22 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
   ORT_UNUSED_PARAMETER(only_execute_path_to_fetches_);
 #endif
 
+#ifdef REPLAY_EXECUTION_TRACE
+  // the trace records every node, and the profiler needs the events of the loop below
+  const ExecutionTrace* trace = frame.GetExecutionTrace();
+#if !defined(ORT_MINIMAL_BUILD)
+  if (only_execute_path_to_fetches) {
+    trace = nullptr;
+  }
+#endif
+  if (trace != nullptr && !is_profiler_enabled) {
+    VLOGS(logger, 1) << "Replaying execution trace of " << trace->steps.size() << " kernels";
+    session_state.RecordExecutionTraceReplay();
+    ORT_RETURN_IF_ERROR(ReplayExecutionTrace(session_state, *trace, frame, terminate_flag_, deadline_, logger));
+    return frame.GetOutputs(fetches);
+  }
+#endif
+
   LOGS(logger, INFO) << "Begin execution";
   const SequentialExecutionPlan& seq_exec_plan = *session_state.GetExecutionPlan();
   const auto& exec_plan_vec = seq_exec_plan.execution_plan;
@@ -214,10 +243,7 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 
 
   for (const auto& node_exec_plan : exec_plan_vec) {
-    if (terminate_flag_) {
-      LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
-      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
-    }
+    ORT_RETURN_IF_ERROR(CheckRunNotStopped(terminate_flag_, deadline_, logger));
 
     auto node_index = node_exec_plan.node_index;
 
@@ -335,39 +361,14 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
           MakeString(node.OpType(), ".", node.Index(), "(", node.Name(), ")"), profile::Color::Yellow);
       node_compute_range.Begin();
 #endif
-      ORT_TRY {
-#ifdef ENABLE_TRAINING
-        if (p_op_kernel->KernelDef().AllocateInputsContiguously()) {
-          ORT_RETURN_IF_ERROR(utils::VerifyInputTensorsAllocatedContiguously(&op_kernel_context));
-        }
-#endif
-
-        compute_status = p_op_kernel->Compute(&op_kernel_context);
-      }
-      ORT_CATCH(const std::exception& ex) {
-        ORT_HANDLE_EXCEPTION([&]() {
-          compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
-        });
-      }
+      compute_status = ComputeKernel(*p_op_kernel, op_kernel_context, logger);
 
 #ifdef ENABLE_NVTX_PROFILE
       node_compute_range.End();
 #endif
     }
 
-    if (!compute_status.IsOK()) {
-      std::ostringstream ss;
-      ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
-         << "' Status Message: " << compute_status.ErrorMessage();
-      //If the computation failed, we still can record the memory consumption
-#if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
-      MemoryInfo::MemoryInfoProfile::CreateEvents("dynamic activations_" + std::to_string(MemoryInfo::GetIteration()),
-                                                  MemoryInfo::MemoryInfoProfile::GetAndIncreasePid(), MemoryInfo::MapType::DynamicActivation, "", 0);
-#endif
-      const auto msg_string = ss.str();
-      LOGS(logger, ERROR) << msg_string;
-      return Status(compute_status.Category(), compute_status.Code(), msg_string);
-    }
+    ORT_RETURN_IF_ERROR(compute_status);
 
     if (is_profiler_enabled) {
       // Calculate total output sizes for this operation.
@@ -454,7 +455,8 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 
     // free ml-values corresponding to this node
     VLOGS(logger, 1) << "Releasing node ML values.";
-    ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan, logger));
+    ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, node_exec_plan.free_from_index,
+                                            node_exec_plan.free_to_index, logger));
   }
 
 #ifdef ENABLE_NVTX_PROFILE
@@ -520,11 +522,62 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
   return Status::OK();
 }
 
+static Status CheckRunNotStopped(const bool& terminate_flag, const TimePoint& deadline,
+                                 const logging::Logger& logger) {
+  if (terminate_flag) {
+    LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
+  }
+
+  if (IExecutor::DeadlineExceeded(deadline)) {
+    LOGS(logger, WARNING) << "Exiting due to the run exceeding its deadline.";
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to the run exceeding its deadline.");
+  }
+
+  return Status::OK();
+}
+
+static Status ComputeKernel(const OpKernel& kernel, OpKernelContextInternal& op_kernel_context,
+                            const logging::Logger& logger) {
+  Status compute_status;
+  ORT_TRY {
+#ifdef ENABLE_TRAINING
+    if (kernel.KernelDef().AllocateInputsContiguously()) {
+      ORT_RETURN_IF_ERROR(utils::VerifyInputTensorsAllocatedContiguously(&op_kernel_context));
+    }
+#endif
+
+    compute_status = kernel.Compute(&op_kernel_context);
+  }
+  ORT_CATCH(const std::exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      compute_status = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+    });
+  }
+
+  if (!compute_status.IsOK()) {
+    const auto& node = kernel.Node();
+    std::ostringstream ss;
+    ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
+       << "' Status Message: " << compute_status.ErrorMessage();
+    //If the computation failed, we still can record the memory consumption
+#if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
+    MemoryInfo::MemoryInfoProfile::CreateEvents("dynamic activations_" + std::to_string(MemoryInfo::GetIteration()),
+                                                MemoryInfo::MemoryInfoProfile::GetAndIncreasePid(), MemoryInfo::MapType::DynamicActivation, "", 0);
+#endif
+    const auto msg_string = ss.str();
+    LOGS(logger, ERROR) << msg_string;
+    return Status(compute_status.Category(), compute_status.Code(), msg_string);
+  }
+
+  return Status::OK();
+}
+
 static Status ReleaseNodeMLValues(ExecutionFrame& frame,
                                   const SequentialExecutionPlan& seq_exec_plan,
-                                  const SequentialExecutionPlan::NodeExecutionPlan& node_exec_plan,
+                                  int free_from_index, int free_to_index,
                                   const logging::Logger& logger) {
-  for (auto i = node_exec_plan.free_from_index; i <= node_exec_plan.free_to_index; ++i) {
+  for (auto i = free_from_index; i <= free_to_index; ++i) {
     auto ort_value_idx = seq_exec_plan.to_be_freed[i];
     VLOGS(logger, 1) << "Releasing ort_value with index: " << ort_value_idx;
     ORT_RETURN_IF_ERROR(frame.ReleaseMLValue(ort_value_idx));
@@ -532,4 +585,23 @@ static Status ReleaseNodeMLValues(ExecutionFrame& frame,
 
   return Status::OK();
 }
+
+#ifdef REPLAY_EXECUTION_TRACE
+static Status ReplayExecutionTrace(const SessionState& session_state, const ExecutionTrace& trace,
+                                   ExecutionFrame& frame, const bool& terminate_flag, const TimePoint& deadline,
+                                   const logging::Logger& logger) {
+  const SequentialExecutionPlan& seq_exec_plan = *session_state.GetExecutionPlan();
+
+  for (const auto& step : trace.steps) {
+    ORT_RETURN_IF_ERROR(CheckRunNotStopped(terminate_flag, deadline, logger));
+
+    OpKernelContextInternal op_kernel_context(session_state, frame, *step.kernel, logger, terminate_flag);
+    ORT_RETURN_IF_ERROR(ComputeKernel(*step.kernel, op_kernel_context, logger));
+    ORT_RETURN_IF_ERROR(ReleaseNodeMLValues(frame, seq_exec_plan, step.free_from_index, step.free_to_index,
+                                            logger));
+  }
+
+  return Status::OK();
+}
+#endif
 }  // namespace onnxruntime
@@ -4,12 +4,15 @@
 #include "core/framework/session_state.h"
 
 #include <sstream>
+#include <thread>
 
 #include "core/platform/ort_mutex.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/common/safeint.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
+#include "core/framework/execution_frame.h"
 #include "core/framework/kernel_def_hash_helpers.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
@@ -24,6 +27,14 @@ using namespace ::onnxruntime::common;
 
 namespace onnxruntime {
 
+SessionState::~SessionState() {
+  ClearExecutionFrameStates();
+
+  for (auto& kvp : deleter_for_initialized_tensors_) {
+    kvp.second.f(kvp.second.param);
+  }
+}
+
 void SessionState::SetupAllocators() {
   for (const auto& provider : execution_providers_) {
     for (const auto& allocator : provider->GetAllocators()) {
@@ -636,7 +647,7 @@ Status SessionState::GeneratePatternGroupCache(const gsl::span<const OrtValue>&
     for (int index = node_plan.free_from_index; index <= node_plan.free_to_index; ++index) {
       auto ml_value_idx = exe_plan->to_be_freed[index];
       const auto* ml_type = exe_plan->allocation_plan[ml_value_idx].value_type;
-      if (!ml_type->IsTensorType())
+      if (!ml_type->IsTensorType() || exe_plan->allocation_plan[ml_value_idx].alloc_kind == AllocKind::kReuse)
         continue;
       const auto* ml_data_type = static_cast<const TensorTypeBase*>(ml_type)->GetElementType();
       if (ml_data_type != DataTypeImpl::GetType<std::string>()) {
@@ -652,32 +663,165 @@ Status SessionState::GeneratePatternGroupCache(const gsl::span<const OrtValue>&
 }
 #endif
 
-const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const gsl::span<const OrtValue>& tensor_inputs,
-                                                              const std::vector<int>& feed_mlvalue_idxs,
-                                                              std::unordered_map<int, TensorShape>& inferred_shapes) const {
+const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
+    const gsl::span<const OrtValue>& tensor_inputs,
+    const std::vector<int>& feed_mlvalue_idxs,
+    const std::unordered_map<int, TensorShape>*& inferred_shapes,
+    const ExecutionTrace*& trace) const {
   int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
 
-  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
-  auto it = mem_patterns_.find(key);
-  if (it == mem_patterns_.end()) {
+  const MemoryPatternCache* mem_patterns = mem_patterns_.load(std::memory_order_acquire);
+  if (mem_patterns != nullptr) {
+    auto it = mem_patterns->find(key);
+    if (it != mem_patterns->end()) {
+      inferred_shapes = &it->second->inferred_shapes;
+      trace = it->second->trace.get();
+      return it->second->mem_patterns.get();
+    }
+  }
+
 #ifdef ENABLE_TRAINING
-    auto mem_patterns = std::make_unique<MemoryPatternGroup>();
-    if (GeneratePatternGroupCache(tensor_inputs, feed_mlvalue_idxs, mem_patterns.get(), inferred_shapes).IsOK()) {
-      key = CalculateMemoryPatternsKey(tensor_inputs);
-      auto ptr = mem_patterns.get();
-      mem_patterns_[key] = std::move(mem_patterns);
-      shape_patterns_[key] = inferred_shapes;
-      return ptr;
+  auto generated_patterns = std::make_unique<MemoryPatternGroup>();
+  std::unordered_map<int, TensorShape> generated_shapes;
+  if (!IsMemoryPatternCacheFull() &&
+      GeneratePatternGroupCache(tensor_inputs, feed_mlvalue_idxs, generated_patterns.get(), generated_shapes).IsOK()) {
+    key = CalculateMemoryPatternsKey(tensor_inputs);
+    const auto* entry = AddMemoryPatternGroup(key, std::move(generated_patterns), std::move(generated_shapes));
+    if (entry == nullptr) {
+      return nullptr;
     }
-    return nullptr;
+    inferred_shapes = &entry->inferred_shapes;
+    trace = entry->trace.get();
+    return entry->mem_patterns.get();
+  }
 #else
-    ORT_UNUSED_PARAMETER(feed_mlvalue_idxs);
-    return nullptr;
+  ORT_UNUSED_PARAMETER(feed_mlvalue_idxs);
 #endif
+  return nullptr;
+}
+
+const SessionState::MemoryPatternCacheEntry* SessionState::AddMemoryPatternGroup(
+    int64_t key, std::unique_ptr<MemoryPatternGroup> mem_patterns,
+    std::unordered_map<int, TensorShape> inferred_shapes) const {
+  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+  const MemoryPatternCache* current = mem_patterns_.load(std::memory_order_relaxed);
+  if (current != nullptr) {
+    auto it = current->find(key);
+    if (it != current->end()) {
+      return it->second;
+    }
+  }
+
+  if (mem_pattern_entries_.size() >= kMaxCachedMemoryPatterns) {
+    return nullptr;
+  }
+
+  auto entry = std::make_unique<MemoryPatternCacheEntry>();
+  entry->mem_patterns = std::move(mem_patterns);
+  entry->inferred_shapes = std::move(inferred_shapes);
+  if (enable_graph_replay_) {
+    entry->trace = CreateExecutionTrace(*entry->mem_patterns);
+  }
+  const MemoryPatternCacheEntry* result = entry.get();
+  mem_pattern_entries_.push_back(std::move(entry));
+
+  auto updated = current != nullptr ? std::make_unique<MemoryPatternCache>(*current)
+                                    : std::make_unique<MemoryPatternCache>();
+  updated->emplace(key, result);
+  mem_patterns_.store(updated.get(), std::memory_order_release);
+  mem_pattern_snapshots_.push_back(std::move(updated));
+  return result;
+}
+
+bool SessionState::IsMemoryPatternCacheFull() const {
+  const MemoryPatternCache* mem_patterns = mem_patterns_.load(std::memory_order_acquire);
+  return mem_patterns != nullptr && mem_patterns->size() >= kMaxCachedMemoryPatterns;
+}
+
+std::unique_ptr<ExecutionFrameState> SessionState::AcquireExecutionFrameState() const {
+  const size_t num_slots = num_execution_frame_state_slots_;
+  if (num_slots == 0) {
+    return nullptr;
+  }
+
+  const size_t first_slot = std::hash<std::thread::id>{}(std::this_thread::get_id()) % num_slots;
+  for (size_t i = 0; i < num_slots; ++i) {
+    auto& slot = execution_frame_states_[(first_slot + i) % num_slots];
+    if (slot.load(std::memory_order_relaxed) != nullptr) {
+      ExecutionFrameState* state = slot.exchange(nullptr, std::memory_order_acquire);
+      if (state != nullptr) {
+        return std::unique_ptr<ExecutionFrameState>(state);
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+void SessionState::ReleaseExecutionFrameState(std::unique_ptr<ExecutionFrameState> state) const {
+  const size_t num_slots = num_execution_frame_state_slots_;
+  if (num_slots == 0) {
+    return;
+  }
+
+  const size_t first_slot = std::hash<std::thread::id>{}(std::this_thread::get_id()) % num_slots;
+  for (size_t i = 0; i < num_slots; ++i) {
+    auto& slot = execution_frame_states_[(first_slot + i) % num_slots];
+    ExecutionFrameState* empty = nullptr;
+    if (slot.load(std::memory_order_relaxed) == nullptr &&
+        slot.compare_exchange_strong(empty, state.get(), std::memory_order_release, std::memory_order_relaxed)) {
+      state.release();
+      return;
+    }
+  }
+
+  // all slots are taken, so more runs were concurrent than states are kept. let this one go.
+}
+
+void SessionState::ClearExecutionFrameStates() const {
+  for (auto& slot : execution_frame_states_) {
+    delete slot.exchange(nullptr, std::memory_order_acquire);
+  }
+
+  for (const auto& node_entry : subgraph_session_states_) {
+    for (const auto& subgraph_entry : node_entry.second) {
+      subgraph_entry.second->ClearExecutionFrameStates();
+    }
+  }
+}
+
+bool SessionState::CanReplayExecution() const {
+  // the trace skips the fence handling, so every kernel must run synchronously on the CPU
+  for (const auto& node_plan : p_seq_exec_plan_->execution_plan) {
+    const OpKernel* kernel = GetKernel(node_plan.node_index);
+    if (kernel == nullptr || kernel->Node().GetExecutionProviderType() != kCpuExecutionProvider ||
+        p_seq_exec_plan_->NodeHasFence(node_plan.node_index)) {
+      return false;
+    }
   }
 
-  inferred_shapes = shape_patterns_[key];
-  return it->second.get();
+  return true;
+}
+
+std::unique_ptr<ExecutionTrace> SessionState::CreateExecutionTrace(const MemoryPatternGroup& mem_patterns) const {
+  auto trace = std::make_unique<ExecutionTrace>();
+
+  trace->steps.reserve(p_seq_exec_plan_->execution_plan.size());
+  for (const auto& node_plan : p_seq_exec_plan_->execution_plan) {
+    trace->steps.push_back({GetKernel(node_plan.node_index), node_plan.free_from_index, node_plan.free_to_index});
+  }
+
+  trace->placements.resize(p_seq_exec_plan_->allocation_plan.size());
+  for (size_t i = 0; i < mem_patterns.locations.size(); ++i) {
+    for (const auto& entry : mem_patterns.patterns[i].GetPatternsMap()) {
+      auto& placement = trace->placements[entry.first];
+      placement.location = static_cast<int>(i);
+      placement.offset = entry.second.offset_;
+      placement.size = entry.second.size_;
+    }
+  }
+
+  return trace;
 }
 
 void SessionState::ResolveMemoryPatternFlag() {
@@ -708,11 +852,7 @@ Status SessionState::UpdateMemoryPatternGroupCache(const gsl::span<const OrtValu
                                                    std::unique_ptr<MemoryPatternGroup> mem_patterns) const {
   int64_t key = CalculateMemoryPatternsKey(tensor_inputs);
 
-  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
-  auto it = mem_patterns_.find(key);
-  if (it == mem_patterns_.end()) {
-    mem_patterns_[key] = std::move(mem_patterns);
-  }
+  AddMemoryPatternGroup(key, std::move(mem_patterns), {});
 
   return Status::OK();
 }
@@ -1444,6 +1584,24 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
   ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager));
 
+  if (enable_mem_pattern_ &&
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigEnableCpuGraphReplay, "0") == "1") {
+    enable_graph_replay_ = CanReplayExecution();
+    if (!enable_graph_replay_) {
+      LOGS(logger_, INFO) << "CPU graph replay is disabled as not every node runs on the CPU execution provider.";
+    }
+  }
+
+  const std::string max_kept_frame_states = session_options.config_options.GetConfigOrDefault(
+      kOrtSessionOptionsConfigMaxKeptExecutionFrameStates, std::to_string(kExecutionFrameStateSlots));
+  size_t num_slots = 0;
+  if (!TryParseStringWithClassicLocale(max_kept_frame_states, num_slots) || num_slots > kExecutionFrameStateSlots) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ",
+                           kOrtSessionOptionsConfigMaxKeptExecutionFrameStates, ": '", max_kept_frame_states,
+                           "'. Expected a number from 0 to ", kExecutionFrameStateSlots, ".");
+  }
+  num_execution_frame_state_slots_ = num_slots;
+
 #ifndef ENABLE_TRAINING
   const auto disable_prepacking =
       session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0");
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <map>
 #include <unordered_map>
@@ -18,6 +20,7 @@
 #include "core/framework/callback.h"
 #include "core/framework/data_transfer_manager.h"
 #include "core/framework/execution_providers.h"
+#include "core/framework/execution_trace.h"
 #include "core/framework/feeds_fetches_manager.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/prepacked_weights_container.h"
@@ -55,6 +58,7 @@ class OpKernel;
 class NodeIndexInfo;
 struct SequentialExecutionPlan;
 struct MemoryPatternGroup;
+struct ExecutionFrameState;
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 class MemoryInfo;
 #endif
@@ -109,11 +113,7 @@ class SessionState {
     SetupAllocators();
   }
 
-  ~SessionState() {
-    for (auto& kvp : deleter_for_initialized_tensors_) {
-      kvp.second.f(kvp.second.param);
-    }
-  }
+  ~SessionState();
 
   // Graph viewer. CreateGraphInfo must have been called previously.
   const GraphViewer& GetGraphViewer() const noexcept { return *graph_viewer_.get(); };
@@ -206,11 +206,20 @@ class SessionState {
   /**
   Get cached memory pattern based on input shapes
   Must be called only when all values contain tensors
+  inferred_shapes and trace are set to the shapes and the ExecutionTrace cached with the pattern, which live as long
+  as the SessionState. trace is nullptr unless CPU graph replay is enabled.
   */
   const MemoryPatternGroup* GetMemoryPatternGroup(
       const gsl::span<const OrtValue>& tensor_inputs,
       const std::vector<int>& feed_mlvalue_idxs,
-      std::unordered_map<int, TensorShape>& inferred_shapes) const;
+      const std::unordered_map<int, TensorShape>*& inferred_shapes,
+      const ExecutionTrace*& trace) const;
+
+  /**
+  Returns true once memory patterns are cached for as many input shapes as the cache holds.
+  Runs with other input shapes then gain nothing from generating patterns.
+  */
+  bool IsMemoryPatternCacheFull() const;
 
   /**
   Set generated memory pattern with a given input shapes.
@@ -220,6 +229,35 @@ class SessionState {
   Status UpdateMemoryPatternGroupCache(const gsl::span<const OrtValue>& tensor_inputs,
                                        std::unique_ptr<MemoryPatternGroup> mem_patterns) const;
 
+  /**
+  Count a run that replayed an ExecutionTrace instead of walking the execution plan.
+  Only runs of sessions with CPU graph replay enabled are counted.
+  */
+  void RecordExecutionTraceReplay() const {
+    num_execution_trace_replays_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t GetNumExecutionTraceReplays() const {
+    return num_execution_trace_replays_.load(std::memory_order_relaxed);
+  }
+
+  /**
+  Take the state an earlier ExecutionFrame left for reuse, or nullptr if there is none.
+  Thread-safe and lock-free.
+  */
+  std::unique_ptr<ExecutionFrameState> AcquireExecutionFrameState() const;
+
+  /**
+  Keep the state of a destroyed ExecutionFrame for a later one, or free it if enough states are kept already.
+  Thread-safe and lock-free.
+  */
+  void ReleaseExecutionFrameState(std::unique_ptr<ExecutionFrameState> state) const;
+
+  /**
+  Free the kept ExecutionFrame states of this SessionState and its subgraphs, e.g. before shrinking the arenas.
+  */
+  void ClearExecutionFrameStates() const;
+
   bool GetUseDeterministicCompute() const { return use_deterministic_compute_; }
 
   /**
@@ -381,6 +419,23 @@ class SessionState {
                                   const std::unordered_map<OrtValueName, OrtMemoryInfo>& outer_scope_node_arg_to_location_map = {},
                                   bool graph_info_already_created = false);
 
+  struct MemoryPatternCacheEntry {
+    std::unique_ptr<MemoryPatternGroup> mem_patterns;
+    std::unordered_map<int, TensorShape> inferred_shapes;
+    std::unique_ptr<ExecutionTrace> trace;
+  };
+
+  // Returns true if every node of the execution plan can be replayed from an ExecutionTrace.
+  bool CanReplayExecution() const;
+
+  // Records the ExecutionTrace of runs that use mem_patterns.
+  std::unique_ptr<ExecutionTrace> CreateExecutionTrace(const MemoryPatternGroup& mem_patterns) const;
+
+  // Adds mem_patterns to the cache unless another run added patterns for the same key first.
+  // Returns the cached entry, or nullptr if the cache is full.
+  const MemoryPatternCacheEntry* AddMemoryPatternGroup(int64_t key, std::unique_ptr<MemoryPatternGroup> mem_patterns,
+                                                       std::unordered_map<int, TensorShape> inferred_shapes) const;
+
 #ifdef ENABLE_TRAINING
   Status GeneratePatternGroupCache(
       const gsl::span<const OrtValue>& inputs,
@@ -472,12 +527,37 @@ class SessionState {
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
-  // lock for the mem_patterns_
-  mutable OrtMutex mem_patterns_lock_;
+  // record an ExecutionTrace with each cached memory pattern. see kOrtSessionOptionsConfigEnableCpuGraphReplay.
+  bool enable_graph_replay_ = false;
+
+  // runs that replayed an ExecutionTrace
+  mutable std::atomic<uint64_t> num_execution_trace_replays_{0};
+
+  using MemoryPatternCache = std::map<int64_t, const MemoryPatternCacheEntry*>;
 
   // cache for the generated mem_patterns. key is calculated based on input shapes.
-  mutable std::map<int64_t, std::unique_ptr<MemoryPatternGroup>> mem_patterns_;
-  mutable std::map<int64_t, std::unordered_map<int, TensorShape>> shape_patterns_;
+  // Runs look up the current snapshot without locking. Adding patterns copies the snapshot under
+  // mem_patterns_lock_ and publishes the copy, so once every input shape was seen Run() takes no lock here.
+  mutable std::atomic<const MemoryPatternCache*> mem_patterns_{nullptr};
+
+  // lock for adding to mem_patterns_
+  mutable OrtMutex mem_patterns_lock_;
+
+  // the cached entries, and every published snapshot. runs may still read a superseded snapshot, so they are all
+  // kept until the session is destroyed. as snapshot i holds i entries, at most kMaxCachedMemoryPatterns input
+  // shapes are cached; runs with other shapes allocate without memory patterns.
+  static constexpr size_t kMaxCachedMemoryPatterns = 128;
+  mutable std::vector<std::unique_ptr<const MemoryPatternCacheEntry>> mem_pattern_entries_;
+  mutable std::vector<std::unique_ptr<const MemoryPatternCache>> mem_pattern_snapshots_;
+
+  // states of destroyed ExecutionFrames, for reuse by later runs. a run takes the state from the first non-empty
+  // slot, starting at a slot picked by its thread, so a thread running repeatedly tends to get its own state back.
+  // there are as many states as runs were concurrent, up to the number of slots in use. each state holds the
+  // memory pattern buffers of its last run, so the slots in use are limited by
+  // kOrtSessionOptionsConfigMaxKeptExecutionFrameStates.
+  static constexpr size_t kExecutionFrameStateSlots = 16;
+  mutable std::array<std::atomic<ExecutionFrameState*>, kExecutionFrameStateSlots> execution_frame_states_{};
+  size_t num_execution_frame_state_slots_ = kExecutionFrameStateSlots;
 
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
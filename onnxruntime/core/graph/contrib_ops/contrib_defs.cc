@@ -522,6 +522,98 @@ ONNX_MS_OPERATOR_SET_SCHEMA(BiasGelu, 1,
                                     "Constrain input and output types to float tensors.")
                                 .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
 
+constexpr const char* ReduceMeanSubPow_ver1_doc =
+    R"DOC(Fused ReduceMean, Sub and Pow as found in unfused layer normalization subgraphs.
+The mean of X is taken over the dimensions from axis to the last one and subtracted from X,
+giving the centered output. The squared output holds the squares of the centered values.)DOC";
+ONNX_MS_OPERATOR_SET_SCHEMA(ReduceMeanSubPow, 1,
+                            OpSchema()
+                                .SetDomain(kMSDomain)
+                                .SinceVersion(1)
+                                .SetDoc(ReduceMeanSubPow_ver1_doc)
+                                .Attr("axis",
+                                      "The first dimension the mean is taken over. Negative value means counting "
+                                      "dimensions from the back.",
+                                      AttributeProto::INT, static_cast<int64_t>(-1))
+                                .Input(0, "X", "The input data.", "T")
+                                .Output(0, "centered", "X minus its mean.", "T")
+                                .Output(1, "squared", "The square of the centered output.", "T")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(float)"},
+                                    "Constrain input and output types to float tensors.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 1);
+                                  if (hasInputShape(ctx, 0)) {
+                                    propagateShapeFromInputToOutput(ctx, 0, 0);
+                                    propagateShapeFromInputToOutput(ctx, 0, 1);
+                                  }
+                                }));
+
+constexpr const char* ImagePreprocess_ver1_doc =
+    R"DOC(Converts a batch of channels-last images to a normalized float tensor in NCHW layout in one pass.
+Each channel c of the input is scaled and shifted as scale[c] * X + bias[c], which covers casting to float,
+subtracting a per channel mean and dividing by a per channel standard deviation. When output_height and
+output_width are set, the images are also resized with bilinear interpolation using the half_pixel coordinate
+transformation of Resize.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(ImagePreprocess, 1,
+                            OpSchema()
+                                .SetDomain(kMSDomain)
+                                .SinceVersion(1)
+                                .SetDoc(ImagePreprocess_ver1_doc)
+                                .Attr("scale",
+                                      "The multiplier of each channel. Defaults to 1 for all channels.",
+                                      AttributeProto::FLOATS,
+                                      OPTIONAL_VALUE)
+                                .Attr("bias",
+                                      "The value added to each channel after scaling. Defaults to 0 for all channels.",
+                                      AttributeProto::FLOATS,
+                                      OPTIONAL_VALUE)
+                                .Attr("output_height",
+                                      "The height of the resized images. 0 (default) keeps the input height.",
+                                      AttributeProto::INT, static_cast<int64_t>(0))
+                                .Attr("output_width",
+                                      "The width of the resized images. 0 (default) keeps the input width.",
+                                      AttributeProto::INT, static_cast<int64_t>(0))
+                                .Input(0, "X", "The images, of shape (N, H, W, C).", "T")
+                                .Output(0, "Y", "The normalized images, of shape (N, C, output_height, output_width).",
+                                        "tensor(float)")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(uint8)", "tensor(float)"},
+                                    "Constrain the images to uint8 or float tensors.")
+                                .TypeAndShapeInferenceFunction([](InferenceContext& ctx) {
+                                  updateOutputElemType(ctx, 0, TensorProto::FLOAT);
+                                  if (!hasInputShape(ctx, 0)) {
+                                    return;
+                                  }
+
+                                  auto& input_shape = getInputShape(ctx, 0);
+                                  if (input_shape.dim_size() != 4) {
+                                    fail_shape_inference("X must be 4-D");
+                                  }
+
+                                  const int64_t output_height = getAttribute(ctx, "output_height", 0);
+                                  const int64_t output_width = getAttribute(ctx, "output_width", 0);
+
+                                  TensorShapeProto output_shape;
+                                  *output_shape.add_dim() = input_shape.dim(0);
+                                  *output_shape.add_dim() = input_shape.dim(3);
+                                  if (output_height > 0) {
+                                    output_shape.add_dim()->set_dim_value(output_height);
+                                  } else {
+                                    *output_shape.add_dim() = input_shape.dim(1);
+                                  }
+                                  if (output_width > 0) {
+                                    output_shape.add_dim()->set_dim_value(output_width);
+                                  } else {
+                                    *output_shape.add_dim() = input_shape.dim(2);
+                                  }
+                                  updateOutputShape(ctx, 0, output_shape);
+                                }));
+
 // Used to be ONNX 1.7 Inverse(12)
 // Comment out docs not to increase the binary size
 //
@@ -652,6 +744,108 @@ ONNX_MS_OPERATOR_SET_SCHEMA(TorchEmbedding, 1,
                                   updateOutputShape(ctx, 0, outputs_shape);
                                 }));
 
+constexpr const char* EmbeddingBag_ver1_doc = R"DOC(
+      Based on Torch operator EmbeddingBag, looks up bags of rows of an embedding table and reduces each bag
+      to a single row with a sum or a mean, without materializing the gathered rows.
+      The bags are either the rows of a 2-D indices tensor, or given by the start positions in 'offsets' into a
+      1-D indices tensor. Each looked up row can be scaled by a weight in 'per_sample_weights' (sum mode only).
+      The table can be stored in float16 or in 8-bit with a per-row scale and optional zero point, in which case
+      the rows are dequantized as they are accumulated: row * scale or (row - zero_point) * scale.
+      )DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(EmbeddingBag, 1,
+                            OpSchema()
+                                .SetDoc(EmbeddingBag_ver1_doc)
+                                .Attr("mode",
+                                      "How the rows of a bag are reduced: `sum` (default) or `mean`.",
+                                      AttributeProto::STRING,
+                                      std::string("sum"))
+                                .Input(
+                                    0,
+                                    "weight",
+                                    "The embedding table of size N x M. 'N' is the number of embeddings and 'M' is the "
+                                    "embedding size.",
+                                    "T")
+                                .Input(
+                                    1,
+                                    "indices",
+                                    "Indices of the rows to look up. A 2-D tensor of shape B x L holding B bags of L rows, "
+                                    "or a 1-D tensor holding all the bags back to back when 'offsets' is given.",
+                                    "Tind")
+                                .Input(
+                                    2,
+                                    "offsets",
+                                    "1-D tensor of size B with the position in 'indices' where each bag starts.",
+                                    "Tind",
+                                    OpSchema::Optional)
+                                .Input(
+                                    3,
+                                    "per_sample_weights",
+                                    "Weights of the looked up rows, of the same shape as 'indices'.",
+                                    "tensor(float)",
+                                    OpSchema::Optional)
+                                .Input(
+                                    4,
+                                    "scale",
+                                    "1-D tensor of size N with the dequantization scale of each row. Required for 8-bit tables.",
+                                    "tensor(float)",
+                                    OpSchema::Optional)
+                                .Input(
+                                    5,
+                                    "zero_point",
+                                    "1-D tensor of size N with the zero point of each row of an 8-bit table. Defaults to 0.",
+                                    "T",
+                                    OpSchema::Optional)
+                                .Output(
+                                    0,
+                                    "output",
+                                    "The reduced bags, of size B x M.",
+                                    "tensor(float)")
+                                .TypeConstraint(
+                                    "T",
+                                    {"tensor(float)", "tensor(float16)", "tensor(int8)", "tensor(uint8)"},
+                                    "Constrain the embedding table to float, float16 or 8-bit tensors.")
+                                .TypeConstraint(
+                                    "Tind",
+                                    {"tensor(int32)", "tensor(int64)"},
+                                    "Constrain indices and offsets to integer tensors.")
+                                .TypeAndShapeInferenceFunction([](InferenceContext& ctx) {
+                                  updateOutputElemType(ctx, 0, TensorProto::FLOAT);
+
+                                  const bool has_offsets = ctx.getNumInputs() > 2 && ctx.getInputType(2) != nullptr;
+                                  TensorShapeProto output_shape;
+                                  if (has_offsets) {
+                                    if (!hasInputShape(ctx, 2)) {
+                                      return;
+                                    }
+                                    auto& offsets_shape = getInputShape(ctx, 2);
+                                    if (offsets_shape.dim_size() != 1) {
+                                      fail_shape_inference("offsets must be 1-D");
+                                    }
+                                    *output_shape.add_dim() = offsets_shape.dim(0);
+                                  } else {
+                                    if (!hasInputShape(ctx, 1)) {
+                                      return;
+                                    }
+                                    auto& indices_shape = getInputShape(ctx, 1);
+                                    if (indices_shape.dim_size() != 2) {
+                                      fail_shape_inference("indices must be 2-D when offsets is not given");
+                                    }
+                                    *output_shape.add_dim() = indices_shape.dim(0);
+                                  }
+
+                                  if (hasInputShape(ctx, 0)) {
+                                    auto& weight_shape = getInputShape(ctx, 0);
+                                    if (weight_shape.dim_size() != 2) {
+                                      fail_shape_inference("weight must be 2-D");
+                                    }
+                                    *output_shape.add_dim() = weight_shape.dim(1);
+                                  } else {
+                                    output_shape.add_dim();
+                                  }
+                                  updateOutputShape(ctx, 0, output_shape);
+                                }));
+
 constexpr const char* Trilu_ver1_doc = R"DOC(
       Returns the upper or lower triangular part of a 2-D matrix, or batches of 2-D matrices. If the attribute "upper" is set to true,
       the upper triangular matrix is retained. Lower triangular matrix is retained otherwise. Default value for upper is true.
@@ -354,6 +354,54 @@ ONNX_MS_OPERATOR_SET_SCHEMA(QLinearConv, 1,
                                     onnxruntime::contrib::convPoolShapeInferenceNhwc(ctx, true, false, 0, 3);
                                   }
                                 }));
+
+ONNX_MS_OPERATOR_SET_SCHEMA(RoiAlign, 1,
+                            OpSchema()
+                                .SetDoc("RoiAlign with an additional channels_last attribute. If set, X is "
+                                        "(N x H x W x C) and Y is (num_rois x output_height x output_width x C).")
+                                .Input(0, "X", "", "T1")
+                                .Input(1, "rois", "", "T1")
+                                .Input(2, "batch_indices", "", "T2")
+                                .Output(0, "Y", "", "T1")
+                                .TypeConstraint("T1", {"tensor(float)"}, "")
+                                .TypeConstraint("T2", {"tensor(int64)"}, "")
+                                .Attr("coordinate_transformation_mode", "", AttributeProto::STRING,
+                                      std::string("output_half_pixel"))
+                                .Attr("mode", "", AttributeProto::STRING, std::string("avg"))
+                                .Attr("output_height", "", AttributeProto::INT, static_cast<int64_t>(1))
+                                .Attr("output_width", "", AttributeProto::INT, static_cast<int64_t>(1))
+                                .Attr("sampling_ratio", "", AttributeProto::INT, static_cast<int64_t>(0))
+                                .Attr("spatial_scale", "", AttributeProto::FLOAT, 1.f)
+                                .Attr("channels_last", "", AttributeProto::INT, static_cast<int64_t>(0))
+                                .TypeAndShapeInferenceFunction([](InferenceContext& ctx) {
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+
+                                  if (!hasNInputShapes(ctx, 3)) {
+                                    return;
+                                  }
+
+                                  const auto& input_shape = getInputShape(ctx, 0);
+                                  const auto& batch_indices_shape = getInputShape(ctx, 2);
+                                  if (input_shape.dim_size() != 4) {
+                                    fail_shape_inference("first input tensor has wrong dimension");
+                                  }
+                                  if (batch_indices_shape.dim_size() != 1) {
+                                    fail_shape_inference("third input tensor has wrong dimension");
+                                  }
+
+                                  const int64_t channels_last = getAttribute(ctx, "channels_last", 0);
+                                  TensorShapeProto_Dimension num_rois = batch_indices_shape.dim(0);
+                                  TensorShapeProto_Dimension channels = input_shape.dim(channels_last ? 3 : 1);
+                                  TensorShapeProto_Dimension output_height, output_width;
+                                  output_height.set_dim_value(getAttribute(ctx, "output_height", 1));
+                                  output_width.set_dim_value(getAttribute(ctx, "output_width", 1));
+
+                                  if (channels_last) {
+                                    updateOutputShape(ctx, 0, {num_rois, output_height, output_width, channels});
+                                  } else {
+                                    updateOutputShape(ctx, 0, {num_rois, channels, output_height, output_width});
+                                  }
+                                }));
 std::function<void(OpSchema&)> ConvOpSchemaGenerator() {
   return [=](OpSchema& schema) {
     schema.Input(
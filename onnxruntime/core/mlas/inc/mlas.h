@@ -710,6 +710,55 @@ MlasSymmQgemmPackB(
     void* PackedB
     );
 
+//
+// Sparse matrix/matrix multiply routines.
+//
+// The B matrix is packed once into a compressed sparse column format, i.e.
+// the compressed sparse rows of the transposed B, where only its non-zero
+// elements are kept. Rows of A are processed in blocks of MLAS_SPARSE_GEMM_ROW_BLOCK,
+// so the multiply costs a fraction of the dense GEMM proportional to the
+// density of B.
+//
+
+#define MLAS_SPARSE_GEMM_ROW_BLOCK 8
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    );
+
+void
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    );
+
+void
+MLASCALL
+MlasSparseGemm(
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Convolution routines.
 //
@@ -939,6 +988,42 @@ MlasComputeTanh(
     size_t N
     );
 
+//
+// Reduction routines.
+//
+
+enum MLAS_REDUCE_KIND {
+    MlasReduceSum,
+    MlasReduceSumSquare,
+    MlasReduceMaximum,
+    MlasReduceMinimum,
+    MlasReduceLogSumExp,
+};
+
+void
+MLASCALL
+MlasReduceRows(
+    MLAS_REDUCE_KIND ReduceKind,
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput,
+    bool Accumulate
+    );
+
+void
+MLASCALL
+MlasReduceColumns(
+    MLAS_REDUCE_KIND ReduceKind,
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput,
+    bool Accumulate
+    );
+
 //
 // Half-precision floating-point routines.
 //
@@ -952,6 +1037,60 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+//
+// Brain floating-point (bfloat16) routines.
+//
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloatBuffer(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    );
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16Buffer(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    );
+
+//
+// Integer conversion routines.
+//
+
+void
+MLASCALL
+MlasConvertInt32ToFloatBuffer(
+    const int32_t* Source,
+    float* Destination,
+    size_t Count
+    );
+
+/**
+ * @brief Convert floats to integers, truncating towards zero and saturating
+ *        to the range of OutputType. NaN converts to the minimum value.
+ *        Supported output types: int8_t, uint8_t, int32_t.
+ */
+template<typename OutputType>
+void
+MLASCALL
+MlasConvertFloatToIntegerBuffer(
+    const float* Source,
+    OutputType* Destination,
+    size_t Count
+    );
+
 //
 // Transpose routines.
 //
@@ -974,6 +1113,15 @@ MlasTranspose(
     size_t N
     );
 
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N
+    );
+
 void
 MLASCALL
 MlasTranspose(
@@ -992,6 +1140,45 @@ MlasTranspose(
     size_t N
     );
 
+//
+// Strided variants of the transpose routines. The input and output matrices
+// may be sub-matrices of larger buffers: InputStride and OutputStride supply
+// the number of elements between consecutive rows.
+//
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    size_t InputStride,
+    uint8_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    );
+
 //
 // Buffer reordering routines.
 //
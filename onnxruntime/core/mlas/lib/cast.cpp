@@ -0,0 +1,721 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cast.cpp
+
+Abstract:
+
+    This module implements routines to convert buffers between the single
+    precision floating point format and the half precision, brain floating
+    point and integer formats.
+
+    Conversions to the half precision and brain floating point formats round
+    to nearest even. Conversions from floating point to integer truncate
+    towards zero and saturate to the range of the output type.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Scalar conversion helpers. These are also used to process the elements that
+// remain after the vectorized loops and produce bit identical results.
+//
+
+MLAS_FORCEINLINE
+unsigned short
+MlasConvertFloatToHalfScalar(
+    float Value
+    )
+{
+    uint32_t Bits = MlasBitsOfFp32(Value);
+    const uint32_t Sign = Bits & 0x80000000;
+    Bits ^= Sign;
+
+    unsigned short Half;
+
+    if (Bits >= 0x47800000) {
+
+        //
+        // The value is at least 65536.0f: overflow to infinity, or propagate
+        // infinity and NaN (as a quiet NaN).
+        //
+
+        Half = (Bits > 0x7F800000) ? 0x7E00 : 0x7C00;
+
+    } else if (Bits < 0x38800000) {
+
+        //
+        // The value is below the smallest normal half (2^-14). Adding 0.5f
+        // aligns the value to the half denormal grid and lets the hardware
+        // round it to nearest even.
+        //
+
+        Half = (unsigned short)(MlasBitsOfFp32(MlasFp32FromBits(Bits) + 0.5f) - 0x3F000000);
+
+    } else {
+
+        //
+        // Rebias the exponent and round the mantissa to nearest even.
+        //
+
+        const uint32_t MantissaOdd = (Bits >> 13) & 1;
+        Bits += 0xC8000FFF;
+        Bits += MantissaOdd;
+        Half = (unsigned short)(Bits >> 13);
+    }
+
+    return (unsigned short)(Half | (Sign >> 16));
+}
+
+MLAS_FORCEINLINE
+float
+MlasConvertHalfToFloatScalar(
+    unsigned short Half
+    )
+{
+    const uint32_t Sign = uint32_t(Half & 0x8000) << 16;
+    uint32_t Bits = uint32_t(Half & 0x7FFF) << 13;
+    const uint32_t Exponent = Bits & 0x0F800000;
+
+    Bits += 0x38000000;
+
+    if (Exponent == 0x0F800000) {
+
+        //
+        // Infinity or NaN: extend the exponent to all ones.
+        //
+
+        Bits += 0x38000000;
+
+    } else if (Exponent == 0) {
+
+        //
+        // Zero or denormal: renormalize using the float unit.
+        //
+
+        Bits = MlasBitsOfFp32(MlasFp32FromBits(Bits + 0x00800000) - MlasFp32FromBits(0x38800000));
+    }
+
+    return MlasFp32FromBits(Bits | Sign);
+}
+
+MLAS_FORCEINLINE
+uint16_t
+MlasConvertFloatToBFloat16Scalar(
+    float Value
+    )
+{
+    uint32_t Bits = MlasBitsOfFp32(Value);
+
+    if ((Bits & 0x7FFFFFFF) > 0x7F800000) {
+        // Keep the sign and the upper payload bits, but make the NaN quiet.
+        return uint16_t((Bits >> 16) | 0x0040);
+    }
+
+    Bits += 0x7FFF + ((Bits >> 16) & 1);
+    return uint16_t(Bits >> 16);
+}
+
+MLAS_FORCEINLINE
+float
+MlasConvertBFloat16ToFloatScalar(
+    uint16_t Value
+    )
+{
+    return MlasFp32FromBits(uint32_t(Value) << 16);
+}
+
+//
+// Saturation range for conversions from float to an integer type. The maximum
+// is exclusive for int32_t as float(INT32_MAX) rounds up to 2^31.
+//
+
+template<typename OutputType>
+struct MLAS_FLOAT_TO_INTEGER_RANGE {
+    static constexpr float Minimum = float(std::numeric_limits<OutputType>::lowest());
+    static constexpr float Maximum = float(std::numeric_limits<OutputType>::max());
+};
+
+template<typename OutputType>
+MLAS_FORCEINLINE
+OutputType
+MlasConvertFloatToIntegerScalar(
+    float Value
+    )
+{
+    // N.B. The comparisons are ordered so that a NaN converts to the minimum
+    // value, which matches the vector implementations.
+    if (!(Value >= MLAS_FLOAT_TO_INTEGER_RANGE<OutputType>::Minimum)) {
+        return std::numeric_limits<OutputType>::lowest();
+    }
+    if (Value >= MLAS_FLOAT_TO_INTEGER_RANGE<OutputType>::Maximum) {
+        return std::numeric_limits<OutputType>::max();
+    }
+
+    return OutputType(int32_t(Value));
+}
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+MLAS_FORCEINLINE
+__m128i
+MlasSelectInt32x4(
+    __m128i Mask,
+    __m128i TrueVector,
+    __m128i FalseVector
+    )
+{
+    return _mm_or_si128(_mm_and_si128(Mask, TrueVector), _mm_andnot_si128(Mask, FalseVector));
+}
+
+MLAS_FORCEINLINE
+__m128i
+MlasPackLowWordsInt32x4(
+    __m128i Vector0,
+    __m128i Vector1
+    )
+{
+    //
+    // Sign extend the low word of each element so that the saturating pack
+    // keeps the low word unchanged (SSE2 has no unsigned 32-bit pack).
+    //
+
+    Vector0 = _mm_srai_epi32(_mm_slli_epi32(Vector0, 16), 16);
+    Vector1 = _mm_srai_epi32(_mm_slli_epi32(Vector1, 16), 16);
+
+    return _mm_packs_epi32(Vector0, Vector1);
+}
+
+MLAS_FORCEINLINE
+__m128i
+MlasConvertFloatToHalfVector(
+    __m128 FloatVector
+    )
+{
+    __m128i Bits = _mm_castps_si128(FloatVector);
+    const __m128i Sign = _mm_and_si128(Bits, _mm_set1_epi32(int32_t(0x80000000)));
+    Bits = _mm_xor_si128(Bits, Sign);
+
+    __m128i MantissaOdd = _mm_and_si128(_mm_srli_epi32(Bits, 13), _mm_set1_epi32(1));
+    __m128i Normal = _mm_add_epi32(Bits, _mm_set1_epi32(int32_t(0xC8000FFF)));
+    Normal = _mm_srli_epi32(_mm_add_epi32(Normal, MantissaOdd), 13);
+
+    __m128 DenormalFloat = _mm_add_ps(_mm_castsi128_ps(Bits), _mm_set1_ps(0.5f));
+    __m128i Denormal = _mm_sub_epi32(_mm_castps_si128(DenormalFloat), _mm_set1_epi32(0x3F000000));
+
+    __m128i IsNaN = _mm_cmpgt_epi32(Bits, _mm_set1_epi32(0x7F800000));
+    __m128i InfinityOrNaN = _mm_or_si128(_mm_set1_epi32(0x7C00), _mm_and_si128(IsNaN, _mm_set1_epi32(0x0200)));
+
+    __m128i IsDenormal = _mm_cmplt_epi32(Bits, _mm_set1_epi32(0x38800000));
+    __m128i IsOverflow = _mm_cmpgt_epi32(Bits, _mm_set1_epi32(0x47800000 - 1));
+
+    __m128i Half = MlasSelectInt32x4(IsDenormal, Denormal, Normal);
+    Half = MlasSelectInt32x4(IsOverflow, InfinityOrNaN, Half);
+
+    return _mm_or_si128(Half, _mm_srli_epi32(Sign, 16));
+}
+
+MLAS_FORCEINLINE
+__m128
+MlasConvertHalfToFloatVector(
+    __m128i HalfVector
+    )
+{
+    const __m128i Sign = _mm_slli_epi32(_mm_and_si128(HalfVector, _mm_set1_epi32(0x8000)), 16);
+    __m128i Bits = _mm_slli_epi32(_mm_and_si128(HalfVector, _mm_set1_epi32(0x7FFF)), 13);
+    const __m128i Exponent = _mm_and_si128(Bits, _mm_set1_epi32(0x0F800000));
+
+    Bits = _mm_add_epi32(Bits, _mm_set1_epi32(0x38000000));
+
+    __m128i IsInfinityOrNaN = _mm_cmpeq_epi32(Exponent, _mm_set1_epi32(0x0F800000));
+    Bits = _mm_add_epi32(Bits, _mm_and_si128(IsInfinityOrNaN, _mm_set1_epi32(0x38000000)));
+
+    __m128i IsDenormal = _mm_cmpeq_epi32(Exponent, _mm_setzero_si128());
+    __m128 DenormalFloat = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(Bits, _mm_set1_epi32(0x00800000))),
+        _mm_castsi128_ps(_mm_set1_epi32(0x38800000)));
+    Bits = MlasSelectInt32x4(IsDenormal, _mm_castps_si128(DenormalFloat), Bits);
+
+    return _mm_castsi128_ps(_mm_or_si128(Bits, Sign));
+}
+
+MLAS_FORCEINLINE
+__m128i
+MlasConvertFloatToBFloat16Vector(
+    __m128 FloatVector
+    )
+{
+    __m128i Bits = _mm_castps_si128(FloatVector);
+
+    __m128i RoundingBias = _mm_and_si128(_mm_srli_epi32(Bits, 16), _mm_set1_epi32(1));
+    RoundingBias = _mm_add_epi32(RoundingBias, _mm_set1_epi32(0x7FFF));
+    __m128i Rounded = _mm_srli_epi32(_mm_add_epi32(Bits, RoundingBias), 16);
+
+    __m128i IsNaN = _mm_cmpgt_epi32(_mm_and_si128(Bits, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+    __m128i QuietNaN = _mm_or_si128(_mm_srli_epi32(Bits, 16), _mm_set1_epi32(0x0040));
+
+    return MlasSelectInt32x4(IsNaN, QuietNaN, Rounded);
+}
+
+#elif defined(MLAS_NEON64_INTRINSICS)
+
+MLAS_FORCEINLINE
+uint32x4_t
+MlasConvertFloatToBFloat16Vector(
+    float32x4_t FloatVector
+    )
+{
+    uint32x4_t Bits = vreinterpretq_u32_f32(FloatVector);
+
+    uint32x4_t RoundingBias = vandq_u32(vshrq_n_u32(Bits, 16), vdupq_n_u32(1));
+    RoundingBias = vaddq_u32(RoundingBias, vdupq_n_u32(0x7FFF));
+    uint32x4_t Rounded = vshrq_n_u32(vaddq_u32(Bits, RoundingBias), 16);
+
+    uint32x4_t IsNaN = vcgtq_u32(vandq_u32(Bits, vdupq_n_u32(0x7FFFFFFF)), vdupq_n_u32(0x7F800000));
+    uint32x4_t QuietNaN = vorrq_u32(vshrq_n_u32(Bits, 16), vdupq_n_u32(0x0040));
+
+    return vbslq_u32(IsNaN, QuietNaN, Rounded);
+}
+
+#endif
+
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer from single precision floating
+    point to half precision floating point, rounding to nearest even.
+
+Arguments:
+
+    Source - Supplies the source buffer.
+
+    Destination - Supplies the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    while (Count >= 8) {
+
+        __m128i Half0 = MlasConvertFloatToHalfVector(_mm_loadu_ps(Source));
+        __m128i Half1 = MlasConvertFloatToHalfVector(_mm_loadu_ps(Source + 4));
+
+        _mm_storeu_si128((__m128i*)Destination, MlasPackLowWordsInt32x4(Half0, Half1));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#elif defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 4) {
+
+        float16x4_t HalfVector = vcvt_f16_f32(vld1q_f32(Source));
+        vst1_u16(Destination, vreinterpret_u16_f16(HalfVector));
+
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasConvertFloatToHalfScalar(Source[n]);
+    }
+}
+
+#if !defined(_M_AMD64) || defined(_M_ARM64EC)
+
+//
+// Windows x64 builds implement this routine in assembly (cvtfp16a.asm).
+//
+
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer from half precision floating point
+    to single precision floating point.
+
+Arguments:
+
+    Source - Supplies the source buffer.
+
+    Destination - Supplies the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    while (Count >= 8) {
+
+        __m128i HalfVector = _mm_loadu_si128((const __m128i*)Source);
+
+        _mm_storeu_ps(Destination, MlasConvertHalfToFloatVector(_mm_unpacklo_epi16(HalfVector, _mm_setzero_si128())));
+        _mm_storeu_ps(Destination + 4, MlasConvertHalfToFloatVector(_mm_unpackhi_epi16(HalfVector, _mm_setzero_si128())));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#elif defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 4) {
+
+        float16x4_t HalfVector = vreinterpret_f16_u16(vld1_u16(Source));
+        vst1q_f32(Destination, vcvt_f32_f16(HalfVector));
+
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasConvertHalfToFloatScalar(Source[n]);
+    }
+}
+
+#endif
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16Buffer(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer from single precision floating
+    point to brain floating point (bfloat16), rounding to nearest even. NaN
+    values are converted to quiet NaN values.
+
+Arguments:
+
+    Source - Supplies the source buffer.
+
+    Destination - Supplies the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    while (Count >= 8) {
+
+        __m128i Value0 = MlasConvertFloatToBFloat16Vector(_mm_loadu_ps(Source));
+        __m128i Value1 = MlasConvertFloatToBFloat16Vector(_mm_loadu_ps(Source + 4));
+
+        _mm_storeu_si128((__m128i*)Destination, MlasPackLowWordsInt32x4(Value0, Value1));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#elif defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 8) {
+
+        uint16x4_t Value0 = vmovn_u32(MlasConvertFloatToBFloat16Vector(vld1q_f32(Source)));
+        uint16x4_t Value1 = vmovn_u32(MlasConvertFloatToBFloat16Vector(vld1q_f32(Source + 4)));
+
+        vst1q_u16(Destination, vcombine_u16(Value0, Value1));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasConvertFloatToBFloat16Scalar(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloatBuffer(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer from brain floating point
+    (bfloat16) to single precision floating point.
+
+Arguments:
+
+    Source - Supplies the source buffer.
+
+    Destination - Supplies the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    while (Count >= 8) {
+
+        __m128i Value = _mm_loadu_si128((const __m128i*)Source);
+
+        _mm_storeu_ps(Destination, _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), Value)));
+        _mm_storeu_ps(Destination + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), Value)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#elif defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 8) {
+
+        uint16x8_t Value = vld1q_u16(Source);
+
+        vst1q_f32(Destination, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(Value), 16)));
+        vst1q_f32(Destination + 4, vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(Value), 16)));
+
+        Source += 8;
+        Destination += 8;
+        Count -= 8;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasConvertBFloat16ToFloatScalar(Source[n]);
+    }
+}
+
+void
+MLASCALL
+MlasConvertInt32ToFloatBuffer(
+    const int32_t* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer from 32-bit integers to single
+    precision floating point, rounding to nearest even.
+
+Arguments:
+
+    Source - Supplies the source buffer.
+
+    Destination - Supplies the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON64_INTRINSICS)
+
+    while (Count >= 4) {
+
+        MLAS_INT32X4 IntegerVector = MlasLoadInt32x4(Source);
+
+#if defined(MLAS_NEON64_INTRINSICS)
+        MlasStoreFloat32x4(Destination, vcvtq_f32_s32(IntegerVector));
+#else
+        MlasStoreFloat32x4(Destination, _mm_cvtepi32_ps(IntegerVector));
+#endif
+
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = float(Source[n]);
+    }
+}
+
+template<typename OutputType>
+void
+MLASCALL
+MlasConvertFloatToIntegerBuffer(
+    const float* Source,
+    OutputType* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer from single precision floating
+    point to integers. Values are truncated towards zero and saturated to the
+    range of the output type. NaN values convert to the minimum value of the
+    output type.
+
+Arguments:
+
+    Source - Supplies the source buffer.
+
+    Destination - Supplies the destination buffer.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON64_INTRINSICS)
+
+    const MLAS_FLOAT32X4 MinimumVector = MlasBroadcastFloat32x4(MLAS_FLOAT_TO_INTEGER_RANGE<OutputType>::Minimum);
+    const MLAS_FLOAT32X4 MaximumVector = MlasBroadcastFloat32x4(MLAS_FLOAT_TO_INTEGER_RANGE<OutputType>::Maximum);
+
+    while (Count >= 4) {
+
+        MLAS_FLOAT32X4 FloatVector = MlasLoadFloat32x4(Source);
+
+#if defined(MLAS_NEON64_INTRINSICS)
+        // N.B. FMAXNM returns the numeric value if either of the values is a
+        // NaN. FCVTZS saturates values that are out of the int32_t range.
+        FloatVector = vmaxnmq_f32(FloatVector, MinimumVector);
+        if constexpr (!std::is_same_v<OutputType, int32_t>) {
+            FloatVector = vminnmq_f32(FloatVector, MaximumVector);
+        }
+        int32x4_t IntegerVector = vcvtq_s32_f32(FloatVector);
+#else
+        // N.B. MAXPS returns the value from the second vector if the value
+        // from the first vector is a NaN.
+        FloatVector = _mm_max_ps(FloatVector, MinimumVector);
+        __m128i IntegerVector;
+        if constexpr (std::is_same_v<OutputType, int32_t>) {
+            // N.B. CVTTPS2DQ returns 0x80000000 for values that are out of
+            // range, so flip the positive overflows to 0x7FFFFFFF.
+            __m128i Overflow = _mm_castps_si128(_mm_cmpge_ps(FloatVector, MaximumVector));
+            IntegerVector = _mm_xor_si128(_mm_cvttps_epi32(FloatVector), Overflow);
+        } else {
+            FloatVector = _mm_min_ps(FloatVector, MaximumVector);
+            IntegerVector = _mm_cvttps_epi32(FloatVector);
+        }
+#endif
+
+        if constexpr (std::is_same_v<OutputType, int32_t>) {
+            MlasStoreInt32x4(Destination, IntegerVector);
+        } else {
+#if defined(MLAS_NEON64_INTRINSICS)
+            int16x8_t WordVector = vcombine_s16(vqmovn_s32(IntegerVector), vdup_n_s16(0));
+            int8x8_t ByteVector;
+            if constexpr (std::is_signed_v<OutputType>) {
+                ByteVector = vqmovn_s16(WordVector);
+            } else {
+                ByteVector = vreinterpret_s8_u8(vqmovun_s16(WordVector));
+            }
+            vst1_lane_s32((int32_t*)Destination, vreinterpret_s32_s8(ByteVector), 0);
+#else
+            __m128i WordVector = _mm_packs_epi32(IntegerVector, IntegerVector);
+            __m128i ByteVector;
+            if constexpr (std::is_signed_v<OutputType>) {
+                ByteVector = _mm_packs_epi16(WordVector, WordVector);
+            } else {
+                ByteVector = _mm_packus_epi16(WordVector, WordVector);
+            }
+            *((int32_t*)Destination) = _mm_cvtsi128_si32(ByteVector);
+#endif
+        }
+
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    for (size_t n = 0; n < Count; n++) {
+        Destination[n] = MlasConvertFloatToIntegerScalar<OutputType>(Source[n]);
+    }
+}
+
+template
+void
+MLASCALL
+MlasConvertFloatToIntegerBuffer<int8_t>(
+    const float* Source,
+    int8_t* Destination,
+    size_t Count
+    );
+
+template
+void
+MLASCALL
+MlasConvertFloatToIntegerBuffer<uint8_t>(
+    const float* Source,
+    uint8_t* Destination,
+    size_t Count
+    );
+
+template
+void
+MLASCALL
+MlasConvertFloatToIntegerBuffer<int32_t>(
+    const float* Source,
+    int32_t* Destination,
+    size_t Count
+    );
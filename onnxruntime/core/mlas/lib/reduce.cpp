@@ -0,0 +1,503 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    reduce.cpp
+
+Abstract:
+
+    This module implements routines to reduce the rows or the columns of a
+    single precision floating point matrix.
+
+    Reducing the rows handles reductions along the innermost axes of a tensor,
+    reducing the columns handles reductions along outer axes where each output
+    element is separated from the next by a unit stride. Together with the
+    accumulate mode, these allow reductions over any combination of axes to be
+    done in a single pass over the input.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Helpers to apply the reduction operation to vectors and to scalars.
+//
+
+template<MLAS_REDUCE_KIND ReduceKind>
+struct MLAS_REDUCE_OPERATION;
+
+template<>
+struct MLAS_REDUCE_OPERATION<MlasReduceSum>
+{
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Initial() { return MlasZeroFloat32x4(); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Update(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasAddFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasAddFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE float Reduce(MLAS_FLOAT32X4 Accumulator) { return MlasReduceAddFloat32x4(Accumulator); }
+    static MLAS_FORCEINLINE float Update(float Accumulator, float Value) { return Accumulator + Value; }
+    static MLAS_FORCEINLINE float Combine(float Accumulator, float Value) { return Accumulator + Value; }
+};
+
+template<>
+struct MLAS_REDUCE_OPERATION<MlasReduceSumSquare>
+{
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Initial() { return MlasZeroFloat32x4(); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Update(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasMultiplyAddFloat32x4(Value, Value, Accumulator); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasAddFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE float Reduce(MLAS_FLOAT32X4 Accumulator) { return MlasReduceAddFloat32x4(Accumulator); }
+    static MLAS_FORCEINLINE float Update(float Accumulator, float Value) { return Accumulator + Value * Value; }
+    static MLAS_FORCEINLINE float Combine(float Accumulator, float Value) { return Accumulator + Value; }
+};
+
+template<>
+struct MLAS_REDUCE_OPERATION<MlasReduceMaximum>
+{
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Initial() { return MlasBroadcastFloat32x4(-std::numeric_limits<float>::infinity()); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Update(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasMaximumFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasMaximumFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE float Reduce(MLAS_FLOAT32X4 Accumulator) { return MlasReduceMaximumFloat32x4(Accumulator); }
+    static MLAS_FORCEINLINE float Update(float Accumulator, float Value) { return std::max(Accumulator, Value); }
+    static MLAS_FORCEINLINE float Combine(float Accumulator, float Value) { return std::max(Accumulator, Value); }
+};
+
+template<>
+struct MLAS_REDUCE_OPERATION<MlasReduceMinimum>
+{
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Initial() { return MlasBroadcastFloat32x4(std::numeric_limits<float>::infinity()); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Update(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasMinimumFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE MLAS_FLOAT32X4 Combine(MLAS_FLOAT32X4 Accumulator, MLAS_FLOAT32X4 Value) { return MlasMinimumFloat32x4(Accumulator, Value); }
+    static MLAS_FORCEINLINE float Reduce(MLAS_FLOAT32X4 Accumulator) { return MlasReduceMinimumFloat32x4(Accumulator); }
+    static MLAS_FORCEINLINE float Update(float Accumulator, float Value) { return std::min(Accumulator, Value); }
+    static MLAS_FORCEINLINE float Combine(float Accumulator, float Value) { return std::min(Accumulator, Value); }
+};
+
+template<MLAS_REDUCE_KIND ReduceKind>
+float
+MlasReduceRow(
+    const float* Input,
+    size_t Columns
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces a single row of elements.
+
+Arguments:
+
+    Input - Supplies the input row.
+
+    Columns - Supplies the number of elements in the row.
+
+Return Value:
+
+    Returns the reduced value.
+
+--*/
+{
+    using Operation = MLAS_REDUCE_OPERATION<ReduceKind>;
+
+    MLAS_FLOAT32X4 Accumulator0 = Operation::Initial();
+
+    if (Columns >= 16) {
+
+        MLAS_FLOAT32X4 Accumulator1 = Operation::Initial();
+        MLAS_FLOAT32X4 Accumulator2 = Operation::Initial();
+        MLAS_FLOAT32X4 Accumulator3 = Operation::Initial();
+
+        while (Columns >= 16) {
+
+            Accumulator0 = Operation::Update(Accumulator0, MlasLoadFloat32x4(Input));
+            Accumulator1 = Operation::Update(Accumulator1, MlasLoadFloat32x4(Input + 4));
+            Accumulator2 = Operation::Update(Accumulator2, MlasLoadFloat32x4(Input + 8));
+            Accumulator3 = Operation::Update(Accumulator3, MlasLoadFloat32x4(Input + 12));
+
+            Input += 16;
+            Columns -= 16;
+        }
+
+        Accumulator0 = Operation::Combine(Accumulator0, Accumulator1);
+        Accumulator2 = Operation::Combine(Accumulator2, Accumulator3);
+        Accumulator0 = Operation::Combine(Accumulator0, Accumulator2);
+    }
+
+    while (Columns >= 4) {
+
+        Accumulator0 = Operation::Update(Accumulator0, MlasLoadFloat32x4(Input));
+
+        Input += 4;
+        Columns -= 4;
+    }
+
+    float Accumulator = Operation::Reduce(Accumulator0);
+
+    while (Columns > 0) {
+
+        Accumulator = Operation::Update(Accumulator, *Input++);
+        Columns -= 1;
+    }
+
+    return Accumulator;
+}
+
+template<MLAS_REDUCE_KIND ReduceKind>
+void
+MlasReduceRowsImpl(
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput,
+    bool Accumulate
+    )
+{
+    using Operation = MLAS_REDUCE_OPERATION<ReduceKind>;
+
+    for (size_t r = 0; r < Rows; r++) {
+
+        const float Value = MlasReduceRow<ReduceKind>(Input, Columns);
+        Output[r] = Accumulate ? Operation::Combine(Output[r], Value) : Value;
+
+        Input += ldInput;
+    }
+}
+
+template<MLAS_REDUCE_KIND ReduceKind>
+void
+MlasReduceColumnsImpl(
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput,
+    bool Accumulate
+    )
+{
+    using Operation = MLAS_REDUCE_OPERATION<ReduceKind>;
+
+    //
+    // Process blocks of 16 columns: the accumulators for a block stay in
+    // registers while the rows are streamed through.
+    //
+
+    while (Columns >= 16) {
+
+        MLAS_FLOAT32X4 Accumulator0 = Operation::Initial();
+        MLAS_FLOAT32X4 Accumulator1 = Operation::Initial();
+        MLAS_FLOAT32X4 Accumulator2 = Operation::Initial();
+        MLAS_FLOAT32X4 Accumulator3 = Operation::Initial();
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < Rows; r++) {
+
+            Accumulator0 = Operation::Update(Accumulator0, MlasLoadFloat32x4(input));
+            Accumulator1 = Operation::Update(Accumulator1, MlasLoadFloat32x4(input + 4));
+            Accumulator2 = Operation::Update(Accumulator2, MlasLoadFloat32x4(input + 8));
+            Accumulator3 = Operation::Update(Accumulator3, MlasLoadFloat32x4(input + 12));
+
+            input += ldInput;
+        }
+
+        if (Accumulate) {
+            Accumulator0 = Operation::Combine(Accumulator0, MlasLoadFloat32x4(Output));
+            Accumulator1 = Operation::Combine(Accumulator1, MlasLoadFloat32x4(Output + 4));
+            Accumulator2 = Operation::Combine(Accumulator2, MlasLoadFloat32x4(Output + 8));
+            Accumulator3 = Operation::Combine(Accumulator3, MlasLoadFloat32x4(Output + 12));
+        }
+
+        MlasStoreFloat32x4(Output, Accumulator0);
+        MlasStoreFloat32x4(Output + 4, Accumulator1);
+        MlasStoreFloat32x4(Output + 8, Accumulator2);
+        MlasStoreFloat32x4(Output + 12, Accumulator3);
+
+        Input += 16;
+        Output += 16;
+        Columns -= 16;
+    }
+
+    while (Columns >= 4) {
+
+        MLAS_FLOAT32X4 Accumulator = Operation::Initial();
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < Rows; r++) {
+            Accumulator = Operation::Update(Accumulator, MlasLoadFloat32x4(input));
+            input += ldInput;
+        }
+
+        if (Accumulate) {
+            Accumulator = Operation::Combine(Accumulator, MlasLoadFloat32x4(Output));
+        }
+
+        MlasStoreFloat32x4(Output, Accumulator);
+
+        Input += 4;
+        Output += 4;
+        Columns -= 4;
+    }
+
+    while (Columns > 0) {
+
+        float Accumulator = Operation::Reduce(Operation::Initial());
+
+        const float* input = Input;
+
+        for (size_t r = 0; r < Rows; r++) {
+            Accumulator = Operation::Update(Accumulator, *input);
+            input += ldInput;
+        }
+
+        *Output = Accumulate ? Operation::Combine(*Output, Accumulator) : Accumulator;
+
+        Input += 1;
+        Output += 1;
+        Columns -= 1;
+    }
+}
+
+MLAS_FORCEINLINE
+float
+MlasLogSumExpShift(
+    float Maximum
+    )
+/*++
+
+Routine Description:
+
+    This routine returns the value subtracted from the inputs before they are
+    exponentiated. Infinities and NaNs are not used as the shift so that rows
+    of all negative infinities produce negative infinity (instead of NaN).
+    Rows containing positive infinity are handled by the callers as the
+    exponential kernels do not propagate infinities.
+
+Arguments:
+
+    Maximum - Supplies the maximum of the inputs.
+
+Return Value:
+
+    Returns the shift.
+
+--*/
+{
+    return std::isfinite(Maximum) ? Maximum : 0.0f;
+}
+
+void
+MlasReduceLogSumExpRows(
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput
+    )
+{
+    for (size_t r = 0; r < Rows; r++) {
+
+#if defined(MLAS_TARGET_AMD64)
+        const float Maximum = GetMlasPlatform().ReduceMaximumF32Kernel(Input, Columns);
+#else
+        const float Maximum = MlasReduceMaximumF32Kernel(Input, Columns);
+#endif
+
+        if (Maximum == std::numeric_limits<float>::infinity()) {
+            Output[r] = Maximum;
+            Input += ldInput;
+            continue;
+        }
+
+        const float NegativeShift = -MlasLogSumExpShift(Maximum);
+
+#if defined(MLAS_TARGET_AMD64)
+        const float Accumulation = GetMlasPlatform().ComputeSumExpF32Kernel(Input, nullptr, Columns, &NegativeShift);
+#else
+        const float Accumulation = MlasComputeSumExpF32Kernel(Input, nullptr, Columns, &NegativeShift);
+#endif
+
+        Output[r] = std::log(Accumulation) - NegativeShift;
+
+        Input += ldInput;
+    }
+}
+
+void
+MlasReduceLogSumExpColumns(
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput
+    )
+{
+    //
+    // Find the maximum of each column, then accumulate the exponentials of
+    // the shifted inputs for a block of columns at a time.
+    //
+
+    MlasReduceColumnsImpl<MlasReduceMaximum>(Input, Output, Rows, Columns, ldInput, false);
+
+    constexpr size_t BlockSize = 64;
+    MLAS_DECLSPEC_ALIGN(float Shift[BlockSize], 16);
+    MLAS_DECLSPEC_ALIGN(float Exponential[BlockSize], 16);
+    MLAS_DECLSPEC_ALIGN(float Accumulation[BlockSize], 16);
+
+    for (size_t c = 0; c < Columns; c += BlockSize) {
+
+        const size_t CountC = std::min(Columns - c, BlockSize);
+
+        for (size_t i = 0; i < CountC; i++) {
+            Shift[i] = MlasLogSumExpShift(Output[c + i]);
+            Accumulation[i] = 0.0f;
+        }
+
+        const float* input = Input + c;
+
+        for (size_t r = 0; r < Rows; r++) {
+
+            for (size_t i = 0; i < CountC; i++) {
+                Exponential[i] = input[i] - Shift[i];
+            }
+
+            MlasComputeExp(Exponential, Exponential, CountC);
+
+            for (size_t i = 0; i < CountC; i++) {
+                Accumulation[i] += Exponential[i];
+            }
+
+            input += ldInput;
+        }
+
+        for (size_t i = 0; i < CountC; i++) {
+            if (Output[c + i] != std::numeric_limits<float>::infinity()) {
+                Output[c + i] = std::log(Accumulation[i]) + Shift[i];
+            }
+        }
+    }
+}
+
+void
+MLASCALL
+MlasReduceRows(
+    MLAS_REDUCE_KIND ReduceKind,
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput,
+    bool Accumulate
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces each row of a matrix to a single value.
+
+Arguments:
+
+    ReduceKind - Supplies the reduction to perform.
+
+    Input - Supplies the input matrix.
+
+    Output - Supplies the output buffer with one element per row.
+
+    Rows - Supplies the number of rows in the matrix.
+
+    Columns - Supplies the number of columns (elements reduced per row).
+
+    ldInput - Supplies the first dimension of the input matrix.
+
+    Accumulate - Supplies true if the reduced values are to be combined with
+        the existing contents of the output buffer. Not supported for
+        MlasReduceLogSumExp.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (ReduceKind) {
+        case MlasReduceSum:
+            MlasReduceRowsImpl<MlasReduceSum>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceSumSquare:
+            MlasReduceRowsImpl<MlasReduceSumSquare>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceMaximum:
+            MlasReduceRowsImpl<MlasReduceMaximum>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceMinimum:
+            MlasReduceRowsImpl<MlasReduceMinimum>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceLogSumExp:
+            MLAS_UNREFERENCED_PARAMETER(Accumulate);
+            MlasReduceLogSumExpRows(Input, Output, Rows, Columns, ldInput);
+            break;
+    }
+}
+
+void
+MLASCALL
+MlasReduceColumns(
+    MLAS_REDUCE_KIND ReduceKind,
+    const float* Input,
+    float* Output,
+    size_t Rows,
+    size_t Columns,
+    size_t ldInput,
+    bool Accumulate
+    )
+/*++
+
+Routine Description:
+
+    This routine reduces each column of a matrix to a single value.
+
+Arguments:
+
+    ReduceKind - Supplies the reduction to perform.
+
+    Input - Supplies the input matrix.
+
+    Output - Supplies the output buffer with one element per column.
+
+    Rows - Supplies the number of rows (elements reduced per column).
+
+    Columns - Supplies the number of columns in the matrix.
+
+    ldInput - Supplies the first dimension of the input matrix.
+
+    Accumulate - Supplies true if the reduced values are to be combined with
+        the existing contents of the output buffer. Not supported for
+        MlasReduceLogSumExp.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (ReduceKind) {
+        case MlasReduceSum:
+            MlasReduceColumnsImpl<MlasReduceSum>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceSumSquare:
+            MlasReduceColumnsImpl<MlasReduceSumSquare>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceMaximum:
+            MlasReduceColumnsImpl<MlasReduceMaximum>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceMinimum:
+            MlasReduceColumnsImpl<MlasReduceMinimum>(Input, Output, Rows, Columns, ldInput, Accumulate);
+            break;
+        case MlasReduceLogSumExp:
+            MLAS_UNREFERENCED_PARAMETER(Accumulate);
+            MlasReduceLogSumExpColumns(Input, Output, Rows, Columns, ldInput);
+            break;
+    }
+}
@@ -0,0 +1,486 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    sparse_gemm.cpp
+
+Abstract:
+
+    This module implements the single precision matrix/matrix multiply
+    operation (GEMM) for a sparse B matrix.
+
+    The B matrix is packed into a compressed sparse column format. Blocks of
+    MLAS_SPARSE_GEMM_ROW_BLOCK rows of A are transposed into a buffer so that
+    each non-zero element of B is multiplied with a contiguous vector of A
+    values, one from each row of the block. The products are accumulated in
+    registers per output column, so the work is proportional to the number of
+    non-zero elements of B.
+
+--*/
+
+#include "mlasi.h"
+
+#include <memory>
+
+//
+// Define the header of the packed B buffer. The header is followed by the
+// N + 1 offsets of the columns into the non-zero elements, the values of the
+// non-zero elements and then their row indices.
+//
+
+struct MLAS_SPARSE_GEMM_PACKED_B_HEADER {
+    size_t N;
+    size_t K;
+    size_t NonZeroCount;
+};
+
+//
+// Define the minimum number of multiply-adds to assign to a thread.
+//
+
+constexpr double MLAS_SPARSE_GEMM_THREAD_COMPLEXITY = 64 * 1024;
+
+MLAS_FORCEINLINE
+float
+MlasSparseGemmElementB(
+    CBLAS_TRANSPOSE TransB,
+    const float* B,
+    size_t ldb,
+    size_t k,
+    size_t n
+    )
+{
+    return (TransB == CblasNoTrans) ? B[k * ldb + n] : B[n * ldb + k];
+}
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in bytes for the packed sparse matrix B
+    buffer.
+
+Arguments:
+
+    TransB - Supplies the transpose operation on B matrix
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+Return Value:
+
+    Returns the size in bytes for the packed matrix B buffer, or zero if the
+    matrix is too large to be packed.
+
+--*/
+{
+    if (K > std::numeric_limits<uint32_t>::max()) {
+        return 0;
+    }
+
+    size_t NonZeroCount = 0;
+
+    for (size_t n = 0; n < N; n++) {
+        for (size_t k = 0; k < K; k++) {
+            NonZeroCount += (MlasSparseGemmElementB(TransB, B, ldb, k, n) != 0.0f);
+        }
+    }
+
+    return sizeof(MLAS_SPARSE_GEMM_PACKED_B_HEADER) + (N + 1) * sizeof(size_t) +
+        NonZeroCount * (sizeof(float) + sizeof(uint32_t));
+}
+
+void
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the non-zero elements of matrix B column by column.
+
+Arguments:
+
+    TransB - Supplies the transpose operation on B matrix
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    PackedB - Supplies the address of packed matrix B. The buffer must be at
+        least the size returned by MlasSparseGemmPackBSize.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    auto* Header = reinterpret_cast<MLAS_SPARSE_GEMM_PACKED_B_HEADER*>(PackedB);
+    size_t* ColumnStart = reinterpret_cast<size_t*>(Header + 1);
+
+    size_t NonZeroCount = 0;
+
+    for (size_t n = 0; n < N; n++) {
+        ColumnStart[n] = NonZeroCount;
+        for (size_t k = 0; k < K; k++) {
+            NonZeroCount += (MlasSparseGemmElementB(TransB, B, ldb, k, n) != 0.0f);
+        }
+    }
+
+    ColumnStart[N] = NonZeroCount;
+
+    Header->N = N;
+    Header->K = K;
+    Header->NonZeroCount = NonZeroCount;
+
+    float* Values = reinterpret_cast<float*>(ColumnStart + N + 1);
+    uint32_t* RowIndex = reinterpret_cast<uint32_t*>(Values + NonZeroCount);
+
+    for (size_t n = 0; n < N; n++) {
+
+        size_t i = ColumnStart[n];
+
+        for (size_t k = 0; k < K; k++) {
+
+            const float Value = MlasSparseGemmElementB(TransB, B, ldb, k, n);
+
+            if (Value != 0.0f) {
+                Values[i] = Value;
+                RowIndex[i] = uint32_t(k);
+                i++;
+            }
+        }
+    }
+}
+
+void
+MlasSparseGemmTransposeRowBlock(
+    CBLAS_TRANSPOSE TransA,
+    size_t RowCount,
+    size_t K,
+    const float* A,
+    size_t lda,
+    float* D
+    )
+/*++
+
+Routine Description:
+
+    This routine copies a block of rows of matrix A to a buffer where the
+    elements of the rows are interleaved, so that column k of the block is
+    stored at D + k * MLAS_SPARSE_GEMM_ROW_BLOCK. Rows beyond RowCount are zero
+    filled.
+
+Arguments:
+
+    TransA - Supplies the transpose operation on A matrix
+
+    RowCount - Supplies the number of rows of the block, which is at most
+        MLAS_SPARSE_GEMM_ROW_BLOCK.
+
+    K - Supplies the number of columns of matrix A.
+
+    A - Supplies the address of the first row of the block of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    D - Supplies the address of the destination buffer.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (TransA == CblasNoTrans) {
+
+        for (size_t r = 0; r < MLAS_SPARSE_GEMM_ROW_BLOCK; r++) {
+
+            if (r < RowCount) {
+                const float* a = A + r * lda;
+                for (size_t k = 0; k < K; k++) {
+                    D[k * MLAS_SPARSE_GEMM_ROW_BLOCK + r] = a[k];
+                }
+            } else {
+                for (size_t k = 0; k < K; k++) {
+                    D[k * MLAS_SPARSE_GEMM_ROW_BLOCK + r] = 0.0f;
+                }
+            }
+        }
+
+    } else {
+
+        //
+        // The rows of the block are the columns of the stored matrix, so the
+        // values of each column k of the block are already contiguous.
+        //
+
+        for (size_t k = 0; k < K; k++) {
+
+            const float* a = A + k * lda;
+            float* d = D + k * MLAS_SPARSE_GEMM_ROW_BLOCK;
+
+            for (size_t r = 0; r < MLAS_SPARSE_GEMM_ROW_BLOCK; r++) {
+                d[r] = (r < RowCount) ? a[r] : 0.0f;
+            }
+        }
+    }
+}
+
+void
+MlasSparseGemmRowBlock(
+    size_t RowCount,
+    size_t CountN,
+    float alpha,
+    const float* D,
+    const size_t* ColumnStart,
+    const float* Values,
+    const uint32_t* RowIndex,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine computes CountN columns of a block of rows of the output
+    matrix from the transposed block of rows of matrix A.
+
+Arguments:
+
+    RowCount - Supplies the number of rows of the block to store.
+
+    CountN - Supplies the number of columns to compute.
+
+    alpha - Supplies the scalar multiplier.
+
+    D - Supplies the transposed block of rows of matrix A.
+
+    ColumnStart - Supplies the offsets of the first column to compute and of
+        the columns following it into the non-zero elements of matrix B.
+
+    Values - Supplies the values of the non-zero elements of matrix B.
+
+    RowIndex - Supplies the row indices of the non-zero elements of matrix B.
+
+    C - Supplies the address of the first column of the block of rows of
+        matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    static_assert(MLAS_SPARSE_GEMM_ROW_BLOCK == 8, "kernel computes two vectors of rows");
+
+    const MLAS_FLOAT32X4 Alpha = MlasBroadcastFloat32x4(alpha);
+
+    for (size_t n = 0; n < CountN; n++) {
+
+        //
+        // Use two sets of accumulators to break the dependency chain of the
+        // multiply-adds.
+        //
+
+        MLAS_FLOAT32X4 Accumulator0 = MlasZeroFloat32x4();
+        MLAS_FLOAT32X4 Accumulator1 = MlasZeroFloat32x4();
+        MLAS_FLOAT32X4 Accumulator2 = MlasZeroFloat32x4();
+        MLAS_FLOAT32X4 Accumulator3 = MlasZeroFloat32x4();
+
+        size_t i = ColumnStart[n];
+        const size_t end = ColumnStart[n + 1];
+
+        for (; i + 2 <= end; i += 2) {
+
+            const float* d0 = D + size_t(RowIndex[i]) * MLAS_SPARSE_GEMM_ROW_BLOCK;
+            const float* d1 = D + size_t(RowIndex[i + 1]) * MLAS_SPARSE_GEMM_ROW_BLOCK;
+
+            Accumulator0 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(d0), Values[i], Accumulator0);
+            Accumulator1 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(d0 + 4), Values[i], Accumulator1);
+            Accumulator2 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(d1), Values[i + 1], Accumulator2);
+            Accumulator3 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(d1 + 4), Values[i + 1], Accumulator3);
+        }
+
+        if (i < end) {
+
+            const float* d0 = D + size_t(RowIndex[i]) * MLAS_SPARSE_GEMM_ROW_BLOCK;
+
+            Accumulator0 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(d0), Values[i], Accumulator0);
+            Accumulator1 = MlasMultiplyAddFloat32x4(MlasLoadFloat32x4(d0 + 4), Values[i], Accumulator1);
+        }
+
+        Accumulator0 = MlasMultiplyFloat32x4(MlasAddFloat32x4(Accumulator0, Accumulator2), Alpha);
+        Accumulator1 = MlasMultiplyFloat32x4(MlasAddFloat32x4(Accumulator1, Accumulator3), Alpha);
+
+        float Output[MLAS_SPARSE_GEMM_ROW_BLOCK];
+        MlasStoreFloat32x4(Output, Accumulator0);
+        MlasStoreFloat32x4(Output + 4, Accumulator1);
+
+        for (size_t r = 0; r < RowCount; r++) {
+            C[r * ldc + n] = Output[r];
+        }
+    }
+}
+
+void
+MLASCALL
+MlasSparseGemm(
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single precision matrix/matrix multiply
+    operation C = alpha * op(A) * B for a matrix B packed by
+    MlasSparseGemmPackB.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    M - Supplies the number of rows of matrix op(A) and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix op(A) and the number of rows
+        of matrix B.
+
+    alpha - Supplies the scalar multiplier.
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of the packed matrix B.
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* Header = reinterpret_cast<const MLAS_SPARSE_GEMM_PACKED_B_HEADER*>(PackedB);
+    const size_t* ColumnStart = reinterpret_cast<const size_t*>(Header + 1);
+    const float* Values = reinterpret_cast<const float*>(ColumnStart + Header->N + 1);
+    const uint32_t* RowIndex = reinterpret_cast<const uint32_t*>(Values + Header->NonZeroCount);
+
+    if (M == 0 || N == 0) {
+        return;
+    }
+
+    const size_t RowBlockCount = MlasDivRoundup(M, MLAS_SPARSE_GEMM_ROW_BLOCK);
+    const size_t RowBlockStride = K * MLAS_SPARSE_GEMM_ROW_BLOCK;
+
+    //
+    // Compute the number of threads to use from the number of multiply-adds
+    // and split the columns when there are fewer blocks of rows than threads.
+    //
+
+    const double Complexity = double(Header->NonZeroCount) * double(RowBlockCount * MLAS_SPARSE_GEMM_ROW_BLOCK);
+
+    ptrdiff_t TargetThreadCount = ptrdiff_t(Complexity / MLAS_SPARSE_GEMM_THREAD_COMPLEXITY) + 1;
+    TargetThreadCount = std::min(TargetThreadCount, MlasGetMaximumThreadCount(ThreadPool));
+
+    if (TargetThreadCount <= 1) {
+
+        //
+        // A single buffer is reused for each block of rows.
+        //
+
+        std::unique_ptr<float[]> TransposedA(new float[std::max<size_t>(RowBlockStride, 1)]);
+
+        for (size_t m = 0; m < M; m += MLAS_SPARSE_GEMM_ROW_BLOCK) {
+            const size_t RowCount = std::min<size_t>(M - m, MLAS_SPARSE_GEMM_ROW_BLOCK);
+            const float* a = (TransA == CblasNoTrans) ? A + m * lda : A + m;
+            MlasSparseGemmTransposeRowBlock(TransA, RowCount, K, a, lda, TransposedA.get());
+            MlasSparseGemmRowBlock(RowCount, N, alpha, TransposedA.get(), ColumnStart, Values, RowIndex,
+                                   C + m * ldc, ldc);
+        }
+
+        return;
+    }
+
+    //
+    // Transpose the blocks of rows of matrix A once so that they can be shared
+    // by the threads computing different columns of the same rows.
+    //
+
+    std::unique_ptr<float[]> TransposedA(new float[std::max<size_t>(RowBlockCount * RowBlockStride, 1)]);
+    float* D = TransposedA.get();
+
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(RowBlockCount), [&](ptrdiff_t RowBlock) {
+        const size_t m = size_t(RowBlock) * MLAS_SPARSE_GEMM_ROW_BLOCK;
+        const float* a = (TransA == CblasNoTrans) ? A + m * lda : A + m;
+        MlasSparseGemmTransposeRowBlock(TransA, std::min<size_t>(M - m, MLAS_SPARSE_GEMM_ROW_BLOCK), K, a, lda,
+                                        D + size_t(RowBlock) * RowBlockStride);
+    });
+
+    const size_t ColumnChunkCount =
+        std::min(MlasDivRoundup(size_t(TargetThreadCount), RowBlockCount), MlasDivRoundup(N, size_t(16)));
+    const size_t ColumnChunkSize = MlasDivRoundup(N, ColumnChunkCount);
+
+    MlasTrySimpleParallel(ThreadPool, ptrdiff_t(RowBlockCount * ColumnChunkCount), [&](ptrdiff_t tid) {
+        const size_t RowBlock = size_t(tid) / ColumnChunkCount;
+        const size_t n = (size_t(tid) % ColumnChunkCount) * ColumnChunkSize;
+
+        if (n >= N) {
+            return;
+        }
+
+        const size_t m = RowBlock * MLAS_SPARSE_GEMM_ROW_BLOCK;
+        MlasSparseGemmRowBlock(std::min<size_t>(M - m, MLAS_SPARSE_GEMM_ROW_BLOCK), std::min(ColumnChunkSize, N - n),
+                               alpha, D + RowBlock * RowBlockStride, ColumnStart + n, Values, RowIndex,
+                               C + m * ldc + n, ldc);
+    });
+}
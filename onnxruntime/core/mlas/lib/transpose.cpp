@@ -95,6 +95,52 @@ MlasTranspose8x8Block(
     _mm_storeh_pi((__m64*)&Output[OutputStride * 7], d3);
 }
 
+MLAS_FORCEINLINE
+void
+MlasTranspose8x8Block(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride
+    )
+{
+    __m128i a0 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 0]);
+    __m128i a1 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 1]);
+    __m128i a2 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 2]);
+    __m128i a3 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 3]);
+    __m128i a4 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 4]);
+    __m128i a5 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 5]);
+    __m128i a6 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 6]);
+    __m128i a7 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 7]);
+
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+    __m128i b4 = _mm_unpacklo_epi16(a4, a5);
+    __m128i b5 = _mm_unpackhi_epi16(a4, a5);
+    __m128i b6 = _mm_unpacklo_epi16(a6, a7);
+    __m128i b7 = _mm_unpackhi_epi16(a6, a7);
+
+    __m128i c0 = _mm_unpacklo_epi32(b0, b2);
+    __m128i c1 = _mm_unpackhi_epi32(b0, b2);
+    __m128i c2 = _mm_unpacklo_epi32(b1, b3);
+    __m128i c3 = _mm_unpackhi_epi32(b1, b3);
+    __m128i c4 = _mm_unpacklo_epi32(b4, b6);
+    __m128i c5 = _mm_unpackhi_epi32(b4, b6);
+    __m128i c6 = _mm_unpacklo_epi32(b5, b7);
+    __m128i c7 = _mm_unpackhi_epi32(b5, b7);
+
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 0], _mm_unpacklo_epi64(c0, c4));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 1], _mm_unpackhi_epi64(c0, c4));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 2], _mm_unpacklo_epi64(c1, c5));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 3], _mm_unpackhi_epi64(c1, c5));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 4], _mm_unpacklo_epi64(c2, c6));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 5], _mm_unpackhi_epi64(c2, c6));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 6], _mm_unpacklo_epi64(c3, c7));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 7], _mm_unpackhi_epi64(c3, c7));
+}
+
 #elif defined(MLAS_NEON_INTRINSICS)
 
 MLAS_FORCEINLINE
@@ -168,6 +214,49 @@ MlasTranspose8x8Block(
     vst1_u8(&Output[OutputStride * 7], vreinterpret_u8_u32(d3.val[1]));
 }
 
+MLAS_FORCEINLINE
+void
+MlasTranspose8x8Block(
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride
+    )
+{
+    uint16x8_t a0 = vld1q_u16(&Input[InputStride * 0]);
+    uint16x8_t a1 = vld1q_u16(&Input[InputStride * 1]);
+    uint16x8_t a2 = vld1q_u16(&Input[InputStride * 2]);
+    uint16x8_t a3 = vld1q_u16(&Input[InputStride * 3]);
+    uint16x8_t a4 = vld1q_u16(&Input[InputStride * 4]);
+    uint16x8_t a5 = vld1q_u16(&Input[InputStride * 5]);
+    uint16x8_t a6 = vld1q_u16(&Input[InputStride * 6]);
+    uint16x8_t a7 = vld1q_u16(&Input[InputStride * 7]);
+
+    uint16x8x2_t b0 = vzipq_u16(a0, a4);
+    uint16x8x2_t b1 = vzipq_u16(a1, a5);
+    uint16x8x2_t b2 = vzipq_u16(a2, a6);
+    uint16x8x2_t b3 = vzipq_u16(a3, a7);
+
+    uint16x8x2_t c0 = vzipq_u16(b0.val[0], b2.val[0]);
+    uint16x8x2_t c1 = vzipq_u16(b0.val[1], b2.val[1]);
+    uint16x8x2_t c2 = vzipq_u16(b1.val[0], b3.val[0]);
+    uint16x8x2_t c3 = vzipq_u16(b1.val[1], b3.val[1]);
+
+    uint16x8x2_t d0 = vzipq_u16(c0.val[0], c2.val[0]);
+    uint16x8x2_t d1 = vzipq_u16(c0.val[1], c2.val[1]);
+    uint16x8x2_t d2 = vzipq_u16(c1.val[0], c3.val[0]);
+    uint16x8x2_t d3 = vzipq_u16(c1.val[1], c3.val[1]);
+
+    vst1q_u16(&Output[OutputStride * 0], d0.val[0]);
+    vst1q_u16(&Output[OutputStride * 1], d0.val[1]);
+    vst1q_u16(&Output[OutputStride * 2], d1.val[0]);
+    vst1q_u16(&Output[OutputStride * 3], d1.val[1]);
+    vst1q_u16(&Output[OutputStride * 4], d2.val[0]);
+    vst1q_u16(&Output[OutputStride * 5], d2.val[1]);
+    vst1q_u16(&Output[OutputStride * 6], d3.val[0]);
+    vst1q_u16(&Output[OutputStride * 7], d3.val[1]);
+}
+
 #endif
 
 template<typename ElementType>
@@ -205,11 +294,13 @@ MlasTranspose8xNVector(
     MlasTranspose4xNVector(&Input[InputStride * 4], InputStride, &Output[OutputStride * 4], OutputStride);
 }
 
+template<typename ElementType>
 void
-MLASCALL
-MlasTranspose(
-    const uint32_t* Input,
-    uint32_t* Output,
+MlasTransposeStrided(
+    const ElementType* Input,
+    size_t InputStride,
+    ElementType* Output,
+    size_t OutputStride,
     size_t M,
     size_t N
     )
@@ -220,12 +311,21 @@ Routine Description:
     This routine transposes the input matrix (M rows by N columns) to the
     output matrix (N rows by M columns).
 
+    32-bit elements are processed in 4x4 blocks and 8-bit or 16-bit elements
+    are processed in 8x8 blocks.
+
 Arguments:
 
     Input - Supplies the input buffer.
 
+    InputStride - Supplies the number of elements between rows of the input
+        matrix.
+
     Output - Supplies the output buffer.
 
+    OutputStride - Supplies the number of elements between rows of the output
+        matrix.
+
     M - Supplies the number of rows for the input matrix and the number of
         columns for the output matrix.
 
@@ -238,44 +338,54 @@ Return Value:
 
 --*/
 {
+    constexpr size_t BlockSize = (sizeof(ElementType) == sizeof(uint32_t)) ? 4 : 8;
+
     size_t n = N;
 
     //
-    // Transpose elements from the input matrix to the output matrix 4 columns
-    // at a time.
+    // Transpose elements from the input matrix to the output matrix a block
+    // of columns at a time.
     //
 
-    while (n >= 4) {
+    while (n >= BlockSize) {
 
-        const uint32_t* s = Input;
-        uint32_t* d = Output;
+        const ElementType* s = Input;
+        ElementType* d = Output;
         size_t m = M;
 
 #if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
 
-        while (m >= 4) {
+        while (m >= BlockSize) {
 
-            MlasTranspose4x4Block(s, N, d, M);
+            if constexpr (BlockSize == 4) {
+                MlasTranspose4x4Block(s, InputStride, d, OutputStride);
+            } else {
+                MlasTranspose8x8Block(s, InputStride, d, OutputStride);
+            }
 
-            s += N * 4;
-            d += 4;
-            m -= 4;
+            s += InputStride * BlockSize;
+            d += BlockSize;
+            m -= BlockSize;
         }
 
 #endif
 
         while (m > 0) {
 
-            MlasTranspose4xNVector(s, 1, d, M);
+            if constexpr (BlockSize == 4) {
+                MlasTranspose4xNVector(s, 1, d, OutputStride);
+            } else {
+                MlasTranspose8xNVector(s, 1, d, OutputStride);
+            }
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
-        Input += 4;
-        Output += M * 4;
-        n -= 4;
+        Input += BlockSize;
+        Output += OutputStride * BlockSize;
+        n -= BlockSize;
     }
 
     //
@@ -285,34 +395,74 @@ Return Value:
 
     while (n > 0) {
 
-        const uint32_t* s = Input;
-        uint32_t* d = Output;
+        const ElementType* s = Input;
+        ElementType* d = Output;
         size_t m = M;
 
-        while (m >= 4) {
+        while (m >= BlockSize) {
 
-            MlasTranspose4xNVector(s, N, d, 1);
+            if constexpr (BlockSize == 4) {
+                MlasTranspose4xNVector(s, InputStride, d, 1);
+            } else {
+                MlasTranspose8xNVector(s, InputStride, d, 1);
+            }
 
-            s += N * 4;
-            d += 4;
-            m -= 4;
+            s += InputStride * BlockSize;
+            d += BlockSize;
+            m -= BlockSize;
         }
 
         while (m > 0) {
 
             d[0] = s[0];
 
-            s += N;
+            s += InputStride;
             d += 1;
             m -= 1;
         }
 
         Input += 1;
-        Output += M;
+        Output += OutputStride;
         n -= 1;
     }
 }
 
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns).
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
+
 void
 MLASCALL
 MlasTranspose(
@@ -332,8 +482,8 @@ MlasTranspose(
 void
 MLASCALL
 MlasTranspose(
-    const uint8_t* Input,
-    uint8_t* Output,
+    const uint16_t* Input,
+    uint16_t* Output,
     size_t M,
     size_t N
     )
@@ -362,92 +512,130 @@ Return Value:
 
 --*/
 {
-    size_t n = N;
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
 
-    //
-    // Transpose elements from the input matrix to the output matrix 8 columns
-    // at a time.
-    //
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
 
-    while (n >= 8) {
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns).
 
-        const uint8_t* s = Input;
-        uint8_t* d = Output;
-        size_t m = M;
+Arguments:
 
-#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+    Input - Supplies the input buffer.
 
-        while (m >= 8) {
+    Output - Supplies the output buffer.
 
-            MlasTranspose8x8Block(s, N, d, M);
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
 
-            s += N * 8;
-            d += 8;
-            m -= 8;
-        }
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
 
-#endif
+Return Value:
 
-        while (m > 0) {
+    None.
 
-            MlasTranspose8xNVector(s, 1, d, M);
+--*/
+{
+    MlasTransposeStrided(Input, N, Output, M, M, N);
+}
 
-            s += N;
-            d += 1;
-            m -= 1;
-        }
+void
+MLASCALL
+MlasTranspose(
+    const int8_t* Input,
+    int8_t* Output,
+    size_t M,
+    size_t N)
+{
+    MlasTranspose(
+        reinterpret_cast<const uint8_t*>(Input),
+        reinterpret_cast<uint8_t*>(Output),
+        M,
+        N);
+}
 
-        Input += 8;
-        Output += M * 8;
-        n -= 8;
-    }
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    )
+/*++
 
-    //
-    // Transpose elements from the input matrix to the output matrix for the
-    // remaining columns.
-    //
+Routine Description:
 
-    while (n > 0) {
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns). Both matrices may be sub-matrices of
+    larger buffers, which allows callers to transpose one tile of a larger
+    tensor at a time.
 
-        const uint8_t* s = Input;
-        uint8_t* d = Output;
-        size_t m = M;
+Arguments:
 
-        while (m >= 8) {
+    Input - Supplies the input buffer.
 
-            MlasTranspose8xNVector(s, N, d, 1);
+    InputStride - Supplies the number of elements between rows of the input
+        matrix.
 
-            s += N * 8;
-            d += 8;
-            m -= 8;
-        }
+    Output - Supplies the output buffer.
 
-        while (m > 0) {
+    OutputStride - Supplies the number of elements between rows of the output
+        matrix.
 
-            d[0] = s[0];
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
 
-            s += N;
-            d += 1;
-            m -= 1;
-        }
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
 
-        Input += 1;
-        Output += M;
-        n -= 1;
-    }
+Return Value:
+
+    None.
+
+--*/
+{
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
 }
 
 void
 MLASCALL
 MlasTranspose(
-    const int8_t* Input,
-    int8_t* Output,
+    const uint16_t* Input,
+    size_t InputStride,
+    uint16_t* Output,
+    size_t OutputStride,
     size_t M,
-    size_t N)
+    size_t N
+    )
 {
-    MlasTranspose(
-        reinterpret_cast<const uint8_t*>(Input),
-        reinterpret_cast<uint8_t*>(Output),
-        M,
-        N);
-}
\ No newline at end of file
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    size_t InputStride,
+    uint8_t* Output,
+    size_t OutputStride,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeStrided(Input, InputStride, Output, OutputStride, M, N);
+}
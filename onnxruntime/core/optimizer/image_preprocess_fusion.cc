@@ -0,0 +1,250 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/image_preprocess_fusion.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+#include <algorithm>
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+bool HasStaticDim(const TensorShapeProto& shape, int index) {
+  return shape.dim(index).has_dim_value();
+}
+
+// Reads a constant float initializer that broadcasts to one value per channel. channel_axis_from_end is the
+// position of the channel axis counted from the last axis: 0 for NHWC and 2 for NCHW.
+bool GetChannelValues(const Graph& graph, const NodeArg& arg, int channel_axis_from_end, int64_t channels,
+                      std::vector<float>& values) {
+  const TensorProto* tensor = graph_utils::GetConstantInitializer(graph, arg.Name());
+  if (tensor == nullptr || tensor->data_type() != TensorProto::FLOAT || tensor->dims_size() > 4) {
+    return false;
+  }
+
+  const int rank = tensor->dims_size();
+  for (int i = 0; i < rank; ++i) {
+    const int64_t dim = tensor->dims(i);
+    if (dim != 1 && !(rank - 1 - i == channel_axis_from_end && dim == channels)) {
+      return false;
+    }
+  }
+
+  Initializer initializer(*tensor, graph.ModelPath());
+  const float* data = initializer.data<float>();
+  values.resize(static_cast<size_t>(channels));
+  for (int64_t c = 0; c < channels; ++c) {
+    values[static_cast<size_t>(c)] = data[initializer.size() == 1 ? 0 : c];
+  }
+  return true;
+}
+
+// Folds an Add, Sub, Mul or Div of node with a per channel constant into scale and bias.
+bool FoldElementwise(const Graph& graph, const Node& node, const NodeArg& input, int channel_axis_from_end,
+                     std::vector<float>& scale, std::vector<float>& bias) {
+  const bool is_add = graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14});
+  const bool is_sub = graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13, 14});
+  const bool is_mul = graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14});
+  const bool is_div = graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13, 14});
+  if (!is_add && !is_sub && !is_mul && !is_div) {
+    return false;
+  }
+
+  const int input_index = optimizer_utils::IndexOfNodeInput(node, input);
+  // The constant must be the subtrahend or the divisor
+  if ((is_sub || is_div) && input_index != 0) {
+    return false;
+  }
+
+  std::vector<float> values;
+  if (!GetChannelValues(graph, *node.InputDefs()[(input_index + 1) % 2], channel_axis_from_end,
+                        static_cast<int64_t>(scale.size()), values)) {
+    return false;
+  }
+
+  if (is_div && std::find(values.begin(), values.end(), 0.0f) != values.end()) {
+    return false;
+  }
+
+  for (size_t c = 0; c < scale.size(); ++c) {
+    if (is_add) {
+      bias[c] += values[c];
+    } else if (is_sub) {
+      bias[c] -= values[c];
+    } else if (is_mul) {
+      scale[c] *= values[c];
+      bias[c] *= values[c];
+    } else {
+      scale[c] /= values[c];
+      bias[c] /= values[c];
+    }
+  }
+  return true;
+}
+
+// Returns the output size of a bilinear half_pixel Resize of the spatial axes of an NCHW tensor.
+// input_shape is the shape of the NHWC input of the subgraph.
+bool GetResizeOutputSize(const Graph& graph, const Node& resize_node, const TensorShapeProto& input_shape,
+                         int64_t& output_height, int64_t& output_width) {
+  const auto* mode = graph_utils::GetNodeAttribute(resize_node, "mode");
+  if (mode == nullptr || mode->s() != "linear") {
+    return false;
+  }
+  const auto* coordinate_mode = graph_utils::GetNodeAttribute(resize_node, "coordinate_transformation_mode");
+  if (coordinate_mode != nullptr && coordinate_mode->s() != "half_pixel") {
+    return false;
+  }
+  if (!HasStaticDim(input_shape, 1) || !HasStaticDim(input_shape, 2)) {
+    return false;
+  }
+
+  const int64_t N = input_shape.dim(0).has_dim_value() ? input_shape.dim(0).dim_value() : -1;
+  const int64_t H = input_shape.dim(1).dim_value();
+  const int64_t W = input_shape.dim(2).dim_value();
+  const int64_t C = input_shape.dim(3).dim_value();
+  const auto& inputs = resize_node.InputDefs();
+
+  if (inputs.size() > 3 && inputs[3]->Exists()) {
+    const TensorProto* sizes = graph_utils::GetConstantInitializer(graph, inputs[3]->Name());
+    if (sizes == nullptr || sizes->data_type() != TensorProto::INT64) {
+      return false;
+    }
+    Initializer initializer(*sizes, graph.ModelPath());
+    const int64_t* data = initializer.data<int64_t>();
+    if (initializer.size() != 4 || data[0] != N || data[1] != C) {
+      return false;
+    }
+    output_height = data[2];
+    output_width = data[3];
+    return output_height > 0 && output_width > 0;
+  }
+
+  if (inputs.size() < 3 || !inputs[2]->Exists()) {
+    return false;
+  }
+  const TensorProto* scales = graph_utils::GetConstantInitializer(graph, inputs[2]->Name());
+  if (scales == nullptr || scales->data_type() != TensorProto::FLOAT) {
+    return false;
+  }
+  Initializer initializer(*scales, graph.ModelPath());
+  const float* data = initializer.data<float>();
+  if (initializer.size() != 4 || data[0] != 1.0f || data[1] != 1.0f) {
+    return false;
+  }
+
+  // Same rounding as Resize. ImagePreprocess derives the scales from the sizes so they must round trip.
+  output_height = static_cast<int64_t>(data[2] * H);
+  output_width = static_cast<int64_t>(data[3] * W);
+  return output_height > 0 && output_width > 0 &&
+         static_cast<float>(output_height) / static_cast<float>(H) == data[2] &&
+         static_cast<float>(output_width) / static_cast<float>(W) == data[3];
+}
+
+}  // namespace
+
+Status ImagePreprocessFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                        const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& cast_node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(cast_node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(cast_node, "Cast", {6, 9, 13}) ||
+        !graph_utils::IsSupportedProvider(cast_node, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::IsAttributeWithExpectedValue(cast_node, "to", static_cast<int64_t>(TensorProto::FLOAT))) {
+      continue;
+    }
+
+    const NodeArg& input = *cast_node.InputDefs()[0];
+    const TensorShapeProto* input_shape = input.Shape();
+    if (input.Type() == nullptr || *input.Type() != "tensor(uint8)" ||
+        input_shape == nullptr || input_shape->dim_size() != 4 || !HasStaticDim(*input_shape, 3)) {
+      continue;
+    }
+
+    const int64_t channels = input_shape->dim(3).dim_value();
+    std::vector<float> scale(static_cast<size_t>(channels), 1.0f);
+    std::vector<float> bias(static_cast<size_t>(channels), 0.0f);
+    int64_t output_height = 0;
+    int64_t output_width = 0;
+    bool transposed = false;
+
+    InlinedVector<std::reference_wrapper<Node>> nodes_to_fuse{cast_node};
+    const std::string& provider = cast_node.GetExecutionProviderType();
+
+    // Extend the chain while the last node has a single consumer that can be folded in. The chain must reach
+    // the Transpose to NCHW, and ends at the last node that was folded in.
+    while (optimizer_utils::CheckOutputEdges(graph, nodes_to_fuse.back(), 1)) {
+      const Node& last_node = nodes_to_fuse.back();
+      Node& next_node = *graph.GetNode(last_node.OutputNodesBegin()->Index());
+      const NodeArg& next_input = *last_node.OutputDefs()[0];
+      if (next_node.GetExecutionProviderType() != provider) {
+        break;
+      }
+
+      if (!transposed) {
+        if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Transpose", {1, 13})) {
+          InlinedVector<int64_t> perm;
+          if (!graph_utils::GetRepeatedNodeAttributeValues(next_node, "perm", perm) ||
+              perm != InlinedVector<int64_t>{0, 3, 1, 2}) {
+            break;
+          }
+          transposed = true;
+        } else if (!FoldElementwise(graph, next_node, next_input, 0, scale, bias)) {
+          break;
+        }
+      } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Resize", {11, 13})) {
+        if (output_height != 0 || next_node.InputDefs()[0] != &next_input ||
+            !GetResizeOutputSize(graph, next_node, *input_shape, output_height, output_width)) {
+          break;
+        }
+      } else if (!FoldElementwise(graph, next_node, next_input, 2, scale, bias)) {
+        break;
+      }
+
+      nodes_to_fuse.push_back(next_node);
+    }
+
+    if (!transposed) {
+      continue;
+    }
+    Node& last_node = nodes_to_fuse.back();
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("ImagePreprocess"),
+                                     "ImagePreprocess",
+                                     "fused image pre-processing",
+                                     {cast_node.MutableInputDefs()[0]},
+                                     {last_node.MutableOutputDefs()[0]},
+                                     {},
+                                     kMSDomain);
+    fused_node.AddAttribute("scale", scale);
+    fused_node.AddAttribute("bias", bias);
+    if (output_height != 0) {
+      fused_node.AddAttribute("output_height", output_height);
+      fused_node.AddAttribute("output_width", output_width);
+    }
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(provider);
+
+    graph_utils::FinalizeNodeFusion(graph, nodes_to_fuse, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
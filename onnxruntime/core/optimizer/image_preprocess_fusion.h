@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ImagePreprocessFusion
+Fuse the usual image pre-processing subgraph into an ImagePreprocess node.
+
+X(uint8, NHWC) --> Cast(float) --> [Sub|Div|Mul|Add]* --> Transpose(0,3,1,2) --> [Sub|Div|Mul|Add|Resize]*
+
+The elementwise nodes must have a constant float operand that is a scalar or holds one value per
+channel, and are folded into the per channel scale and bias of ImagePreprocess. At most one bilinear
+half_pixel Resize of the spatial axes is folded in, with sizes or scales known at optimization time.
+*/
+class ImagePreprocessFusion : public GraphTransformer {
+ public:
+  ImagePreprocessFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ImagePreprocessFusion", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
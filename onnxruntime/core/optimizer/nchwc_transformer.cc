@@ -127,6 +127,7 @@ class NchwcTransformerImpl {
   void TransformBatchNormalization(Node& node);
   void TransformTransposeToNhwc(Node& node);
   void TransformResize(Node& node);
+  void TransformRoiAlign(Node& node);
   void TrackTransposeFromNhwc(Node& node);
 
   Graph& graph_;
@@ -982,7 +983,7 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
     }
   }
 
-  const ONNX_NAMESPACE::AttributeProto* transformation_mode_attr = nullptr;
+  std::string transformation_mode;
 
   NodeArg* sizes_arg = nullptr;
   NodeArg* scales_arg = nullptr;
@@ -995,28 +996,46 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
       scales_arg = input_defs[2];
     }
 
-    transformation_mode_attr = graph_utils::GetNodeAttribute(node, "coordinate_transformation_mode");
-    if ((transformation_mode_attr == nullptr) ||
-        !utils::HasString(*transformation_mode_attr)) {
-      return;
-    }
-    if (transformation_mode_attr->s() != "asymmetric") {
-      // Nearest mode kernel support asymmetric transformation mode only.
-      if (nearest_mode) {
-        return;
-      }
-      if ((transformation_mode_attr->s() != "align_corners") &&
-          (transformation_mode_attr->s() != "half_pixel")) {
+    transformation_mode = "half_pixel";
+    const auto* transformation_mode_attr = graph_utils::GetNodeAttribute(node, "coordinate_transformation_mode");
+    if (transformation_mode_attr != nullptr) {
+      if (!utils::HasString(*transformation_mode_attr)) {
         return;
       }
+      transformation_mode = transformation_mode_attr->s();
     }
 
     if (nearest_mode) {
-      // Only support the floor rounding mode.
+      std::string rounding_mode = "round_prefer_floor";
       const auto* nearest_mode_attr = graph_utils::GetNodeAttribute(node, "nearest_mode");
-      if ((nearest_mode_attr == nullptr) ||
-          !utils::HasString(*nearest_mode_attr) ||
-          (nearest_mode_attr->s() != "floor")) {
+      if (nearest_mode_attr != nullptr) {
+        if (!utils::HasString(*nearest_mode_attr)) {
+          return;
+        }
+        rounding_mode = nearest_mode_attr->s();
+      }
+
+      // The nearest mode kernel maps output index o to input index floor(o / scale). With the integral scales
+      // required below, other modes select the same pixels: (o + 0.5) / scale floors to it and
+      // (o + 0.5) / scale - 0.5 is always less than 0.5 away from it.
+      bool floor_mapping = false;
+      if (transformation_mode == "asymmetric" || transformation_mode == "tf_half_pixel_for_nn") {
+        floor_mapping = (rounding_mode == "floor");
+      } else if (transformation_mode == "half_pixel" || transformation_mode == "pytorch_half_pixel") {
+        floor_mapping = (rounding_mode == "round_prefer_floor" || rounding_mode == "round_prefer_ceil");
+      }
+      if (!floor_mapping) {
+        return;
+      }
+    } else {
+      // pytorch_half_pixel only differs from half_pixel for an output length of 1, which with an integral scale
+      // is an unscaled dimension.
+      if (transformation_mode == "pytorch_half_pixel") {
+        transformation_mode = "half_pixel";
+      }
+      if ((transformation_mode != "asymmetric") &&
+          (transformation_mode != "align_corners") &&
+          (transformation_mode != "half_pixel")) {
         return;
       }
     }
@@ -1105,8 +1124,8 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
   nchwc_node.AddAttribute("scales", scales_attr);
   if (!nearest_mode) {
     nchwc_node.AddAttribute("mode", mode_attr->s());
-    if (transformation_mode_attr != nullptr) {
-      nchwc_node.AddAttribute("coordinate_transformation_mode", transformation_mode_attr->s());
+    if (!transformation_mode.empty()) {
+      nchwc_node.AddAttribute("coordinate_transformation_mode", transformation_mode);
     }
   }
 
@@ -1118,6 +1137,58 @@ void NchwcTransformerImpl::TransformResize(Node& node) {
   removed_nodes_.push_front(node.Index());
 }
 
+void NchwcTransformerImpl::TransformRoiAlign(Node& node) {
+  auto& input_defs = node.MutableInputDefs();
+  auto& output_defs = node.MutableOutputDefs();
+
+  // Don't transform the node if the input is not already in NCHWc format.
+  auto* nchwc_input = LookupNchwcArgument(input_defs[0]);
+  if (nchwc_input == nullptr) {
+    return;
+  }
+
+  // The RoiAlign output is usually much smaller than the feature map, so reorder
+  // the NCHWc input directly to NHWC and use the channels last RoiAlign instead
+  // of reordering the feature map back to NCHW.
+  auto* nhwc_input_arg = &graph_.GetOrCreateNodeArg(graph_.GenerateNodeArgName("reorder"), nullptr);
+  Node& reorder_output_node = graph_.AddNode(graph_.GenerateNodeName("ReorderOutput"),
+                                             "ReorderOutput",
+                                             "ReorderOutput",
+                                             std::array<NodeArg*, 1>{nchwc_input->nchwc_arg_},
+                                             std::array<NodeArg*, 1>{nhwc_input_arg},
+                                             nullptr,
+                                             kMSNchwcDomain);
+  reorder_output_node.SetExecutionProviderType(kCpuExecutionProvider);
+  reorder_output_node.AddAttribute("channels", nchwc_input->channels_);
+  reorder_output_node.AddAttribute("channels_last", static_cast<int64_t>(1));
+
+  auto* nhwc_output_arg = &graph_.GetOrCreateNodeArg(graph_.GenerateNodeArgName("RoiAlign"), nullptr);
+  std::string nhwc_node_name = graph_.GenerateNodeName(output_defs[0]->Name() + "_nhwc");
+  Node& nhwc_node = graph_.AddNode(nhwc_node_name,
+                                   "RoiAlign",
+                                   nhwc_node_name,
+                                   std::array{nhwc_input_arg, input_defs[1], input_defs[2]},
+                                   std::array<NodeArg*, 1>{nhwc_output_arg},
+                                   &node.GetAttributes(),
+                                   kMSDomain);
+  nhwc_node.SetExecutionProviderType(kCpuExecutionProvider);
+  nhwc_node.AddAttribute("channels_last", static_cast<int64_t>(1));
+
+  Node& transpose_node = graph_.AddNode(graph_.GenerateNodeName("Transpose"),
+                                        "Transpose",
+                                        "Transpose",
+                                        std::array<NodeArg*, 1>{nhwc_output_arg},
+                                        output_defs);
+  transpose_node.SetExecutionProviderType(kCpuExecutionProvider);
+  transpose_node.AddAttribute("perm", std::vector<int64_t>{0, 3, 1, 2});
+
+  nchwc_input->remaining_original_uses_--;
+
+  graph_utils::RemoveNodeOutputEdges(graph_, node);
+
+  removed_nodes_.push_front(node.Index());
+}
+
 void NchwcTransformerImpl::TrackTransposeFromNhwc(Node& node) {
   const auto* perm_attr = graph_utils::GetNodeAttribute(node, "perm");
   if (perm_attr == nullptr || perm_attr->ints_size() != 4) {
@@ -1151,6 +1222,10 @@ void NchwcTransformerImpl::Transform(Node& node) {
   } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "MaxPool", {1, 8, 10, 11, 12}) ||
              graph_utils::IsSupportedOptypeVersionAndDomain(node, "AveragePool", {1, 7, 10, 11})) {
     TransformPool(node);
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(node, "RoiAlign", {10, 16})) {
+    // The rois and batch_indices inputs are not produced by NCHWc nodes, so
+    // this can't wait for the input edge count to drop to zero.
+    TransformRoiAlign(node);
   } else if (node.GetInputEdgesCount() == 0 && node.InputDefs().size() != 0) {
     // The following transforms only run when the input edge count has already
     // been decremented to zero by earlier transforms. This is a hint that the
@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/reduce_mean_sub_pow_fusion.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+#include <algorithm>
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+bool IsFloatTensor(const NodeArg& node_arg) {
+  return node_arg.Type() != nullptr && *node_arg.Type() == "tensor(float)";
+}
+
+// Returns the first reduced axis if the ReduceMean node keeps its dims and reduces a trailing run of
+// axes, i.e. [axis, rank), which is what ReduceMeanSubPow computes.
+bool GetTrailingReduceAxis(const Node& reduce_mean_node, int64_t& axis) {
+  if (graph_utils::GetNodeAttribute(reduce_mean_node, "keepdims") != nullptr &&
+      !optimizer_utils::IsAttributeWithExpectedValue(reduce_mean_node, "keepdims", static_cast<int64_t>(1))) {
+    return false;
+  }
+
+  const TensorShapeProto* input_shape = reduce_mean_node.InputDefs()[0]->Shape();
+  if (input_shape == nullptr || input_shape->dim_size() < 1) {
+    return false;
+  }
+  const int64_t rank = input_shape->dim_size();
+
+  InlinedVector<int64_t> axes;
+  if (!graph_utils::GetRepeatedNodeAttributeValues(reduce_mean_node, "axes", axes) || axes.empty()) {
+    // No axes means all of them are reduced.
+    axis = 0;
+    return true;
+  }
+
+  for (auto& a : axes) {
+    if (a < -rank || a >= rank) {
+      return false;
+    }
+    a = a < 0 ? a + rank : a;
+  }
+  std::sort(axes.begin(), axes.end());
+
+  const int64_t first = rank - static_cast<int64_t>(axes.size());
+  for (size_t i = 0; i < axes.size(); ++i) {
+    if (axes[i] != first + static_cast<int64_t>(i)) {
+      return false;
+    }
+  }
+
+  axis = first;
+  return true;
+}
+
+bool IsSquareExponent(const Graph& graph, const NodeArg& exponent) {
+  return optimizer_utils::IsInitializerWithExpectedValue(graph, exponent, 2.0f, true) ||
+         optimizer_utils::IsInitializerWithExpectedValue(graph, exponent, static_cast<int64_t>(2), true);
+}
+
+}  // namespace
+
+Status ReduceMeanSubPowFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                         const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& reduce_mean_node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(reduce_mean_node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(reduce_mean_node, "ReduceMean", {1, 11, 13}) ||
+        !graph_utils::IsSupportedProvider(reduce_mean_node, GetCompatibleExecutionProviders()) ||
+        !optimizer_utils::CheckOutputEdges(graph, reduce_mean_node, 1) ||
+        !IsFloatTensor(*reduce_mean_node.InputDefs()[0])) {
+      continue;
+    }
+
+    int64_t axis = 0;
+    if (!GetTrailingReduceAxis(reduce_mean_node, axis)) {
+      continue;
+    }
+
+    // ReduceMean --> Sub, computing X - mean(X)
+    Node& sub_node = *graph.GetNode(reduce_mean_node.OutputNodesBegin()->Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(sub_node, "Sub", {7, 13, 14}) ||
+        sub_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
+        sub_node.InputDefs()[0] != reduce_mean_node.InputDefs()[0] ||
+        sub_node.InputDefs()[1] != reduce_mean_node.OutputDefs()[0] ||
+        graph.NodeProducesGraphOutput(sub_node)) {
+      continue;
+    }
+
+    // Sub --> Pow, squaring the centered values
+    Node* p_pow_node = nullptr;
+    for (auto it = sub_node.OutputNodesBegin(); it != sub_node.OutputNodesEnd(); ++it) {
+      const Node& next_node = *it;
+      if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Pow", {7, 12, 13, 15}) &&
+          next_node.GetExecutionProviderType() == reduce_mean_node.GetExecutionProviderType() &&
+          next_node.InputDefs()[0] == sub_node.OutputDefs()[0] &&
+          IsSquareExponent(graph, *next_node.InputDefs()[1]) &&
+          !graph.NodeProducesGraphOutput(next_node)) {
+        p_pow_node = graph.GetNode(next_node.Index());
+        break;
+      }
+    }
+    if (p_pow_node == nullptr) {
+      continue;
+    }
+    Node& pow_node = *p_pow_node;
+
+    NodeArg* input = reduce_mean_node.MutableInputDefs()[0];
+    NodeArg& centered = graph_utils::CreateNodeArg(graph, *sub_node.MutableOutputDefs()[0]);
+    NodeArg& squared = graph_utils::CreateNodeArg(graph, *pow_node.MutableOutputDefs()[0]);
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("ReduceMeanSubPow"),
+                                     "ReduceMeanSubPow",
+                                     "fused ReduceMean, Sub and Pow",
+                                     {input},
+                                     {&centered, &squared},
+                                     {},
+                                     kMSDomain);
+    fused_node.AddAttribute("axis", axis);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(reduce_mean_node.GetExecutionProviderType());
+
+    const Node::EdgeEnd* input_edge = graph_utils::GetInputEdge(reduce_mean_node, 0);
+    if (input_edge != nullptr) {
+      graph.AddEdge(input_edge->GetNode().Index(), fused_node.Index(), input_edge->GetSrcArgIndex(), 0);
+    }
+
+    // Move the consumers of Pow and then of Sub (which no longer include Pow) to the fused node.
+    graph_utils::ReplaceDownstreamNodeInput(graph, pow_node, 0, fused_node, 1);
+    graph.RemoveNode(pow_node.Index());
+
+    graph_utils::ReplaceDownstreamNodeInput(graph, sub_node, 0, fused_node, 0);
+    graph.RemoveNode(sub_node.Index());
+
+    graph_utils::RemoveNodeOutputEdges(graph, reduce_mean_node);
+    graph.RemoveNode(reduce_mean_node.Index());
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
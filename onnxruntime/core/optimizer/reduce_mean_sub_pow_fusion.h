@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ReduceMeanSubPowFusion
+Fuse ReduceMean + Sub + Pow(2) over the trailing axes into a ReduceMeanSubPow node.
+
+X --> ReduceMean --> Sub --> Pow(2)
+ \__________________/
+
+The pattern is the head of an unfused layer normalization. It is left behind when the rest of the
+subgraph does not match LayerNormFusion, so this transformer must run after it.
+*/
+class ReduceMeanSubPowFusion : public GraphTransformer {
+ public:
+  ReduceMeanSubPowFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ReduceMeanSubPowFusion", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
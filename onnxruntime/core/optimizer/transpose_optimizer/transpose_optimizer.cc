@@ -1622,6 +1622,31 @@ static bool HandleMaxPool(HandlerArgs& args) {
 
 constexpr HandlerInfo max_pool_op_handler = {&FirstInput, &HandleMaxPool};
 
+static bool HandleRoiAlign(HandlerArgs& args) {
+  // For CPU EP replace with the com.microsoft RoiAlign which supports the channels_last attribute. Only float is
+  // supported in NHWC layout.
+  if (args.node.GetExecutionProviderType() != "CPUExecutionProvider") {
+    return false;
+  }
+
+  auto info = args.ctx.graph.GetValueInfo(args.node.Outputs()[0]);
+  if (info->DType() != api::DataType::FLOAT) {
+    return false;
+  }
+
+  if (args.perm.size() != 4 || args.perm != ChannelLastToFirstPerm(4)) {
+    return false;
+  }
+
+  auto new_node = SwapNodeOpTypeAndDomain(args.ctx.graph, args.node, "RoiAlign", "com.microsoft");
+  new_node->SetAttributeInt("channels_last", 1);
+  TransposeFirstInput(args.ctx, *new_node, args.perm_inv);
+  TransposeOutputs(args.ctx, *new_node, args.perm);
+  return true;
+}
+
+constexpr HandlerInfo roi_align_op_handler = {&FirstInput, &HandleRoiAlign};
+
 // TODO: check binary size of this and replace it with constexpr if large
 static const std::unordered_map<std::string_view, const HandlerInfo&> handler_map{
 
@@ -1737,7 +1762,9 @@ static const std::unordered_map<std::string_view, const HandlerInfo&> extended_h
     {"com.microsoft.QLinearMul", q_linear_binary_op_handler},
     {"com.microsoft.QLinearAveragePool", q_linear_pool_op_handler},
     {"com.microsoft.QLinearGlobalAveragePool", q_linear_pool_op_handler},
+    {"com.microsoft.RoiAlign", q_linear_pool_op_handler},
     {"MaxPool", max_pool_op_handler},
+    {"RoiAlign", roi_align_op_handler},
 };
 
 static const HandlerInfo* GetHandler(api::NodeRef& node, bool allow_extended_ops) {
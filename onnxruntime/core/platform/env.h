@@ -79,6 +79,10 @@ struct ThreadOptions {
   void* custom_thread_creation_options = nullptr;
   OrtCustomJoinThreadFn custom_join_thread_fn = nullptr;
   int dynamic_block_base_ = 0;
+
+  // If true (and spinning is allowed), each worker adapts how long it spins before blocking to the idle gaps
+  // it observed between tasks, instead of always spinning for a fixed number of iterations.
+  bool adaptive_spinning = false;
 };
 /// \brief An interface used by the onnxruntime implementation to
 /// access operating system functionality like the filesystem etc.
@@ -122,6 +126,22 @@ class Env {
   // This function doesn't support systems with more than 64 logical processors
   virtual std::vector<size_t> GetThreadAffinityMasks() const = 0;
 
+  /// \brief Returns the logical processors of each NUMA node that this process may run on, indexed by node.
+  /// A node has no processors when the process may not run on any of them.
+  /// Returns an empty vector when the topology is not known.
+  virtual std::vector<std::vector<size_t>> GetNumaNodeProcessors() const {
+    return {};
+  }
+
+  /// \brief Asks the OS to place the pages of [p, p + size) on a NUMA node when they are first touched,
+  /// whichever thread touches them. Only pages entirely inside the range are affected.
+  /// This is a hint and does nothing where it is not supported.
+  virtual void SetPreferredNumaNode(void* p, size_t size, int numa_node) const {
+    ORT_UNUSED_PARAMETER(p);
+    ORT_UNUSED_PARAMETER(size);
+    ORT_UNUSED_PARAMETER(numa_node);
+  }
+
   /// \brief Returns the number of micro-seconds since the Unix epoch.
   virtual uint64_t NowMicros() const {
     return env_time_->NowMicros();
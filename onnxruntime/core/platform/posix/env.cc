@@ -31,6 +31,11 @@ limitations under the License.
 #include <utility>  // for std::forward
 #include <vector>
 #include <assert.h>
+#include <fstream>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <sched.h>
+#endif
 
 #include "core/common/common.h"
 #include "core/common/logging/logging.h"
@@ -43,6 +48,30 @@ namespace {
 
 constexpr int OneMillion = 1000000;
 
+#if defined(__linux__)
+// Parses a sysfs cpu or node list such as "0-3,8-11".
+std::vector<size_t> ParseSysfsList(const std::string& path) {
+  std::vector<size_t> ids;
+  std::ifstream file(path);
+  std::string range;
+  while (std::getline(file, range, ',')) {
+    size_t first = 0;
+    size_t last = 0;
+    const int count = sscanf(range.c_str(), "%zu-%zu", &first, &last);
+    if (count < 1) {
+      break;
+    }
+    if (count == 1) {
+      last = first;
+    }
+    for (size_t id = first; id <= last; ++id) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+#endif
+
 class UnmapFileParam {
  public:
   void* addr;
@@ -166,6 +195,12 @@ class PosixThread : public EnvThread {
           ORT_THROW("pthread_attr_setstacksize failed, error code: ", err_no, " error msg: ", err_msg);
         }
       }
+#if !defined(__APPLE__) && !defined(__ANDROID__) && !defined(__wasm__)
+      if (!thread_options.affinity.empty() && thread_options.affinity[index] >= CPU_SETSIZE) {
+        ORT_THROW("Processor ", thread_options.affinity[index], " is beyond the ", CPU_SETSIZE,
+                  " processors a thread can be pinned to");
+      }
+#endif
       s = pthread_create(&hThread, &attr, ThreadMain,
                          new Param{name_prefix, index, start_address, param, thread_options});
       if (s != 0) {
@@ -246,6 +281,55 @@ class PosixEnv : public Env {
     return ret;
   }
 
+  std::vector<std::vector<size_t>> GetNumaNodeProcessors() const override {
+    std::vector<std::vector<size_t>> nodes;
+#if defined(__linux__)
+    // Only the processors this process may run on, e.g. under taskset or a cgroup cpuset. Threads are pinned
+    // through a cpu_set_t, so processors beyond CPU_SETSIZE are left out too.
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    const bool allowed_known = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+    for (size_t node : ParseSysfsList("/sys/devices/system/node/online")) {
+      if (node >= nodes.size()) {
+        nodes.resize(node + 1);
+      }
+      for (size_t cpu : ParseSysfsList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist")) {
+        if (cpu < CPU_SETSIZE && (!allowed_known || CPU_ISSET(cpu, &allowed))) {
+          nodes[node].push_back(cpu);
+        }
+      }
+    }
+#endif
+    return nodes;
+  }
+
+  void SetPreferredNumaNode(void* p, size_t size, int numa_node) const override {
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr int kMpolPreferred = 1;
+    constexpr size_t kBitsPerMask = sizeof(unsigned long) * 8;
+    if (numa_node < 0) {
+      return;
+    }
+
+    const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const uintptr_t begin = (reinterpret_cast<uintptr_t>(p) + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end = (reinterpret_cast<uintptr_t>(p) + size) & ~(page_size - 1);
+    if (begin >= end) {
+      return;
+    }
+
+    std::vector<unsigned long> node_mask(static_cast<size_t>(numa_node) / kBitsPerMask + 1, 0);
+    node_mask[static_cast<size_t>(numa_node) / kBitsPerMask] = 1UL << (static_cast<size_t>(numa_node) % kBitsPerMask);
+    // Failures leave the placement to the default first touch policy
+    syscall(SYS_mbind, reinterpret_cast<void*>(begin), end - begin, kMpolPreferred, node_mask.data(),
+            node_mask.size() * kBitsPerMask + 1, 0);
+#else
+    ORT_UNUSED_PARAMETER(p);
+    ORT_UNUSED_PARAMETER(size);
+    ORT_UNUSED_PARAMETER(numa_node);
+#endif
+  }
+
   void SleepForMicroseconds(int64_t micros) const override {
     while (micros > 0) {
       timespec sleep_time;
@@ -12,6 +12,8 @@ namespace onnxruntime {
 // Information needed to construct CPU execution providers.
 struct CPUExecutionProviderInfo {
   bool create_arena{true};
+  // NUMA node the memory of the allocator is placed on. -1 leaves the placement to the OS.
+  int numa_node{-1};
 
   explicit CPUExecutionProviderInfo(bool use_arena)
       : create_arena(use_arena) {}
@@ -37,7 +39,8 @@ class CPUExecutionProvider : public IExecutionProvider {
     create_arena = false;
 #endif
 
-    AllocatorCreationInfo device_info{[](int) { return std::make_unique<CPUAllocator>(); },
+    const int numa_node = info.numa_node;
+    AllocatorCreationInfo device_info{[numa_node](int) { return std::make_unique<CPUAllocator>(numa_node); },
                                       0, create_arena};
 
     InsertAllocator(CreateAllocator(device_info));
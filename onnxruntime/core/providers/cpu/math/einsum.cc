@@ -45,12 +45,19 @@ Status Einsum::Compute(OpKernelContext* context) const {
 
 Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const Tensor*>& inputs,
                              AllocatorPtr allocator, concurrency::ThreadPool* tp) const {
+  // The CPU Transpose helper splits the transposes across the kernel's thread pool
+  auto transpose_func = [tp](const gsl::span<const size_t>& permutation, const Tensor& input, Tensor& output,
+                             const TensorShape* input_shape_override, void* einsum_cuda_assets) {
+    return EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose(permutation, input, output, input_shape_override,
+                                                                einsum_cuda_assets, tp);
+  };
+
   // EinsumComputePreprocessor section -
   auto einsum_compute_preprocessor =
       EinsumComputePreprocessor(*einsum_equation_preprocessor_, inputs, allocator, nullptr);
 
   einsum_compute_preprocessor.SetDeviceHelpers(EinsumOp::DeviceHelpers::CpuDeviceHelpers::Diagonal,
-                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose);
+                                               transpose_func);
   // Compute all required metadata to be used at Einsum compute time and return error status code if one was generated
   ORT_RETURN_IF_ERROR(einsum_compute_preprocessor.Run());
 
@@ -62,10 +69,11 @@ Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const T
                                                                        nullptr);
 
     // Set device specific methods (CPU methods) to be used during processing
-    einsum_compute_processor.SetDeviceHelpers(EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose,
+    einsum_compute_processor.SetDeviceHelpers(transpose_func,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::MatMul<float>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::ReduceSum<float>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::DataCopy);
+    einsum_compute_processor.SetContractionPathCache(&contraction_path_cache_);
     return einsum_compute_processor.Run();
   } else if (inputs[0]->IsDataType<int32_t>()) {
     auto einsum_compute_processor = EinsumTypedComputeProcessor<int32_t>(context,
@@ -75,10 +83,11 @@ Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const T
                                                                          nullptr);
 
     // Set device specific methods (CPU methods) to be used during processing
-    einsum_compute_processor.SetDeviceHelpers(EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose,
+    einsum_compute_processor.SetDeviceHelpers(transpose_func,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::MatMul<int32_t>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::ReduceSum<int32_t>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::DataCopy);
+    einsum_compute_processor.SetContractionPathCache(&contraction_path_cache_);
 
     return einsum_compute_processor.Run();
   } else if (inputs[0]->IsDataType<double>()) {
@@ -89,10 +98,11 @@ Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const T
                                                                         nullptr);
 
     // Set device specific methods (CPU methods) to be used during processing
-    einsum_compute_processor.SetDeviceHelpers(EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose,
+    einsum_compute_processor.SetDeviceHelpers(transpose_func,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::MatMul<double>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::ReduceSum<double>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::DataCopy);
+    einsum_compute_processor.SetContractionPathCache(&contraction_path_cache_);
     return einsum_compute_processor.Run();
   } else if (inputs[0]->IsDataType<int64_t>()) {
     auto einsum_compute_processor = EinsumTypedComputeProcessor<int64_t>(context,
@@ -101,10 +111,11 @@ Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const T
                                                                          einsum_compute_preprocessor,
                                                                          nullptr);
 
-    einsum_compute_processor.SetDeviceHelpers(EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose,
+    einsum_compute_processor.SetDeviceHelpers(transpose_func,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::MatMul<int64_t>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::ReduceSum<int64_t>,
                                               EinsumOp::DeviceHelpers::CpuDeviceHelpers::DataCopy);
+    einsum_compute_processor.SetContractionPathCache(&contraction_path_cache_);
 
     return einsum_compute_processor.Run();
   }
@@ -3,6 +3,8 @@
 
 #include "einsum_auxiliary_ops.h"
 
+#include "core/mlas/inc/mlas.h"
+
 using namespace onnxruntime::common;
 
 namespace onnxruntime {
@@ -24,8 +26,9 @@ Status DataCopy(const Tensor& input, Tensor& output, void* /*einsum_cuda_assets*
 
 // CPU specific Transpose helper
 Status Transpose(const gsl::span<const size_t>& permutation, const Tensor& input,
-                 Tensor& output, const TensorShape* input_shape_override, void* /*einsum_cuda_assets*/) {
-  return TransposeBase::DoTranspose(permutation, input, output, input_shape_override);
+                 Tensor& output, const TensorShape* input_shape_override, void* /*einsum_cuda_assets*/,
+                 concurrency::ThreadPool* tp) {
+  return TransposeBase::DoTranspose(permutation, input, output, input_shape_override, tp);
 }
 
 // CPU specific MatMul helper
@@ -34,14 +37,38 @@ Status MatMul(const T* input_1_data, const T* input_2_data, T* output_data,
               size_t left_stride, size_t right_stride, size_t output_stride,
               size_t num_batches, size_t M, size_t K, size_t N, concurrency::ThreadPool* tp,
               void* /*einsum_cuda_assets*/) {
-  for (size_t i = 0; i < num_batches; ++i) {
-    math::MatMul<T>(
-        static_cast<int>(M),
-        static_cast<int>(N),
-        static_cast<int>(K),
-        input_1_data + i * left_stride,
-        input_2_data + i * right_stride,
-        output_data + i * output_stride, tp);
+#ifdef MLAS_SUPPORTS_GEMM_DOUBLE
+  constexpr bool is_mlas_gemm_type = std::is_same<T, float>::value || std::is_same<T, double>::value;
+#else
+  constexpr bool is_mlas_gemm_type = std::is_same<T, float>::value;
+#endif
+  if constexpr (is_mlas_gemm_type) {
+    // Hand all the batches to MLAS in one call so that the work is partitioned across the batches
+    // as well as within each of them (a single small matrix product doesn't keep the thread pool busy)
+    using GemmDataParams = typename std::conditional<std::is_same<T, float>::value,
+                                                     MLAS_SGEMM_DATA_PARAMS, MLAS_DGEMM_DATA_PARAMS>::type;
+    std::vector<GemmDataParams> data(num_batches);
+    for (size_t i = 0; i < num_batches; ++i) {
+      data[i].A = input_1_data + i * left_stride;
+      data[i].lda = K;
+      data[i].B = input_2_data + i * right_stride;
+      data[i].ldb = N;
+      data[i].C = output_data + i * output_stride;
+      data[i].ldc = N;
+      data[i].alpha = 1;
+      data[i].beta = 0;
+    }
+    MlasGemmBatch(CblasNoTrans, CblasNoTrans, M, N, K, data.data(), num_batches, tp);
+  } else {
+    for (size_t i = 0; i < num_batches; ++i) {
+      math::MatMul<T>(
+          static_cast<int>(M),
+          static_cast<int>(N),
+          static_cast<int>(K),
+          input_1_data + i * left_stride,
+          input_2_data + i * right_stride,
+          output_data + i * output_stride, tp);
+    }
   }
 
   return Status::OK();
@@ -212,9 +239,17 @@ std::unique_ptr<Tensor> Diagonal(const Tensor& input, int64_t dim_1, int64_t dim
       }
     }
 
+    // Pass in CPU Transpose function here as this Diagonal method will only be used for CPU based diagonal parsing
+    // (Diagonal has no thread pool, so the transposes run on the calling thread)
+    auto cpu_transpose = [](const gsl::span<const size_t>& transpose_perm, const Tensor& transpose_input,
+                            Tensor& transpose_output, const TensorShape* input_shape_override,
+                            void* einsum_cuda_assets) {
+      return Transpose(transpose_perm, transpose_input, transpose_output, input_shape_override, einsum_cuda_assets,
+                       nullptr);
+    };
+
     // Permutate the input so that the dims from which we need the diagonal forms the innermost dims
-    // (Pass in CPU Transpose function here as this Diagonal method will only be used for CPU based diagonal parsing)
-    auto transposed = EinsumOp::Transpose(input, input_dims, permutation, allocator, nullptr, Transpose);
+    auto transposed = EinsumOp::Transpose(input, input_dims, permutation, allocator, nullptr, cpu_transpose);
 
     // Parse the diagonal from the innermost dims
     output = DiagonalInnermostDims(*transposed, preserve_innermost_dim_val, allocator);
@@ -229,8 +264,8 @@ std::unique_ptr<Tensor> Diagonal(const Tensor& input, int64_t dim_1, int64_t dim
     }
 
     // Permutate using the reverse permutation to get back the original axes ordering
-    // (Pass in CPU Transpose function here as this Diagonal method will only be used for CPU based diagonal parsing)
-    output = EinsumOp::Transpose(*output, output->Shape().GetDims(), reverse_permutation, allocator, nullptr, Transpose);
+    output = EinsumOp::Transpose(*output, output->Shape().GetDims(), reverse_permutation, allocator, nullptr,
+                                 cpu_transpose);
   } else {
     // No transposing required
     output = DiagonalInnermostDims(input, preserve_innermost_dim_val, allocator);
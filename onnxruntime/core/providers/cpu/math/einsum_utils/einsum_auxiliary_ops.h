@@ -63,8 +63,11 @@ namespace CpuDeviceHelpers {
 
 Status DataCopy(const Tensor& input, Tensor& output, void* einsum_cuda_assets);
 
+// Splits the transpose across the threads of `tp` when it is provided.
+// Bind `tp` to get a DeviceHelpers::Transpose.
 Status Transpose(const gsl::span<const size_t>& permutation, const Tensor& input,
-                 Tensor& output, const TensorShape* input_shape_override, void* einsum_cuda_assets);
+                 Tensor& output, const TensorShape* input_shape_override, void* einsum_cuda_assets,
+                 concurrency::ThreadPool* tp);
 
 template <typename T>
 Status MatMul(const T* input_1_data, const T* input_2_data, T* output_data,
@@ -60,6 +60,10 @@ int64_t EinsumComputePreprocessor::GetNumSubscriptIndices() const {
   return num_subscript_indices_;
 }
 
+const std::vector<std::vector<int64_t>>& EinsumComputePreprocessor::GetInputSubscriptIndices() const {
+  return input_subscript_indices_;
+}
+
 void EinsumComputePreprocessor::SetDeviceHelpers(const EinsumOp::DeviceHelpers::Diagonal& device_diagonal_func,
                                                  const EinsumOp::DeviceHelpers::Transpose& device_transpose_func) {
   device_diagonal_func_ = device_diagonal_func;
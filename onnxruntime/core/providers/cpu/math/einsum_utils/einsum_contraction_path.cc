@@ -0,0 +1,202 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "einsum_contraction_path.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace onnxruntime {
+
+namespace EinsumOp {
+
+namespace {
+
+// Up to this many inputs all pairings are tried (5 inputs => 180 orders), beyond it the search is greedy
+constexpr size_t kMaxInputsForOptimalSearch = 5;
+
+// The search tracks the subscript indices present in each operand as a bit mask
+constexpr int64_t kMaxSubscriptIndicesForSearch = 64;
+
+class ContractionPathSearch {
+ public:
+  ContractionPathSearch(std::vector<double> label_sizes, uint64_t output_labels)
+      : label_sizes_(std::move(label_sizes)), output_labels_(output_labels) {}
+
+  // Number of multiply-adds needed to contract two operands that between them hold `labels`
+  double Cost(uint64_t labels) const {
+    double cost = 1.0;
+    for (size_t i = 0; i < label_sizes_.size(); ++i) {
+      if (labels & (uint64_t{1} << i)) {
+        cost *= label_sizes_[i];
+      }
+    }
+    return cost;
+  }
+
+  // Labels that survive contracting operands[left] with operands[right]: the ones
+  // still needed by the output or by any of the other pending operands
+  uint64_t ContractedLabels(const std::vector<uint64_t>& operands, size_t left, size_t right) const {
+    uint64_t needed = output_labels_;
+    for (size_t i = 0; i < operands.size(); ++i) {
+      if (i != left && i != right) {
+        needed |= operands[i];
+      }
+    }
+    return (operands[left] | operands[right]) & needed;
+  }
+
+  static std::vector<uint64_t> Contract(const std::vector<uint64_t>& operands, size_t left, size_t right,
+                                        uint64_t result) {
+    std::vector<uint64_t> next;
+    next.reserve(operands.size() - 1);
+    for (size_t i = 0; i < operands.size(); ++i) {
+      if (i != left && i != right) {
+        next.push_back(operands[i]);
+      }
+    }
+    next.push_back(result);
+    return next;
+  }
+
+  double PathCost(std::vector<uint64_t> operands, const ContractionPath& path) const {
+    double cost = 0.0;
+    for (const auto& step : path) {
+      cost += Cost(operands[step.first] | operands[step.second]);
+      operands = Contract(operands, step.first, step.second, ContractedLabels(operands, step.first, step.second));
+    }
+    return cost;
+  }
+
+  void SearchOptimal(const std::vector<uint64_t>& operands, double cost_so_far, ContractionPath& current,
+                     double& best_cost, ContractionPath& best_path) const {
+    if (operands.size() == 1) {
+      if (cost_so_far < best_cost) {
+        best_cost = cost_so_far;
+        best_path = current;
+      }
+      return;
+    }
+
+    for (size_t left = 0; left < operands.size(); ++left) {
+      for (size_t right = left + 1; right < operands.size(); ++right) {
+        double cost = cost_so_far + Cost(operands[left] | operands[right]);
+        // Every further step only adds to the cost
+        if (cost >= best_cost) {
+          continue;
+        }
+        current.emplace_back(left, right);
+        SearchOptimal(Contract(operands, left, right, ContractedLabels(operands, left, right)),
+                      cost, current, best_cost, best_path);
+        current.pop_back();
+      }
+    }
+  }
+
+  ContractionPath SearchGreedy(std::vector<uint64_t> operands) const {
+    ContractionPath path;
+    while (operands.size() > 1) {
+      size_t best_left = 0;
+      size_t best_right = 1;
+      uint64_t best_result = 0;
+      double best_cost = std::numeric_limits<double>::max();
+      double best_result_size = std::numeric_limits<double>::max();
+
+      for (size_t left = 0; left < operands.size(); ++left) {
+        for (size_t right = left + 1; right < operands.size(); ++right) {
+          uint64_t result = ContractedLabels(operands, left, right);
+          double cost = Cost(operands[left] | operands[right]);
+          double result_size = Cost(result);
+          // Cheapest contraction first, the one producing the smaller intermediate on a tie
+          if (cost < best_cost || (cost == best_cost && result_size < best_result_size)) {
+            best_left = left;
+            best_right = right;
+            best_result = result;
+            best_cost = cost;
+            best_result_size = result_size;
+          }
+        }
+      }
+
+      path.emplace_back(best_left, best_right);
+      operands = Contract(operands, best_left, best_right, best_result);
+    }
+    return path;
+  }
+
+ private:
+  std::vector<double> label_sizes_;
+  uint64_t output_labels_;
+};
+
+}  // namespace
+
+ContractionPath GetLeftToRightContractionPath(size_t num_inputs) {
+  ContractionPath path;
+  if (num_inputs < 2) {
+    return path;
+  }
+
+  path.reserve(num_inputs - 1);
+  // The first two inputs, then the running result (always the last pending operand) with the next input
+  // (always the first pending operand)
+  path.emplace_back(0, 1);
+  for (size_t pending = num_inputs - 1; pending > 1; --pending) {
+    path.emplace_back(pending - 1, 0);
+  }
+  return path;
+}
+
+ContractionPath ComputeContractionPath(const std::vector<std::vector<int64_t>>& input_subscript_indices,
+                                       const std::vector<TensorShape>& homogenized_input_dims,
+                                       const std::vector<int64_t>& subscript_indices_to_output_indices) {
+  const size_t num_inputs = input_subscript_indices.size();
+  ContractionPath left_to_right = GetLeftToRightContractionPath(num_inputs);
+
+  const int64_t num_subscript_indices = static_cast<int64_t>(subscript_indices_to_output_indices.size());
+  if (num_inputs < 3 || num_subscript_indices > kMaxSubscriptIndicesForSearch) {
+    return left_to_right;
+  }
+
+  std::vector<double> label_sizes(static_cast<size_t>(num_subscript_indices), 1.0);
+  std::vector<uint64_t> operands(num_inputs, 0);
+  for (size_t input = 0; input < num_inputs; ++input) {
+    for (auto subscript_index : input_subscript_indices[input]) {
+      operands[input] |= uint64_t{1} << subscript_index;
+    }
+    const auto dims = homogenized_input_dims[input].GetDims();
+    for (size_t i = 0; i < dims.size(); ++i) {
+      label_sizes[i] = std::max(label_sizes[i], static_cast<double>(dims[i]));
+    }
+  }
+
+  uint64_t output_labels = 0;
+  for (int64_t i = 0; i < num_subscript_indices; ++i) {
+    if (subscript_indices_to_output_indices[i] != -1) {
+      output_labels |= uint64_t{1} << i;
+    }
+  }
+
+  ContractionPathSearch search(std::move(label_sizes), output_labels);
+
+  // Only switch away from the left-to-right order if doing so is strictly cheaper
+  double best_cost = search.PathCost(operands, left_to_right);
+  ContractionPath best_path = left_to_right;
+
+  if (num_inputs <= kMaxInputsForOptimalSearch) {
+    ContractionPath current;
+    current.reserve(num_inputs - 1);
+    search.SearchOptimal(operands, 0.0, current, best_cost, best_path);
+  } else {
+    ContractionPath greedy_path = search.SearchGreedy(operands);
+    if (search.PathCost(operands, greedy_path) < best_cost) {
+      best_path = std::move(greedy_path);
+    }
+  }
+
+  return best_path;
+}
+
+}  // namespace EinsumOp
+
+}  // namespace onnxruntime
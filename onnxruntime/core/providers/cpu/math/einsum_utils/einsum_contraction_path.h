@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// This module hosts the following abstractions -
+
+// 1) ComputeContractionPath - Picks the order in which the operands of an Einsum node are contracted pair-wise.
+
+// 2) ContractionPathCache - Remembers the contraction order per input-shape signature so that the search
+//    runs only once per signature for a given Einsum node.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "core/platform/ort_mutex.h"
+
+#ifndef SHARED_PROVIDER
+#include "core/framework/tensor_shape.h"
+#endif
+
+namespace onnxruntime {
+
+namespace EinsumOp {
+
+// The pair-wise contractions to perform, in order (this mirrors opt_einsum's contraction list).
+// Each step names the positions of the (left, right) operands in the list of pending operands.
+// Both are removed from the list and the result of contracting them is appended to the end of it.
+// The pending operand list starts out as the inputs to the Einsum node in the order they are given.
+using ContractionPath = std::vector<std::pair<size_t, size_t>>;
+
+// Contraction paths are cached per Einsum node keyed by the (homogenized) dims of all its inputs
+class ContractionPathCache {
+ public:
+  bool TryGet(const std::vector<int64_t>& key, ContractionPath& path) const {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto it = paths_.find(key);
+    if (it == paths_.end()) {
+      return false;
+    }
+    path = it->second;
+    return true;
+  }
+
+  void Insert(const std::vector<int64_t>& key, const ContractionPath& path) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    // Models with free dims can produce an unbounded number of shape signatures - start over
+    // rather than let the cache grow without bound
+    if (paths_.size() >= kMaxCachedPaths) {
+      paths_.clear();
+    }
+    paths_.emplace(key, path);
+  }
+
+ private:
+  static constexpr size_t kMaxCachedPaths = 64;
+
+  mutable OrtMutex mutex_;
+  std::map<std::vector<int64_t>, ContractionPath> paths_;
+};
+
+#ifndef SHARED_PROVIDER
+
+// Returns the contraction path that minimizes the estimated number of multiply-adds.
+// All pairings are searched exhaustively for a small number of inputs, and a greedy search
+// (cheapest contraction first) is used beyond that.
+// If no order beats contracting the inputs left-to-right, the left-to-right order is returned.
+// input_subscript_indices: The subscript indices that appear in each input
+// homogenized_input_dims: The dims of each input with one axis per subscript index
+// subscript_indices_to_output_indices: The output axis of each subscript index (-1 if it is reduced)
+ContractionPath ComputeContractionPath(const std::vector<std::vector<int64_t>>& input_subscript_indices,
+                                       const std::vector<TensorShape>& homogenized_input_dims,
+                                       const std::vector<int64_t>& subscript_indices_to_output_indices);
+
+// The path that contracts the inputs left-to-right, i.e. (((in0, in1), in2), in3) ...
+ContractionPath GetLeftToRightContractionPath(size_t num_inputs);
+
+#endif
+
+}  // namespace EinsumOp
+
+}  // namespace onnxruntime
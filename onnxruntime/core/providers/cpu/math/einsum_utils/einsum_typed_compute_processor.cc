@@ -3,6 +3,8 @@
 
 #include "einsum_typed_compute_processor.h"
 
+#include <algorithm>
+
 namespace onnxruntime {
 
 template <typename T>
@@ -390,34 +392,126 @@ Status EinsumTypedComputeProcessor<T>::Run() {
     }
   }
 
-  // Process the operands in a pair-wise fashion
+  // Process the operands in a pair-wise fashion in the order given by the contraction path
   {
-    bool is_final_pair = false;
-    // Keep processing each input pair-wise
-    for (int input = 1; input < num_inputs; ++input) {
+    const auto& input_subscript_indices = einsum_compute_preprocessor_.GetInputSubscriptIndices();
+    const auto& subscript_indices_to_output_indices =
+        einsum_compute_preprocessor_.GetMappedSubscriptIndicesToOutputindices();
+
+    // The pending operands, the dims they are to be interpreted with, and the subscript indices they hold
+    std::vector<const Tensor*> operands;
+    std::vector<std::unique_ptr<const Tensor>> intermediate_operands;
+    std::vector<TensorShape> operand_dims;
+    std::vector<std::vector<bool>> operand_subscript_indices;
+    operands.reserve(num_inputs);
+    intermediate_operands.reserve(num_inputs);
+    operand_dims.reserve(num_inputs);
+    operand_subscript_indices.reserve(num_inputs);
+
+    for (int input = 0; input < num_inputs; ++input) {
+      // The first input may already have been reduced along the dims that only it has
+      if (input == 0 && result) {
+        operands.push_back(result.get());
+        operand_dims.push_back(result->Shape());
+        intermediate_operands.push_back(std::move(result));
+      } else {
+        // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
+        operands.push_back(preprocessed_inputs[input] ? preprocessed_inputs[input].get() : raw_inputs[input]);
+        operand_dims.push_back(homogenized_input_dims[input]);
+        intermediate_operands.push_back(nullptr);
+      }
+
+      std::vector<bool> subscript_indices(static_cast<size_t>(num_subscript_labels), false);
+      for (auto subscript_index : input_subscript_indices[input]) {
+        if (input != 0 || mapped_indices_to_last_input_index[subscript_index] != 0) {
+          subscript_indices[subscript_index] = true;
+        }
+      }
+      operand_subscript_indices.push_back(std::move(subscript_indices));
+    }
+
+    const auto contraction_path = GetContractionPath();
+    ORT_ENFORCE(contraction_path.size() == static_cast<size_t>(num_inputs) - 1,
+                "Einsum op: The contraction path does not contract all the inputs");
+
+    for (size_t step = 0; step < contraction_path.size(); ++step) {
+      const size_t left = contraction_path[step].first;
+      const size_t right = contraction_path[step].second;
+      ORT_ENFORCE(left != right && left < operands.size() && right < operands.size(),
+                  "Einsum op: Invalid contraction path");
+
+      // Reduce along the dims that neither the output nor any of the other pending operands need
       TensorShapeVector reduced_dims;
       reduced_dims.reserve(num_subscript_labels);  // num_subscript_labels is the upper bound. No harm in over-reserving by a small margin.
+      std::vector<bool> result_subscript_indices(static_cast<size_t>(num_subscript_labels), false);
       for (int64_t dim = 0; dim < num_subscript_labels; ++dim) {
-        if (mapped_indices_to_last_input_index[dim] == input) {
-          // This is the last input we are seeing this dimension (and it doesn't occur in the output), so reduce along the dimension
+        if (!operand_subscript_indices[left][dim] && !operand_subscript_indices[right][dim]) {
+          continue;
+        }
+
+        bool is_needed = subscript_indices_to_output_indices[dim] != -1;
+        for (size_t i = 0; i < operands.size() && !is_needed; ++i) {
+          is_needed = i != left && i != right && operand_subscript_indices[i][dim];
+        }
+
+        if (is_needed) {
+          result_subscript_indices[dim] = true;
+        } else {
           reduced_dims.push_back(dim);
         }
       }
-      if (input == num_inputs - 1) {
-        is_final_pair = true;
+
+      const bool is_final_pair = step == contraction_path.size() - 1;
+      auto pair_result = PairwiseOperandProcess(*operands[left], operand_dims[left],
+                                                *operands[right], operand_dims[right],
+                                                reduced_dims, is_final_pair);
+
+      // Replace the pair by its result at the end of the list of pending operands
+      for (auto index : {std::max(left, right), std::min(left, right)}) {
+        operands.erase(operands.begin() + index);
+        intermediate_operands.erase(intermediate_operands.begin() + index);
+        operand_dims.erase(operand_dims.begin() + index);
+        operand_subscript_indices.erase(operand_subscript_indices.begin() + index);
       }
-      // Use either the preprocessed inputs (if it is available) or the corresponding raw inputs
-      result = PairwiseOperandProcess(result ? *result : *raw_inputs[0],
-                                      result ? result->Shape() : homogenized_input_dims[0],
-                                      preprocessed_inputs[input] ? *preprocessed_inputs[input] : *raw_inputs[input],
-                                      homogenized_input_dims[input],
-                                      reduced_dims, is_final_pair);
+
+      operands.push_back(pair_result.get());
+      operand_dims.push_back(pair_result->Shape());
+      intermediate_operands.push_back(std::move(pair_result));
+      operand_subscript_indices.push_back(std::move(result_subscript_indices));
     }
   }
 
   return Status::OK();
 }
 
+template <typename T>
+EinsumOp::ContractionPath EinsumTypedComputeProcessor<T>::GetContractionPath() {
+  const auto& homogenized_input_dims = einsum_compute_preprocessor_.GetHomogenizedInputDims();
+
+  // The equation is fixed for a given node, so the homogenized input dims determine the path
+  std::vector<int64_t> key;
+  EinsumOp::ContractionPath path;
+  if (contraction_path_cache_) {
+    for (const auto& dims : homogenized_input_dims) {
+      const auto dims_span = dims.GetDims();
+      key.insert(key.end(), dims_span.begin(), dims_span.end());
+    }
+    if (contraction_path_cache_->TryGet(key, path)) {
+      return path;
+    }
+  }
+
+  path = EinsumOp::ComputeContractionPath(einsum_compute_preprocessor_.GetInputSubscriptIndices(),
+                                          homogenized_input_dims,
+                                          einsum_compute_preprocessor_.GetMappedSubscriptIndicesToOutputindices());
+
+  if (contraction_path_cache_) {
+    contraction_path_cache_->Insert(key, path);
+  }
+
+  return path;
+}
+
 // Explicit class instantiation
 template class EinsumTypedComputeProcessor<float>;
 template class EinsumTypedComputeProcessor<int32_t>;
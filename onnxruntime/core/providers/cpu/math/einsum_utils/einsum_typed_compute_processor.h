@@ -9,6 +9,7 @@
 
 #include "einsum_auxiliary_ops.h"
 #include "einsum_compute_preprocessor.h"
+#include "einsum_contraction_path.h"
 
 namespace onnxruntime {
 
@@ -33,6 +34,12 @@ class EinsumTypedComputeProcessor {
                         const EinsumOp::DeviceHelpers::ReduceSum<T>& device_reduce_sum_func,
                         const EinsumOp::DeviceHelpers::DataCopy& device_data_copy_func);
 
+  // Optional - when set, the order in which the operands are contracted is looked up in (and added to) this cache
+  // instead of being searched for on every run
+  void SetContractionPathCache(EinsumOp::ContractionPathCache* contraction_path_cache) {
+    contraction_path_cache_ = contraction_path_cache;
+  }
+
   Status Run();
 
  private:
@@ -54,6 +61,9 @@ class EinsumTypedComputeProcessor {
   void FinalizeOutput(const Tensor& candidate_output,
                       const gsl::span<const int64_t>& ordered_subscript_indices_in_candidate);
 
+  // Get the order in which the operands are to be contracted pair-wise
+  EinsumOp::ContractionPath GetContractionPath();
+
   // Private members -
   OpKernelContext* context_;
   AllocatorPtr allocator_;
@@ -67,6 +77,8 @@ class EinsumTypedComputeProcessor {
 
   // Holds EP-specific assets required for (auxiliary) ops that need to be executed on non-CPU EPs
   void* einsum_ep_assets_;
+
+  EinsumOp::ContractionPathCache* contraction_path_cache_ = nullptr;
 };
 
 }  // namespace onnxruntime
@@ -60,7 +60,7 @@ Status Hardmax<float>::Compute(OpKernelContext* ctx) const {
     Tensor temp_input(X->DataType(), TensorShape(transposed_input_dims), alloc);
 
     // Perform the transpose
-    ORT_RETURN_IF_ERROR(TransposeBase::DoTranspose(permutation, *X, temp_input));
+    ORT_RETURN_IF_ERROR(TransposeBase::DoTranspose(permutation, *X, temp_input, nullptr, ctx->GetOperatorThreadPool()));
     transposed_input = std::move(temp_input);
 
     // Allocate memory for the intermediate output
@@ -115,7 +115,8 @@ Status Hardmax<float>::Compute(OpKernelContext* ctx) const {
 
   if (is_transpose_required) {
     // Perform the transpose to get the axes back to the original ordering
-    ORT_RETURN_IF_ERROR(TransposeBase::DoTranspose(permutation, intermediate_output, *Y));
+    ORT_RETURN_IF_ERROR(TransposeBase::DoTranspose(permutation, intermediate_output, *Y, nullptr,
+                                                   ctx->GetOperatorThreadPool()));
   }
 
   return Status::OK();
@@ -8,6 +8,8 @@
 #include "core/util/math_cpuonly.h"
 #include "core/mlas/inc/mlas.h"
 
+#include <algorithm>
+
 namespace onnxruntime {
 
 ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
@@ -126,6 +128,48 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+namespace {
+
+// A constant B with at least this fraction of zeros is multiplied by MlasSparseGemm, which only
+// does work for the non-zero elements, instead of the dense packed GEMM.
+constexpr float kSparseWeightZeroRatio = 0.8f;
+
+bool SparsePackBFp32(AllocatorPtr& alloc,
+                     const Tensor& tensor_b,
+                     bool trans_b,
+                     BufferUniquePtr& packed_b,
+                     size_t& packed_b_size,
+                     TensorShape& b_shape) {
+  if (tensor_b.Shape().NumDimensions() != 2) {
+    return false;
+  }
+
+  const auto b_size = static_cast<size_t>(tensor_b.Shape().Size());
+  const float* b_data = tensor_b.Data<float>();
+  if (b_size == 0 ||
+      static_cast<float>(std::count(b_data, b_data + b_size, 0.0f)) < kSparseWeightZeroRatio * b_size) {
+    return false;
+  }
+
+  b_shape = tensor_b.Shape();
+  const size_t K = trans_b ? static_cast<size_t>(b_shape[1]) : static_cast<size_t>(b_shape[0]);
+  const size_t N = trans_b ? static_cast<size_t>(b_shape[0]) : static_cast<size_t>(b_shape[1]);
+  const size_t ldb = trans_b ? K : N;
+
+  packed_b_size = MlasSparseGemmPackBSize(trans_b ? CblasTrans : CblasNoTrans, N, K, b_data, ldb);
+  if (packed_b_size == 0) {
+    return false;
+  }
+
+  auto* packed_b_data = alloc->Alloc(packed_b_size);
+  memset(packed_b_data, 0, packed_b_size);
+  packed_b = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+  MlasSparseGemmPackB(trans_b ? CblasTrans : CblasNoTrans, N, K, b_data, ldb, packed_b_data);
+  return true;
+}
+
+}  // namespace
+
 Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ AllocatorPtr alloc,
                               /*out*/ bool& is_packed,
                               /*out*/ PrePackedWeights* prepacked_weights) {
@@ -134,7 +178,10 @@ Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ Alloc
   // only pack Matrix B
   if (input_idx == 1) {
     size_t packed_b_size;
-    is_packed = GemmPackBFp32(alloc, tensor, trans_b_attr_ != 0, packed_b_, packed_b_size, b_shape_);
+    // The choice only depends on the weight, so kernels sharing a prepacked buffer agree on its format
+    sparse_b_ = SparsePackBFp32(alloc, tensor, trans_b_attr_ != 0, packed_b_, packed_b_size, b_shape_);
+    is_packed = sparse_b_ ||
+                GemmPackBFp32(alloc, tensor, trans_b_attr_ != 0, packed_b_, packed_b_size, b_shape_);
     bool share_prepacked_weights = (prepacked_weights != nullptr);
     if (is_packed && share_prepacked_weights) {
       prepacked_weights->buffers_.push_back(std::move(packed_b_));
@@ -187,6 +234,15 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   const size_t lda = helper.Lda(trans_a);
   const size_t ldb = helper.Ldb(trans_b);
 
+  if (sparse_b_) {
+    for (size_t i = 0; i < max_len; i++) {
+      MlasSparseGemm(trans_a ? CblasTrans : CblasNoTrans, M, N, K, alpha_attr_,
+                     a_data + helper.LeftOffsets()[i], lda, packed_b_.get(),
+                     y_data + helper.OutputOffsets()[i], N, thread_pool);
+    }
+    return Status::OK();
+  }
+
   std::vector<MLAS_SGEMM_DATA_PARAMS> data(max_len);
   for (size_t i = 0; i < max_len; i++) {
     data[i].BIsPacked = bool(packed_b_);
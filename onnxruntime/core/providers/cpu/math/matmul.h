@@ -41,6 +41,8 @@ class MatMul<float> final : public OpKernel {
  private:
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
+  // packed_b_ holds the non-zero elements of B for MlasSparseGemm rather than a dense packed B
+  bool sparse_b_{false};
 
   // For FusedMatMul contrib ops
   float alpha_attr_;
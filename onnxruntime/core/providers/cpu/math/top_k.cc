@@ -140,6 +140,70 @@ static void SelectTopK(const Comparator& comparer,
   // the data_holder now contains the indices of the top k elements in the first k elements
 }
 
+// Minimum number of elements each thread should process when a single row is split across threads.
+static constexpr int64_t kMinSplitAxisSegmentSize = 16 * 1024;
+
+// Select the top k indices from the contiguous range [begin, end) into 'heap' using a binary heap.
+// Values that do not beat the current worst of the top k are rejected with a single comparison, so for large
+// ranges this is effectively a threshold filter that only touches the heap for a small fraction of the inputs.
+template <class Comparator>
+static void SelectTopKFromRange(const Comparator& comparer, const typename Comparator::DataType* input_data,
+                                int64_t begin, int64_t end, const unsigned k, int64_t* heap) {
+  int64_t cur_idx = begin;
+  for (int64_t l = 0; l < k; ++l) {
+    heap[k - l - 1] = cur_idx++;
+    HeapifyIthPosition(heap, k - l - 1, k, comparer);
+  }
+
+  auto top = input_data[heap[0]];
+  for (; cur_idx < end; ++cur_idx) {
+    if (comparer.CompareValueOnly(input_data[cur_idx], top)) {
+      heap[0] = cur_idx;
+      HeapifyIthPosition(heap, 0, k, comparer);
+      top = input_data[heap[0]];
+    }
+  }
+}
+
+// Handles the case where there are fewer rows than threads and TopK is over a large, contiguous axis
+// (e.g. selecting the top 100 of 1M+ scores with batch size 1). Each row is split into segments that are processed
+// in parallel, and the per-segment top k candidates are merged. As the comparer breaks ties using the index,
+// the selected elements are identical to those selected by processing the row in one pass.
+template <class Comparator>
+static void FindTopKElementsSplitAxis(const typename Comparator::DataType* input_data,
+                                      typename Comparator::DataType* values_data, int64_t* indices_data,
+                                      int64_t rows, int64_t num_blocks, int64_t num_segments,
+                                      const unsigned k, bool sorted, concurrency::ThreadPool* threadpool) {
+  Comparator comparer(input_data);
+  std::vector<int64_t> candidates(static_cast<size_t>(num_segments) * k);
+
+  for (int64_t i = 0; i < rows; ++i) {
+    const int64_t row_offset = i * num_blocks;
+
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        threadpool, num_segments,
+        [&comparer, &candidates, input_data, row_offset, num_blocks, num_segments, k](std::ptrdiff_t segment) {
+          auto work = concurrency::ThreadPool::PartitionWork(segment, num_segments, num_blocks);
+          SelectTopKFromRange(comparer, input_data, row_offset + work.start, row_offset + work.end, k,
+                              candidates.data() + segment * k);
+        });
+
+    // merge the candidates. there are num_segments * k of them, which is small relative to num_blocks.
+    nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end(), comparer);
+    if (sorted) {
+      std::sort(candidates.begin(), candidates.begin() + k, comparer);
+    }
+
+    auto* row_values = values_data + i * k;
+    auto* row_indices = indices_data + i * k;
+    for (int64_t l = 0; l < k; ++l) {
+      int64_t idx = candidates[l];
+      row_values[l] = input_data[idx];
+      row_indices[l] = idx - row_offset;
+    }
+  }
+}
+
 // Given an input tensor 'input' and metadata values - 'k' and 'axis_parsed',
 // this method will extract the sorted top k largest/smallest elements and place them in the output tensor 'values'
 // along with the metadata output 'indices'
@@ -165,6 +229,19 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   const int64_t block_slice = reduced_cols / k;
 
   int64_t tp_threads = concurrency::ThreadPool::DegreeOfParallelism(threadpool);
+
+  // if there are spare threads after splitting on rows and the axis is contiguous and large, split the axis instead.
+  // each segment must have at least k elements and enough work to justify a thread.
+  if (block_slice == 1 && rows < tp_threads) {
+    const int64_t min_segment_size = std::max(kMinSplitAxisSegmentSize, static_cast<int64_t>(k) * 8);
+    const int64_t num_segments = std::min(tp_threads, num_blocks / min_segment_size);
+    if (num_segments > 1) {
+      FindTopKElementsSplitAxis<Comparator>(input_data, values_data, indices_data, rows, num_blocks, num_segments,
+                                            k, sorted, threadpool);
+      return;
+    }
+  }
+
   int64_t num_threads = std::min(tp_threads, rows);  // split on rows so can't have more threads than rows
 
   // rough attempt to make sure there's enough work for each thread. if there's insufficient work the usage of
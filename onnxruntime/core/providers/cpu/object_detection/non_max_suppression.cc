@@ -13,8 +13,11 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 #include "non_max_suppression_helper.h"
-#include <queue>
+#include "core/platform/threadpool.h"
+#include <algorithm>
+#include <cmath>
 #include <utility>
+#include <vector>
 //TODO:fix the warnings
 #ifdef _MSC_VER
 #pragma warning(disable : 4244)
@@ -114,6 +117,222 @@ Status NonMaxSuppressionBase::GetThresholdsFromInputs(const PrepareContext& pc,
   return Status::OK();
 }
 
+namespace {
+
+// Box coordinates in structure-of-arrays layout, with the corners normalized so that min <= max.
+// The values are computed exactly as SuppressByIOU computes them so the results are identical.
+struct BoxesSoA {
+  std::vector<float> x_min;
+  std::vector<float> y_min;
+  std::vector<float> x_max;
+  std::vector<float> y_max;
+  std::vector<float> area;
+
+  size_t Size() const { return x_min.size(); }
+
+  void Reserve(size_t n) {
+    x_min.reserve(n);
+    y_min.reserve(n);
+    x_max.reserve(n);
+    y_max.reserve(n);
+    area.reserve(n);
+  }
+
+  void Add(const BoxesSoA& src, size_t i) {
+    x_min.push_back(src.x_min[i]);
+    y_min.push_back(src.y_min[i]);
+    x_max.push_back(src.x_max[i]);
+    y_max.push_back(src.y_max[i]);
+    area.push_back(src.area[i]);
+  }
+};
+
+void ConvertBoxes(const float* boxes_data, int64_t num_boxes, int64_t center_point_box, BoxesSoA& soa) {
+  const size_t n = static_cast<size_t>(num_boxes);
+  soa.x_min.resize(n);
+  soa.y_min.resize(n);
+  soa.x_max.resize(n);
+  soa.y_max.resize(n);
+  soa.area.resize(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    const float* box = boxes_data + 4 * i;
+    if (0 == center_point_box) {
+      // boxes data format [y1, x1, y2, x2]
+      MaxMin(box[1], box[3], soa.x_min[i], soa.x_max[i]);
+      MaxMin(box[0], box[2], soa.y_min[i], soa.y_max[i]);
+    } else {
+      // boxes data format [x_center, y_center, width, height]
+      float width_half = box[2] / 2;
+      float height_half = box[3] / 2;
+      soa.x_min[i] = box[0] - width_half;
+      soa.x_max[i] = box[0] + width_half;
+      soa.y_min[i] = box[1] - height_half;
+      soa.y_max[i] = box[1] + height_half;
+    }
+
+    soa.area[i] = (soa.x_max[i] - soa.x_min[i]) * (soa.y_max[i] - soa.y_min[i]);
+  }
+}
+
+// Returns true if the candidate box 'c' is suppressed by any box in 'selected'.
+// The inner loop has no early exit or data dependent branches so it can be auto-vectorized. Boxes are checked in
+// blocks so we can still stop once a suppressing box is found.
+bool SuppressedBySelected(const BoxesSoA& candidates, size_t c, const BoxesSoA& selected, float iou_threshold) {
+  constexpr size_t kBlockSize = 16;
+
+  const float c_x_min = candidates.x_min[c];
+  const float c_y_min = candidates.y_min[c];
+  const float c_x_max = candidates.x_max[c];
+  const float c_y_max = candidates.y_max[c];
+  const float c_area = candidates.area[c];
+
+  // a box with no area can never be suppressed
+  if (!(c_area > .0f)) {
+    return false;
+  }
+
+  const float* s_x_min = selected.x_min.data();
+  const float* s_y_min = selected.y_min.data();
+  const float* s_x_max = selected.x_max.data();
+  const float* s_y_max = selected.y_max.data();
+  const float* s_area = selected.area.data();
+  const size_t num_selected = selected.Size();
+
+  for (size_t block_start = 0; block_start < num_selected; block_start += kBlockSize) {
+    const size_t block_end = std::min(block_start + kBlockSize, num_selected);
+    int suppressed = 0;
+
+    for (size_t i = block_start; i < block_end; ++i) {
+      const float intersection_x_min = std::max(c_x_min, s_x_min[i]);
+      const float intersection_x_max = std::min(c_x_max, s_x_max[i]);
+      const float intersection_y_min = std::max(c_y_min, s_y_min[i]);
+      const float intersection_y_max = std::min(c_y_max, s_y_max[i]);
+
+      const float intersection_area = (intersection_x_max - intersection_x_min) *
+                                      (intersection_y_max - intersection_y_min);
+      const float union_area = c_area + s_area[i] - intersection_area;
+
+      suppressed |= static_cast<int>(intersection_x_max > intersection_x_min) &
+                    static_cast<int>(intersection_y_max > intersection_y_min) &
+                    static_cast<int>(intersection_area > .0f) &
+                    static_cast<int>(s_area[i] > .0f) &
+                    static_cast<int>(union_area > .0f) &
+                    static_cast<int>(intersection_area / union_area > iou_threshold);
+    }
+
+    if (suppressed) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Uniform grid over the extent of the boxes of a batch. Each selected box is added to every cell it covers, so a
+// candidate only needs to be checked against the boxes in the cells it covers. Two boxes with a non-empty
+// intersection always share at least one cell as the cell index is monotonic in the coordinate.
+class SelectedBoxesGrid {
+ public:
+  static constexpr int kCellsPerAxis = 16;
+
+  // returns false if the grid can't be used for the boxes, e.g. due to non-finite coordinates.
+  bool Init(const BoxesSoA& boxes) {
+    const size_t n = boxes.Size();
+    if (n == 0) {
+      return false;
+    }
+
+    float x_min = boxes.x_min[0], x_max = boxes.x_max[0];
+    float y_min = boxes.y_min[0], y_max = boxes.y_max[0];
+    for (size_t i = 0; i < n; ++i) {
+      if (!std::isfinite(boxes.x_min[i]) || !std::isfinite(boxes.x_max[i]) ||
+          !std::isfinite(boxes.y_min[i]) || !std::isfinite(boxes.y_max[i])) {
+        return false;
+      }
+
+      x_min = std::min(x_min, boxes.x_min[i]);
+      x_max = std::max(x_max, boxes.x_max[i]);
+      y_min = std::min(y_min, boxes.y_min[i]);
+      y_max = std::max(y_max, boxes.y_max[i]);
+    }
+
+    if (!(x_max > x_min) || !(y_max > y_min)) {
+      return false;
+    }
+
+    x_origin_ = x_min;
+    y_origin_ = y_min;
+    x_scale_ = kCellsPerAxis / (x_max - x_min);
+    y_scale_ = kCellsPerAxis / (y_max - y_min);
+    if (!std::isfinite(x_scale_) || !std::isfinite(y_scale_)) {
+      return false;
+    }
+
+    cells_.resize(kCellsPerAxis * kCellsPerAxis);
+    return true;
+  }
+
+  void Clear() {
+    for (auto& cell : cells_) {
+      cell.x_min.clear();
+      cell.y_min.clear();
+      cell.x_max.clear();
+      cell.y_max.clear();
+      cell.area.clear();
+    }
+  }
+
+  void Add(const BoxesSoA& boxes, size_t i) {
+    ForEachCell(boxes, i, [&boxes, i](BoxesSoA& cell) {
+      cell.Add(boxes, i);
+      return false;
+    });
+  }
+
+  bool Suppressed(const BoxesSoA& boxes, size_t i, float iou_threshold) {
+    return ForEachCell(boxes, i, [&boxes, i, iou_threshold](BoxesSoA& cell) {
+      return SuppressedBySelected(boxes, i, cell, iou_threshold);
+    });
+  }
+
+ private:
+  static int CellIndex(float value, float origin, float scale) {
+    const float cell = (value - origin) * scale;
+    return cell <= 0.f ? 0 : std::min(static_cast<int>(cell), kCellsPerAxis - 1);
+  }
+
+  // call fn for each cell covered by box i. stops and returns true if fn returns true.
+  template <typename TFunc>
+  bool ForEachCell(const BoxesSoA& boxes, size_t i, TFunc&& fn) {
+    const int x_begin = CellIndex(boxes.x_min[i], x_origin_, x_scale_);
+    const int x_end = CellIndex(boxes.x_max[i], x_origin_, x_scale_);
+    const int y_begin = CellIndex(boxes.y_min[i], y_origin_, y_scale_);
+    const int y_end = CellIndex(boxes.y_max[i], y_origin_, y_scale_);
+
+    for (int y = y_begin; y <= y_end; ++y) {
+      for (int x = x_begin; x <= x_end; ++x) {
+        if (fn(cells_[y * kCellsPerAxis + x])) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  float x_origin_{};
+  float y_origin_{};
+  float x_scale_{};
+  float y_scale_{};
+  std::vector<BoxesSoA> cells_;
+};
+
+// Minimum number of boxes in a batch before the grid is used to prune the IoU checks.
+constexpr int64_t kMinBoxesForGrid = 1024;
+
+}  // namespace
+
 Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   PrepareContext pc;
   ORT_RETURN_IF_ERROR(PrepareCompute(ctx, pc));
@@ -144,62 +363,118 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   };
 
   const auto center_point_box = GetCenterPointBox();
+  const int64_t num_boxes = pc.num_boxes_;
 
-  std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfoPtr> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
+  // convert the boxes of each batch once as they are shared by all classes
+  std::vector<BoxesSoA> batch_boxes(static_cast<size_t>(pc.num_batches_));
   for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfoPtr> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
-            candidate_boxes.emplace_back(*class_scores, box_index);
-          }
-        }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+    ConvertBoxes(boxes_data + (batch_index * num_boxes * 4), num_boxes, center_point_box, batch_boxes[batch_index]);
+  }
+
+  const bool use_grid = num_boxes >= kMinBoxesForGrid;
+  const size_t max_selected = std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class),
+                                               static_cast<size_t>(num_boxes));
+
+  // each batch/class pair is independent. collect the selected box indices for each and combine them in order.
+  const int64_t num_work_items = pc.num_batches_ * pc.num_classes_;
+  std::vector<std::vector<int64_t>> selected_per_item(static_cast<size_t>(num_work_items));
+
+  auto process_item = [&](int64_t item, BoxesSoA& selected_boxes, SelectedBoxesGrid& grid,
+                          std::vector<BoxInfoPtr>& candidate_boxes) {
+    const int64_t batch_index = item / pc.num_classes_;
+    const BoxesSoA& boxes = batch_boxes[batch_index];
+    auto& selected_indices = selected_per_item[item];
+
+    candidate_boxes.clear();
+
+    // Filter by score_threshold_
+    const auto* class_scores = scores_data + item * num_boxes;
+    if (pc.score_threshold_ != nullptr) {
+      for (int64_t box_index = 0; box_index < num_boxes; ++box_index, ++class_scores) {
+        if (*class_scores > score_threshold) {
           candidate_boxes.emplace_back(*class_scores, box_index);
         }
       }
-      std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfoPtr& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
-          }
+    } else {
+      for (int64_t box_index = 0; box_index < num_boxes; ++box_index, ++class_scores) {
+        candidate_boxes.emplace_back(*class_scores, box_index);
+      }
+    }
+
+    // max heap ordered by score, then by lowest box index. the vector is re-used across items.
+    std::make_heap(candidate_boxes.begin(), candidate_boxes.end());
+
+    const bool grid_enabled = use_grid && candidate_boxes.size() >= static_cast<size_t>(kMinBoxesForGrid) &&
+                              grid.Init(boxes);
+    if (grid_enabled) {
+      grid.Clear();
+    }
+
+    selected_boxes.x_min.clear();
+    selected_boxes.y_min.clear();
+    selected_boxes.x_max.clear();
+    selected_boxes.y_max.clear();
+    selected_boxes.area.clear();
+
+    // Get the next box with top score, filter by iou_threshold
+    while (!candidate_boxes.empty() && selected_indices.size() < max_selected) {
+      const auto box_index = static_cast<size_t>(candidate_boxes.front().index_);
+
+      // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
+      bool suppressed = grid_enabled ? grid.Suppressed(boxes, box_index, iou_threshold)
+                                     : SuppressedBySelected(boxes, box_index, selected_boxes, iou_threshold);
+
+      if (!suppressed) {
+        if (grid_enabled) {
+          grid.Add(boxes, box_index);
+        } else {
+          selected_boxes.Add(boxes, box_index);
         }
 
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
+        selected_indices.push_back(static_cast<int64_t>(box_index));
+      }
+
+      std::pop_heap(candidate_boxes.begin(), candidate_boxes.end());
+      candidate_boxes.pop_back();
+    }
+  };
+
+  // rough cost of one batch/class pair: scoring and sorting the boxes plus the IoU checks against the selected boxes
+  const double cost_per_item = static_cast<double>(num_boxes) *
+                               (std::log2(static_cast<double>(num_boxes) + 1) + static_cast<double>(max_selected));
+
+  concurrency::ThreadPool::TryParallelFor(
+      ctx->GetOperatorThreadPool(), num_work_items,
+      TensorOpCost{static_cast<double>(num_boxes * sizeof(float)),
+                   static_cast<double>(max_selected * sizeof(int64_t)),
+                   cost_per_item},
+      [&process_item](std::ptrdiff_t first, std::ptrdiff_t last) {
+        BoxesSoA selected_boxes;
+        SelectedBoxesGrid grid;
+        std::vector<BoxInfoPtr> candidate_boxes;
+        for (std::ptrdiff_t item = first; item < last; ++item) {
+          process_item(item, selected_boxes, grid, candidate_boxes);
         }
-        sorted_boxes.pop();
-      }  //while
-    }    //for class_index
-  }      //for batch_index
+      });
+
+  size_t num_selected = 0;
+  for (const auto& selected : selected_per_item) {
+    num_selected += selected.size();
+  }
 
   constexpr auto last_dim = 3;
-  const auto num_selected = selected_indices.size();
   Tensor* output = ctx->Output(0, {static_cast<int64_t>(num_selected), last_dim});
   ORT_ENFORCE(output != nullptr);
   static_assert(last_dim * sizeof(int64_t) == sizeof(SelectedIndex), "Possible modification of SelectedIndex");
-  memcpy(output->MutableData<int64_t>(), selected_indices.data(), num_selected * sizeof(SelectedIndex));
+
+  auto* selected_indices = reinterpret_cast<SelectedIndex*>(output->MutableData<int64_t>());
+  for (int64_t item = 0; item < num_work_items; ++item) {
+    const int64_t batch_index = item / pc.num_classes_;
+    const int64_t class_index = item % pc.num_classes_;
+    for (int64_t box_index : selected_per_item[item]) {
+      *selected_indices++ = SelectedIndex(batch_index, class_index, box_index);
+    }
+  }
 
   return Status::OK();
 }
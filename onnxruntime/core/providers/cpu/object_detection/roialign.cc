@@ -17,6 +17,7 @@
 
 #include "roialign.h"
 
+#include <algorithm>
 #include <cmath>
 #include "core/util/math_cpuonly.h"
 #include "core/common/common.h"
@@ -50,6 +51,27 @@ ADD_VERSIONED_TYPED_ROIALIGN_OP(double);
 ADD_TYPED_ROIALIGN_OP(float);
 ADD_TYPED_ROIALIGN_OP(double);
 
+#ifndef DISABLE_CONTRIB_OPS
+
+namespace contrib {
+
+// Register an alternate version of this kernel that supports the channels_last
+// attribute in order to consume and produce NHWC tensors.
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    RoiAlign,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", DataTypeImpl::GetTensorType<float>())
+        .TypeConstraint("T2", DataTypeImpl::GetTensorType<int64_t>()),
+    RoiAlign<float>);
+
+}  // namespace contrib
+
+#endif
+
 namespace {
 template <typename T>
 struct PreCalc {
@@ -153,6 +175,61 @@ static void PreCalcForBilinearInterpolate(const int64_t height, const int64_t wi
   }
 }
 
+// Sampling parameters of a single RoI, shared by the NCHW and NHWC implementations.
+struct RoiSamplingInfo {
+  int64_t roi_batch_ind;
+  int64_t roi_bin_grid_h;
+  int64_t roi_bin_grid_w;
+  int64_t count;
+};
+
+// Computes the sampling grid of RoI 'n' and fills 'pre_calc' with the bilinear interpolation indices and weights
+// of every sampling point. The table only depends on the RoI so it is shared by all channels.
+template <typename T>
+RoiSamplingInfo PreCalcForRoi(int64_t n, float spatial_scale, int64_t height, int64_t width,
+                              int64_t pooled_height, int64_t pooled_width, int64_t sampling_ratio,
+                              const T* bottom_rois, int64_t num_roi_cols, bool half_pixel,
+                              const int64_t* batch_indices_ptr, std::vector<PreCalc<T>>& pre_calc) {
+  const T* offset_bottom_rois = bottom_rois + n * num_roi_cols;
+
+  RoiSamplingInfo info;
+  info.roi_batch_ind = batch_indices_ptr[n];
+
+  // Do not using rounding; this implementation detail is critical
+  T offset = half_pixel ? (T)0.5 : (T)0.0;
+  T roi_start_w = offset_bottom_rois[0] * spatial_scale - offset;
+  T roi_start_h = offset_bottom_rois[1] * spatial_scale - offset;
+  T roi_end_w = offset_bottom_rois[2] * spatial_scale - offset;
+  T roi_end_h = offset_bottom_rois[3] * spatial_scale - offset;
+
+  T roi_width = roi_end_w - roi_start_w;
+  T roi_height = roi_end_h - roi_start_h;
+  if (!half_pixel) {
+    // Force malformed ROIs to be 1x1
+    roi_width = std::max(roi_width, (T)1.);
+    roi_height = std::max(roi_height, (T)1.);
+  }
+
+  T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
+  T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
+
+  // We use roi_bin_grid to sample the grid and mimic integral
+  info.roi_bin_grid_h = (sampling_ratio > 0) ? sampling_ratio : static_cast<int64_t>(std::ceil(roi_height / pooled_height));  // e.g., = 2
+  info.roi_bin_grid_w =
+      (sampling_ratio > 0) ? sampling_ratio : static_cast<int64_t>(std::ceil(roi_width / pooled_width));
+
+  // We do average (integral) pooling inside a bin
+  info.count = std::max(info.roi_bin_grid_h * info.roi_bin_grid_w, static_cast<int64_t>(1));  // e.g. = 4
+
+  // we want to precalculate indices and weights shared by all channels,
+  // this is the key point of optimization
+  pre_calc.resize(info.roi_bin_grid_h * info.roi_bin_grid_w * pooled_width * pooled_height);
+  PreCalcForBilinearInterpolate(height, width, pooled_height, pooled_width, info.roi_bin_grid_h, info.roi_bin_grid_w,
+                                roi_start_h, roi_start_w, bin_size_h, bin_size_w, info.roi_bin_grid_h,
+                                info.roi_bin_grid_w, pre_calc);
+  return info;
+}
+
 template <typename T>
 void RoiAlignForward(const TensorShape& output_shape, const T* bottom_data, float spatial_scale, int64_t height,
                      int64_t width, int64_t sampling_ratio, const T* bottom_rois, int64_t num_roi_cols, T* top_data,
@@ -166,44 +243,18 @@ void RoiAlignForward(const TensorShape& output_shape, const T* bottom_data, floa
   double cost = static_cast<double>(channels * pooled_width * pooled_height * 100);
 
   ThreadPool::TryParallelFor(ttp, static_cast<ptrdiff_t>(n_rois), cost, [&](ptrdiff_t n, ptrdiff_t end) {
+    std::vector<PreCalc<T>> pre_calc;
+
     for (; n != end; ++n) {
       int64_t index_n = n * channels * pooled_width * pooled_height;
 
-      const T* offset_bottom_rois = bottom_rois + n * num_roi_cols;
-      const auto roi_batch_ind = batch_indices_ptr[n];
-
-      // Do not using rounding; this implementation detail is critical
-      T offset = half_pixel ? (T)0.5 : (T)0.0;
-      T roi_start_w = offset_bottom_rois[0] * spatial_scale - offset;
-      T roi_start_h = offset_bottom_rois[1] * spatial_scale - offset;
-      T roi_end_w = offset_bottom_rois[2] * spatial_scale - offset;
-      T roi_end_h = offset_bottom_rois[3] * spatial_scale - offset;
-
-      T roi_width = roi_end_w - roi_start_w;
-      T roi_height = roi_end_h - roi_start_h;
-      if (!half_pixel) {
-        // Force malformed ROIs to be 1x1
-        roi_width = std::max(roi_width, (T)1.);
-        roi_height = std::max(roi_height, (T)1.);
-      }
-
-      T bin_size_h = static_cast<T>(roi_height) / static_cast<T>(pooled_height);
-      T bin_size_w = static_cast<T>(roi_width) / static_cast<T>(pooled_width);
-
-      // We use roi_bin_grid to sample the grid and mimic integral
-      int64_t roi_bin_grid_h = (sampling_ratio > 0) ? sampling_ratio : static_cast<int64_t>(std::ceil(roi_height / pooled_height));  // e.g., = 2
-      int64_t roi_bin_grid_w =
-          (sampling_ratio > 0) ? sampling_ratio : static_cast<int64_t>(std::ceil(roi_width / pooled_width));
-
-      // We do average (integral) pooling inside a bin
-      const int64_t count = std::max(roi_bin_grid_h * roi_bin_grid_w, static_cast<int64_t>(1)); // e.g. = 4
-
-      // we want to precalculate indices and weights shared by all channels,
-      // this is the key point of optimization
-      std::vector<PreCalc<T>> pre_calc(roi_bin_grid_h * roi_bin_grid_w * pooled_width * pooled_height);
-      PreCalcForBilinearInterpolate(height, width, pooled_height, pooled_width, roi_bin_grid_h, roi_bin_grid_w,
-                                    roi_start_h, roi_start_w, bin_size_h, bin_size_w, roi_bin_grid_h,
-                                    roi_bin_grid_w, pre_calc);
+      const auto roi_info = PreCalcForRoi(n, spatial_scale, height, width, pooled_height, pooled_width,
+                                          sampling_ratio, bottom_rois, num_roi_cols, half_pixel, batch_indices_ptr,
+                                          pre_calc);
+      const auto roi_batch_ind = roi_info.roi_batch_ind;
+      const int64_t roi_bin_grid_h = roi_info.roi_bin_grid_h;
+      const int64_t roi_bin_grid_w = roi_info.roi_bin_grid_w;
+      const int64_t count = roi_info.count;
 
       for (int64_t c = 0; c < channels; c++) {
         int64_t index_n_c = index_n + c * pooled_width * pooled_height;
@@ -255,6 +306,73 @@ void RoiAlignForward(const TensorShape& output_shape, const T* bottom_data, floa
     }        // for n
   });
 }
+
+// NHWC variant: X is [N, H, W, C] and Y is [num_rois, pooled_height, pooled_width, C]. The channels of a pixel are
+// contiguous so each sampling point is applied to all channels with a single vectorizable loop.
+template <typename T>
+void RoiAlignForwardNhwc(const TensorShape& output_shape, const T* bottom_data, float spatial_scale, int64_t height,
+                         int64_t width, int64_t sampling_ratio, const T* bottom_rois, int64_t num_roi_cols,
+                         T* top_data, RoiAlignMode mode, bool half_pixel, const int64_t* batch_indices_ptr,
+                         ThreadPool* ttp) {
+  int64_t n_rois = output_shape[0];
+  int64_t pooled_height = output_shape[1];
+  int64_t pooled_width = output_shape[2];
+  int64_t channels = output_shape[3];
+
+  double cost = static_cast<double>(channels * pooled_width * pooled_height * 100);
+
+  ThreadPool::TryParallelFor(ttp, static_cast<ptrdiff_t>(n_rois), cost, [&](ptrdiff_t n, ptrdiff_t end) {
+    std::vector<PreCalc<T>> pre_calc;
+
+    for (; n != end; ++n) {
+      const auto roi_info = PreCalcForRoi(n, spatial_scale, height, width, pooled_height, pooled_width,
+                                          sampling_ratio, bottom_rois, num_roi_cols, half_pixel, batch_indices_ptr,
+                                          pre_calc);
+      const int64_t num_samples = roi_info.roi_bin_grid_h * roi_info.roi_bin_grid_w;
+      const T count = static_cast<T>(roi_info.count);
+
+      const T* offset_bottom_data = bottom_data + roi_info.roi_batch_ind * height * width * channels;
+      T* output = top_data + n * pooled_height * pooled_width * channels;
+      const PreCalc<T>* pc = pre_calc.data();
+
+      for (int64_t bin = 0; bin < pooled_height * pooled_width; bin++) {
+        if (mode == RoiAlignMode::avg) {  // avg pooling
+          std::fill_n(output, channels, static_cast<T>(0));
+          for (int64_t i = 0; i < num_samples; i++, pc++) {
+            const T* p1 = offset_bottom_data + pc->pos1 * channels;
+            const T* p2 = offset_bottom_data + pc->pos2 * channels;
+            const T* p3 = offset_bottom_data + pc->pos3 * channels;
+            const T* p4 = offset_bottom_data + pc->pos4 * channels;
+            const T w1 = pc->w1, w2 = pc->w2, w3 = pc->w3, w4 = pc->w4;
+            for (int64_t c = 0; c < channels; c++) {
+              output[c] += w1 * p1[c] + w2 * p2[c] + w3 * p3[c] + w4 * p4[c];
+            }
+          }
+          for (int64_t c = 0; c < channels; c++) {
+            output[c] /= count;
+          }
+        } else {  // max pooling
+          for (int64_t i = 0; i < num_samples; i++, pc++) {
+            const T* p1 = offset_bottom_data + pc->pos1 * channels;
+            const T* p2 = offset_bottom_data + pc->pos2 * channels;
+            const T* p3 = offset_bottom_data + pc->pos3 * channels;
+            const T* p4 = offset_bottom_data + pc->pos4 * channels;
+            const T w1 = pc->w1, w2 = pc->w2, w3 = pc->w3, w4 = pc->w4;
+            for (int64_t c = 0; c < channels; c++) {
+              T val = std::max(std::max(std::max(w1 * p1[c], w2 * p2[c]), w3 * p3[c]), w4 * p4[c]);
+              output[c] = (i == 0) ? val : std::max(output[c], val);
+            }
+          }
+          if (num_samples == 0) {
+            std::fill_n(output, channels, static_cast<T>(0));
+          }
+        }
+
+        output += channels;
+      }  // for bin
+    }    // for n
+  });
+}
 }  // namespace
 
 Status CheckROIAlignValidInput(const Tensor* X_ptr, const Tensor* rois_ptr, const Tensor* batch_indices_ptr) {
@@ -302,19 +420,36 @@ Status RoiAlign<T>::Compute(OpKernelContext* context) const {
   const auto* rois_ptr = context->Input<Tensor>(1);
   const auto* batch_indices_ptr = context->Input<Tensor>(2);
 
+  auto status = CheckROIAlignValidInput(X_ptr, rois_ptr, batch_indices_ptr);
+  if (!status.IsOK()) {
+    return status;
+  }
+
   const auto& x_dims = X_ptr->Shape();
   const auto& rois_dims = rois_ptr->Shape();
   const auto& batch_indices_dims = batch_indices_ptr->Shape();
 
-  auto num_channels = x_dims[1];
+  if (x_dims.NumDimensions() != 4) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Number of dimensions for X should be exactly 4");
+  }
+
   auto num_rois = batch_indices_dims[0];
   auto num_roi_cols = rois_dims[1];
 
-  auto status = CheckROIAlignValidInput(X_ptr, rois_ptr, batch_indices_ptr);
-  if (!status.IsOK()) {
-    return status;
+  if (channels_last_) {
+    auto num_channels = x_dims[3];
+    auto& Y = *context->Output(0, {num_rois, this->output_height_, this->output_width_, num_channels});
+
+    RoiAlignForwardNhwc<T>(Y.Shape(), X_ptr->Data<T>(), this->spatial_scale_,
+                           x_dims[1],  // height
+                           x_dims[2],  // width
+                           this->sampling_ratio_, rois_ptr->Data<T>(), num_roi_cols, Y.template MutableData<T>(),
+                           this->mode_, this->half_pixel_, batch_indices_ptr->Data<int64_t>(),
+                           context->GetOperatorThreadPool());
+    return Status::OK();
   }
 
+  auto num_channels = x_dims[1];
   auto& Y = *context->Output(0, {num_rois, num_channels, this->output_height_, this->output_width_});
 
   RoiAlignForward<T>(Y.Shape(), X_ptr->Data<T>(), this->spatial_scale_,
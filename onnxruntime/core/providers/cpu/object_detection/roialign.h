@@ -81,11 +81,16 @@ class RoiAlignBase {
 template <typename T>
 class RoiAlign final : public OpKernel, public RoiAlignBase {
  public:
-  explicit RoiAlign(const OpKernelInfo& info) : OpKernel(info), RoiAlignBase(info) {}
+  explicit RoiAlign(const OpKernelInfo& info) : OpKernel(info), RoiAlignBase(info) {
+    // only present on the com.microsoft variant inserted by the layout transformers.
+    channels_last_ = info.GetAttrOrDefault<int64_t>("channels_last", 0) != 0;
+  }
 
   Status Compute(OpKernelContext* context) const override;
 
  private:
+  bool channels_last_{false};
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(RoiAlign);
 };
 }  // namespace onnxruntime
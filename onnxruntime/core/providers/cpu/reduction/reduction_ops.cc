@@ -4,6 +4,7 @@
 #include "core/common/inlined_containers.h"
 #include "core/providers/cpu/reduction/reduction_ops.h"
 #include "core/providers/common.h"
+#include "core/mlas/inc/mlas.h"
 //TODO: fix the warnings
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(disable : 26451)
@@ -382,6 +383,287 @@ void ValidateNoTransposeReduce(int64_t count) {
   ORT_ENFORCE(count == 1, "Reduction on all axes, output size should be 1.");
 }
 
+namespace {
+
+// Single precision reductions handled by the MLAS row and column reduction kernels.
+enum class FloatReduceOp {
+  kNone,
+  kSum,
+  kSumSquare,
+  kMean,
+  kL2,
+  kMax,
+  kMin,
+  kLogSumExp,
+};
+
+template <typename AGG>
+struct FloatReduceOpFor {
+  static constexpr FloatReduceOp value = FloatReduceOp::kNone;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorSum<float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kSum;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorSumSquare<float, float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kSumSquare;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorMean<float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kMean;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorL2<float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kL2;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorMax<float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kMax;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorMin<float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kMin;
+};
+
+template <>
+struct FloatReduceOpFor<ReduceAggregatorLogSumExp<float>> {
+  static constexpr FloatReduceOp value = FloatReduceOp::kLogSumExp;
+};
+
+MLAS_REDUCE_KIND GetMlasReduceKind(FloatReduceOp op) {
+  switch (op) {
+    case FloatReduceOp::kSum:
+    case FloatReduceOp::kMean:
+      return MlasReduceSum;
+    case FloatReduceOp::kSumSquare:
+    case FloatReduceOp::kL2:
+      return MlasReduceSumSquare;
+    case FloatReduceOp::kMax:
+      return MlasReduceMaximum;
+    case FloatReduceOp::kMin:
+      return MlasReduceMinimum;
+    case FloatReduceOp::kLogSumExp:
+      return MlasReduceLogSumExp;
+    default:
+      ORT_THROW("Unexpected float reduction.");
+  }
+}
+
+// Turns the reduced values into the results for the reductions MLAS computes in two steps.
+void FinalizeFloatReduce(FloatReduceOp op, float* output, int64_t size, int64_t reduced_size) {
+  if (op == FloatReduceOp::kMean) {
+    EigenVectorArrayMap<float>(output, size) /= static_cast<float>(reduced_size);
+  } else if (op == FloatReduceOp::kL2) {
+    EigenVectorArrayMap<float>(output, size) = ConstEigenVectorArrayMap<float>(output, size).sqrt();
+  }
+}
+
+// Reduces the rows of a [rows, columns] matrix: kKR.
+void FloatFastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                       Tensor& output, concurrency::ThreadPool* tp, FloatReduceOp op) {
+  const float* data = input.Data<float>();
+  float* out = output.MutableData<float>();
+  const int64_t N = fast_shape[1];
+  const MLAS_REDUCE_KIND kind = GetMlasReduceKind(op);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, fast_shape[0], ParallelReduceFastCost(1, N, sizeof(float), 6),
+      [=](ptrdiff_t first, ptrdiff_t last) {
+        MlasReduceRows(kind, data + first * N, out + first, static_cast<size_t>(last - first),
+                       static_cast<size_t>(N), static_cast<size_t>(N), false);
+        FinalizeFloatReduce(op, out + first, last - first, N);
+      });
+}
+
+// Reduces the columns of a [rows, columns] matrix: kRK.
+void FloatFastReduceRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                       Tensor& output, concurrency::ThreadPool* tp, FloatReduceOp op) {
+  const float* data = input.Data<float>();
+  float* out = output.MutableData<float>();
+  const int64_t n_rows = fast_shape[0];
+  const int64_t N = fast_shape[1];
+  const MLAS_REDUCE_KIND kind = GetMlasReduceKind(op);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, N, ParallelReduceFastCost(1, n_rows, sizeof(float), 6),
+      [=](ptrdiff_t first, ptrdiff_t last) {
+        MlasReduceColumns(kind, data + first, out + first, static_cast<size_t>(n_rows),
+                          static_cast<size_t>(last - first), static_cast<size_t>(N), false);
+        FinalizeFloatReduce(op, out + first, last - first, n_rows);
+      });
+}
+
+// Reduces the middle axis of a [d0, d1, d2] tensor: kKRK.
+void FloatFastReduceKRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                        Tensor& output, concurrency::ThreadPool* tp, FloatReduceOp op) {
+  const float* data = input.Data<float>();
+  float* out = output.MutableData<float>();
+  const int64_t d1 = fast_shape[1];
+  const int64_t d2 = fast_shape[2];
+  const MLAS_REDUCE_KIND kind = GetMlasReduceKind(op);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, fast_shape[0], ParallelReduceFastCost(d1, d2, sizeof(float), 6),
+      [=](ptrdiff_t first, ptrdiff_t last) {
+        for (ptrdiff_t d = first; d < last; ++d) {
+          MlasReduceColumns(kind, data + d * d1 * d2, out + d * d2, static_cast<size_t>(d1),
+                            static_cast<size_t>(d2), static_cast<size_t>(d2), false);
+          FinalizeFloatReduce(op, out + d * d2, d2, d1);
+        }
+      });
+}
+
+// Reduces the outer and inner axes of a [d0, d1, d2] tensor: kRKR.
+void FloatFastReduceRKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                        Tensor& output, concurrency::ThreadPool* tp, FloatReduceOp op) {
+  const float* data = input.Data<float>();
+  float* out = output.MutableData<float>();
+  const int64_t d0 = fast_shape[0];
+  const int64_t d1 = fast_shape[1];
+  const int64_t d2 = fast_shape[2];
+  const MLAS_REDUCE_KIND kind = GetMlasReduceKind(op);
+
+  if (op == FloatReduceOp::kLogSumExp) {
+    // The log-sum-exp of the inner axis cannot be accumulated across the outer axis,
+    // gather the inputs of each output first.
+    concurrency::ThreadPool::TryParallelFor(
+        tp, d1, ParallelReduceFastCost(d1, d0 * d2, sizeof(float), 8),
+        [=](ptrdiff_t first, ptrdiff_t last) {
+          std::vector<float> buffer(SafeInt<size_t>(d0) * d2);
+          for (ptrdiff_t d = first; d < last; ++d) {
+            for (int64_t i = 0; i < d0; ++i) {
+              memcpy(buffer.data() + i * d2, data + (i * d1 + d) * d2, SafeInt<size_t>(d2) * sizeof(float));
+            }
+            MlasReduceRows(kind, buffer.data(), out + d, 1, buffer.size(), buffer.size(), false);
+          }
+        });
+    return;
+  }
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, d1, ParallelReduceFastCost(d1, d0 * d2, sizeof(float), 6),
+      [=](ptrdiff_t first, ptrdiff_t last) {
+        for (int64_t i = 0; i < d0; ++i) {
+          MlasReduceRows(kind, data + (i * d1 + first) * d2, out + first, static_cast<size_t>(last - first),
+                         static_cast<size_t>(d2), static_cast<size_t>(d2), i > 0);
+        }
+        FinalizeFloatReduce(op, out + first, last - first, d0 * d2);
+      });
+}
+
+// Reduces any combination of axes in a single pass using the index projections computed
+// by NoTransposePrepareForReduce. The innermost kept axis is vectorized over when it is
+// contiguous, otherwise the innermost reduced axis is.
+// Returns false if the reduction must be done by the generic implementation.
+bool FloatNoTransposeReduce(const float* from_data, float* to_data, int64_t count,
+                            const ResultsNoTransposePrepareForReduce& last_results,
+                            concurrency::ThreadPool* tp, FloatReduceOp op) {
+  const auto& projected_index = last_results.projected_index;
+  const auto& unprojected_index = last_results.unprojected_index;
+
+  // The log-sum-exp of each block cannot be accumulated across blocks.
+  if (op == FloatReduceOp::kLogSumExp && projected_index.size() > 1) {
+    return false;
+  }
+
+  const bool reduce_rows = last_results.last_loop_red_inc == 1;
+  if (!reduce_rows && last_results.last_loop_inc != 1) {
+    return false;
+  }
+
+  const MLAS_REDUCE_KIND kind = GetMlasReduceKind(op);
+  const int64_t last_loop_size = last_results.last_loop_size;
+  const int64_t last_loop_inc = last_results.last_loop_inc;
+  const int64_t red_size = last_results.last_loop_red_size;
+  const int64_t red_inc = last_results.last_loop_red_inc;
+  const int64_t denominator = red_size * static_cast<int64_t>(projected_index.size());
+
+  auto fn = [&](std::ptrdiff_t first, std::ptrdiff_t end) {
+    // Process the outputs one run of the innermost kept axis at a time.
+    for (int64_t begin = first; begin < end;) {
+      const int64_t main_index = begin / last_loop_size;
+      const int64_t loop = begin % last_loop_size;
+      const int64_t run = std::min<int64_t>(end - begin, last_loop_size - loop);
+      const float* origin = from_data + unprojected_index[main_index] + loop * last_loop_inc;
+      float* out = to_data + begin;
+
+      bool accumulate = false;
+      for (auto index : projected_index) {
+        if (reduce_rows) {
+          MlasReduceRows(kind, origin + index, out, static_cast<size_t>(run), static_cast<size_t>(red_size),
+                         static_cast<size_t>(last_loop_inc), accumulate);
+        } else {
+          MlasReduceColumns(kind, origin + index, out, static_cast<size_t>(red_size), static_cast<size_t>(run),
+                            static_cast<size_t>(red_inc), accumulate);
+        }
+        accumulate = true;
+      }
+      FinalizeFloatReduce(op, out, run, denominator);
+
+      begin += run;
+    }
+  };
+
+  auto cost = ParallelReduceFastCost(1, denominator, sizeof(float), 6);
+  concurrency::ThreadPool::TryParallelFor(tp, count, cost, fn);
+  return true;
+}
+
+// The fast reductions of AGG, or their MLAS counterpart for the single precision reductions MLAS implements.
+template <typename AGG>
+FastReduceKind WhichFastReduce() {
+  if constexpr (FloatReduceOpFor<AGG>::value != FloatReduceOp::kNone) {
+    return FastReduceKind::kKR | FastReduceKind::kRK | FastReduceKind::kKRK | FastReduceKind::kRKR;
+  }
+  return AGG::WhichFastReduce();
+}
+
+template <typename AGG>
+void DispatchFastReduceKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+  if constexpr (FloatReduceOpFor<AGG>::value != FloatReduceOp::kNone) {
+    FloatFastReduceKR(input, fast_shape, output, tp, FloatReduceOpFor<AGG>::value);
+  } else {
+    AGG::FastReduceKR(input, fast_shape, output, tp);
+  }
+}
+
+template <typename AGG>
+void DispatchFastReduceRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                          Tensor& output, concurrency::ThreadPool* tp) {
+  if constexpr (FloatReduceOpFor<AGG>::value != FloatReduceOp::kNone) {
+    FloatFastReduceRK(input, fast_shape, output, tp, FloatReduceOpFor<AGG>::value);
+  } else {
+    AGG::FastReduceRK(input, fast_shape, output, tp);
+  }
+}
+
+template <typename AGG>
+void DispatchFastReduceKRK(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+  if constexpr (FloatReduceOpFor<AGG>::value != FloatReduceOp::kNone) {
+    FloatFastReduceKRK(input, fast_shape, output, tp, FloatReduceOpFor<AGG>::value);
+  } else {
+    AGG::FastReduceKRK(input, fast_shape, output, tp);
+  }
+}
+
+template <typename AGG>
+void DispatchFastReduceRKR(const Tensor& input, const gsl::span<const int64_t>& fast_shape,
+                           Tensor& output, concurrency::ThreadPool* tp) {
+  if constexpr (FloatReduceOpFor<AGG>::value != FloatReduceOp::kNone) {
+    FloatFastReduceRKR(input, fast_shape, output, tp, FloatReduceOpFor<AGG>::value);
+  } else {
+    AGG::FastReduceRKR(input, fast_shape, output, tp);
+  }
+}
+
+}  // namespace
+
 template <typename AGG>
 struct ParallelizedData {
   int64_t denominator;
@@ -400,9 +682,17 @@ void NoTransposeReduce1Loop(Tensor* output, const TensorShape& new_input_shape,
   typename AGG::value_type* to_data = output->template MutableData<typename AGG::value_type>();
   int64_t count = output_shape.Size();
 
+  constexpr FloatReduceOp float_op = FloatReduceOpFor<AGG>::value;
+
   if (reduced_axes.size() == 0 || reduced_axes.size() == new_input_shape.NumDimensions()) {
     ValidateNoTransposeReduce(count);
     int64_t input_size = new_input_shape.Size();
+    if constexpr (float_op != FloatReduceOp::kNone) {
+      MlasReduceRows(GetMlasReduceKind(float_op), from_data, to_data, 1, static_cast<size_t>(input_size),
+                     static_cast<size_t>(input_size), false);
+      FinalizeFloatReduce(float_op, to_data, 1, input_size);
+      return;
+    }
     to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
     return;
   }
@@ -414,6 +704,12 @@ void NoTransposeReduce1Loop(Tensor* output, const TensorShape& new_input_shape,
   }
   last_results.ValidateNotEmpty();
 
+  if constexpr (float_op != FloatReduceOp::kNone) {
+    if (FloatNoTransposeReduce(from_data, to_data, count, last_results, tp, float_op)) {
+      return;
+    }
+  }
+
   ParallelizedData<AGG> data;
   data.denominator = last_results.last_loop_red_size * last_results.projected_index.size();
   data.loop_size = last_results.last_loop_red_size * last_results.last_loop_red_inc;
@@ -465,9 +761,17 @@ void NoTransposeReduce2Loops(Tensor* output, const TensorShape& new_input_shape,
   typename AGG::value_type* to_data = output->template MutableData<typename AGG::value_type>();
   int64_t count = output_shape.Size();
 
+  constexpr FloatReduceOp float_op = FloatReduceOpFor<AGG>::value;
+
   if (reduced_axes.size() == 0 || reduced_axes.size() == new_input_shape.NumDimensions()) {
     ValidateNoTransposeReduce(count);
     int64_t input_size = new_input_shape.Size();
+    if constexpr (float_op != FloatReduceOp::kNone) {
+      MlasReduceRows(GetMlasReduceKind(float_op), from_data, to_data, 1, static_cast<size_t>(input_size),
+                     static_cast<size_t>(input_size), false);
+      FinalizeFloatReduce(float_op, to_data, 1, input_size);
+      return;
+    }
     to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
     return;
   }
@@ -479,6 +783,12 @@ void NoTransposeReduce2Loops(Tensor* output, const TensorShape& new_input_shape,
   }
   last_results.ValidateNotEmpty();
 
+  if constexpr (float_op != FloatReduceOp::kNone) {
+    if (FloatNoTransposeReduce(from_data, to_data, count, last_results, tp, float_op)) {
+      return;
+    }
+  }
+
   ParallelizedData<AGG> data;
   data.denominator = last_results.last_loop_red_size * last_results.projected_index.size();
   data.loop_size = last_results.last_loop_red_size * last_results.last_loop_red_inc;
@@ -755,8 +1065,8 @@ bool CommonFastReduce(OpKernelContext* ctx,
                       TensorShapeVector& fast_axes) {
   return CommonFastReduceSwitch(ctx, axes_, keepdims_, noop_with_empty_axes,
                                 fast_kind, fast_shape, output_shape, fast_axes,
-                                AGG::WhichFastReduce(), &AGG::FastReduceKR, &AGG::FastReduceRK,
-                                &AGG::FastReduceKRK, &AGG::FastReduceRKR);
+                                WhichFastReduce<AGG>(), &DispatchFastReduceKR<AGG>, &DispatchFastReduceRK<AGG>,
+                                &DispatchFastReduceKRK<AGG>, &DispatchFastReduceRKR<AGG>);
 }
 
 static void ValidateKeepDims(const TensorShape& shape, int64_t keepdims) {
@@ -917,11 +1227,11 @@ std::unique_ptr<Tensor> ReduceSum<T>::Impl(const Tensor& input, gsl::span<const
     return output;
   }
 
-  if (IsFastReduceKindAvailable(fast_kind, ReduceAggregatorSum<T>::WhichFastReduce())) {
+  if (IsFastReduceKindAvailable(fast_kind, WhichFastReduce<ReduceAggregatorSum<T>>())) {
     switch (fast_kind) {
       case FastReduceKind::kKR: {
         ValidateFastReduceKR(fast_shape, *output);
-        ReduceAggregatorSum<T>::FastReduceKR(input, fast_shape, *output, tp);
+        DispatchFastReduceKR<ReduceAggregatorSum<T>>(input, fast_shape, *output, tp);
         return output;
       }
       case FastReduceKind::kRK:
@@ -929,7 +1239,7 @@ std::unique_ptr<Tensor> ReduceSum<T>::Impl(const Tensor& input, gsl::span<const
         if (std::max(fast_shape[0], fast_shape[1]) >
             concurrency::ThreadPool::DegreeOfParallelism(tp) * 256) {
           // See benchmarks in PR #7719.
-          ReduceAggregatorSum<T>::FastReduceRK(input, fast_shape, *output, tp);
+          DispatchFastReduceRK<ReduceAggregatorSum<T>>(input, fast_shape, *output, tp);
           return output;
         } else {
           break;
@@ -938,7 +1248,7 @@ std::unique_ptr<Tensor> ReduceSum<T>::Impl(const Tensor& input, gsl::span<const
         ValidateFastReduceKRK(fast_shape, *output);
         if (fast_shape[0] >= std::max(2, concurrency::ThreadPool::DegreeOfParallelism(tp))) {
           // See benchmarks in PR #7719.
-          ReduceAggregatorSum<T>::FastReduceKRK(input, fast_shape, *output, tp);
+          DispatchFastReduceKRK<ReduceAggregatorSum<T>>(input, fast_shape, *output, tp);
           return output;
         } else {
           break;
@@ -946,7 +1256,7 @@ std::unique_ptr<Tensor> ReduceSum<T>::Impl(const Tensor& input, gsl::span<const
       case FastReduceKind::kRKR:
         ValidateFastReduceRKR(fast_shape, *output);
         if (fast_shape[0] >= std::max(2, concurrency::ThreadPool::DegreeOfParallelism(tp))) {
-          ReduceAggregatorSum<T>::FastReduceRKR(input, fast_shape, *output, tp);
+          DispatchFastReduceRKR<ReduceAggregatorSum<T>>(input, fast_shape, *output, tp);
           return output;
         } else {
           break;
@@ -55,11 +55,23 @@ class DeepCpuGruOp final : public OpKernel {
         "Batchwise recurrent operations (layout == 1) are not supported. If you need support create a github issue with justification.");
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
   Status Compute(OpKernelContext* context) const override;
 
   ~DeepCpuGruOp() override = default;
 
  private:
+  Status TryPackInputWeights(const Tensor& weights, AllocatorPtr& alloc, bool& is_packed);
+
+  Status TryPackRecurrentWeights(const Tensor& weights, AllocatorPtr& alloc, bool& is_packed);
+
   rnn::detail::Direction direction_;
   int num_directions_;
 
@@ -70,6 +82,12 @@ class DeepCpuGruOp final : public OpKernel {
 
   rnn::detail::ActivationFuncs activation_funcs_;
 
+  // W is packed as a whole. R is packed as two separate matrices as R[zr] and R[h] are applied in
+  // separate GEMMs, with rt applied in between.
+  rnn::detail::PackedWeights pre_packed_input_weights_;
+  rnn::detail::PackedWeights pre_packed_recurrent_ZR_;
+  rnn::detail::PackedWeights pre_packed_recurrent_H_;
+
   template <typename T>
   Status ComputeImpl(OpKernelContext& context) const;
 };
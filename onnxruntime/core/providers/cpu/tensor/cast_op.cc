@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <cstdio>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "boost/mp11.hpp"
 
@@ -15,6 +17,8 @@
 #include "core/framework/data_types.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/util/math_cpuonly.h"
@@ -22,10 +26,6 @@
 #include "Eigen/src/Core/arch/Default/BFloat16.h"
 #include "Eigen/src/Core/arch/Default/Half.h"
 
-#if defined(_M_AMD64) && !defined(_M_ARM64EC)
-#include "core/mlas/inc/mlas.h"
-#endif
-
 namespace onnxruntime {
 
 namespace op_kernel_type_control {
@@ -171,19 +171,32 @@ struct EigenCastType<BFloat16> {
   using type = Eigen::bfloat16;
 };
 
+// runs cast_fn(first, last) over [0, count), splitting large tensors across the operator thread pool
+template <typename SrcType, typename DstType, typename CastFn>
+void ParallelCast(const OpKernelContext& context, std::ptrdiff_t count, CastFn&& cast_fn) {
+  concurrency::ThreadPool::TryParallelFor(
+      context.GetOperatorThreadPool(), count,
+      TensorOpCost{static_cast<double>(sizeof(SrcType)), static_cast<double>(sizeof(DstType)), 1.0},
+      std::forward<CastFn>(cast_fn));
+}
+
 // generic tensor X -> Y
 template <typename SrcType, typename DstType, typename Enable = void>
 struct TensorCaster {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
     using SrcEigenCastType = typename EigenCastType<SrcType>::type;
     using DstEigenCastType = typename EigenCastType<DstType>::type;
 
     const std::ptrdiff_t shape_size = gsl::narrow<std::ptrdiff_t>(shape.Size());
-    const auto in_vector =
-        ConstEigenVectorMap<SrcEigenCastType>(reinterpret_cast<const SrcEigenCastType*>(in.Data<SrcType>()), shape_size);
-    auto out_vector =
-        EigenVectorMap<DstEigenCastType>(reinterpret_cast<DstEigenCastType*>(out.MutableData<DstType>()), shape_size);
-    out_vector = in_vector.template cast<DstEigenCastType>();
+    const auto* in_data = reinterpret_cast<const SrcEigenCastType*>(in.Data<SrcType>());
+    auto* out_data = reinterpret_cast<DstEigenCastType*>(out.MutableData<DstType>());
+    ParallelCast<SrcType, DstType>(
+        context, shape_size,
+        [in_data, out_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+          const auto in_vector = ConstEigenVectorMap<SrcEigenCastType>(in_data + first, last - first);
+          auto out_vector = EigenVectorMap<DstEigenCastType>(out_data + first, last - first);
+          out_vector = in_vector.template cast<DstEigenCastType>();
+        });
   }
 };
 
@@ -213,35 +226,80 @@ struct TensorCaster<std::string, DstType> {
   }
 };
 
-#if defined(_M_AMD64) && !defined(_M_ARM64EC)
-// specializations to use optimized and Windows x64-specific
-// MlasConvertHalfToFloatBuffer() routine for MLFloat16 -> float conversion
+// tensor X -> Y using an MLAS conversion routine
+template <typename SrcType, typename DstType, typename MlasSrcType, typename MlasDstType>
+void CastWithMlas(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out,
+                  void(MLASCALL* convert)(const MlasSrcType*, MlasDstType*, size_t)) {
+  static_assert(sizeof(SrcType) == sizeof(MlasSrcType) && sizeof(DstType) == sizeof(MlasDstType),
+                "MLAS routine element types must match the tensor element types.");
+  const auto* in_data = reinterpret_cast<const MlasSrcType*>(in.Data<SrcType>());
+  auto* out_data = reinterpret_cast<MlasDstType*>(out.MutableData<DstType>());
+  ParallelCast<SrcType, DstType>(
+      context, gsl::narrow<std::ptrdiff_t>(shape.Size()),
+      [in_data, out_data, convert](std::ptrdiff_t first, std::ptrdiff_t last) {
+        convert(in_data + first, out_data + first, static_cast<size_t>(last - first));
+      });
+}
 
 // tensor MLFloat16 -> float
 template <>
 struct TensorCaster<MLFloat16, float> {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
-    auto out_data = out.MutableData<float>();
-    auto in_data = in.Data<MLFloat16>();
-    const size_t shape_size = gsl::narrow<size_t>(shape.Size());
-    MlasConvertHalfToFloatBuffer(&in_data[0].val, out_data, shape_size);
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastWithMlas<MLFloat16, float>(context, shape, in, out, MlasConvertHalfToFloatBuffer);
   }
 };
 
-Tensor GetIntermediateMLFloat16ToFloatTensor(
-    const OpKernelContext& context, const TensorShape& shape, const Tensor& in) {
-  AllocatorPtr allocator;
-  ORT_THROW_IF_ERROR(context.GetTempSpaceAllocator(&allocator));
-  Tensor out{DataTypeImpl::GetType<float>(), shape, allocator};
-  TensorCaster<MLFloat16, float>{}.Cast(context, shape, in, out);
-  return out;
-}
+// tensor float -> MLFloat16
+template <>
+struct TensorCaster<float, MLFloat16> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastWithMlas<float, MLFloat16>(context, shape, in, out, MlasConvertFloatToHalfBuffer);
+  }
+};
+
+// tensor BFloat16 -> float
+template <>
+struct TensorCaster<BFloat16, float> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastWithMlas<BFloat16, float>(context, shape, in, out, MlasConvertBFloat16ToFloatBuffer);
+  }
+};
+
+// tensor float -> BFloat16
+template <>
+struct TensorCaster<float, BFloat16> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastWithMlas<float, BFloat16>(context, shape, in, out, MlasConvertFloatToBFloat16Buffer);
+  }
+};
+
+// tensor int32_t -> float
+template <>
+struct TensorCaster<int32_t, float> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastWithMlas<int32_t, float>(context, shape, in, out, MlasConvertInt32ToFloatBuffer);
+  }
+};
 
+// tensor float -> int32_t/int8_t/uint8_t
+// values are truncated towards zero and saturate to the range of the output type
 template <typename DstType>
-void CastMLFloat16ThroughFloatTensor(
+struct TensorCaster<float, DstType,
+                    std::enable_if_t<std::is_same_v<DstType, int32_t> || std::is_same_v<DstType, int8_t> ||
+                                     std::is_same_v<DstType, uint8_t>>> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastWithMlas<float, DstType>(context, shape, in, out, MlasConvertFloatToIntegerBuffer<DstType>);
+  }
+};
+
+// tensor MLFloat16/BFloat16 -> X: convert to float with MLAS, then float -> X
+template <typename SrcType, typename DstType>
+void CastThroughFloatTensor(
     const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) {
-  // use optimized MLFloat16 -> float, then float -> DstType
-  Tensor intermediate_tensor = GetIntermediateMLFloat16ToFloatTensor(context, shape, in);
+  AllocatorPtr allocator;
+  ORT_THROW_IF_ERROR(context.GetTempSpaceAllocator(&allocator));
+  Tensor intermediate_tensor{DataTypeImpl::GetType<float>(), shape, allocator};
+  TensorCaster<SrcType, float>{}.Cast(context, shape, in, intermediate_tensor);
   TensorCaster<float, DstType>{}.Cast(context, shape, intermediate_tensor, out);
 }
 
@@ -249,7 +307,7 @@ void CastMLFloat16ThroughFloatTensor(
 template <typename DstType>
 struct TensorCaster<MLFloat16, DstType> {
   void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
-    CastMLFloat16ThroughFloatTensor<DstType>(context, shape, in, out);
+    CastThroughFloatTensor<MLFloat16, DstType>(context, shape, in, out);
   }
 };
 
@@ -257,10 +315,25 @@ struct TensorCaster<MLFloat16, DstType> {
 template <>
 struct TensorCaster<MLFloat16, std::string> {
   void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
-    CastMLFloat16ThroughFloatTensor<std::string>(context, shape, in, out);
+    CastThroughFloatTensor<MLFloat16, std::string>(context, shape, in, out);
+  }
+};
+
+// tensor BFloat16 -> X
+template <typename DstType>
+struct TensorCaster<BFloat16, DstType> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastThroughFloatTensor<BFloat16, DstType>(context, shape, in, out);
+  }
+};
+
+// tensor BFloat16 -> string
+template <>
+struct TensorCaster<BFloat16, std::string> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    CastThroughFloatTensor<BFloat16, std::string>(context, shape, in, out);
   }
 };
-#endif
 
 class Cast final : public OpKernel {
  public:
@@ -111,12 +111,32 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
       memcpy(dst_base + dst_offset, src_base + src_offset, block_size);
     }
   };
-  concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size),
-                                          [&lambda](ptrdiff_t first, ptrdiff_t last) {
-                                            for (int index = static_cast<int>(first), end = static_cast<int>(last); index < end; ++index) {
-                                              lambda(index);
-                                            }
-                                          });
+
+  // Prefetch the source row of the index kGatherPrefetchDistance ahead of the one being copied
+  auto prefetch = [&](int64_t index) {
+    int64_t batch = index / N;
+    Tin idx = indices_data[index % N];
+    idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
+    PrefetchGatherRow(src_base + batch * data_batch_bytes + idx * block_size, static_cast<size_t>(block_size));
+  };
+
+  const double block_bytes = static_cast<double>(block_size);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, M * N, TensorOpCost{block_bytes, block_bytes, 0.0},
+      [&lambda, &prefetch, is_string_type](ptrdiff_t first, ptrdiff_t last) {
+        constexpr ptrdiff_t distance = static_cast<ptrdiff_t>(kGatherPrefetchDistance);
+        if (!is_string_type) {
+          for (ptrdiff_t index = first, end = std::min(last, first + distance); index < end; ++index) {
+            prefetch(index);
+          }
+        }
+        for (ptrdiff_t index = first; index < last; ++index) {
+          if (!is_string_type && index + distance < last) {
+            prefetch(index + distance);
+          }
+          lambda(index);
+        }
+      });
 
   return Status::OK();
 }
@@ -3,13 +3,40 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
 #include "core/providers/common.h"
 #include "gatherbase.h"
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 namespace onnxruntime {
 
+// Gathered rows are usually scattered over a table much larger than the caches. The hardware prefetcher
+// cannot predict them, so row lookups issue prefetches for the rows a few indices ahead.
+constexpr int64_t kGatherPrefetchDistance = 4;
+
+// Only the head of a row is prefetched, the hardware prefetcher picks up the rest of a long row
+inline void PrefetchGatherRow(const void* row, size_t row_bytes) {
+  constexpr size_t kCacheLineSize = 64;
+  constexpr size_t kMaxPrefetchBytes = 4 * kCacheLineSize;
+  const char* p = static_cast<const char*>(row);
+  const size_t prefetch_bytes = std::min(row_bytes, kMaxPrefetchBytes);
+  for (size_t offset = 0; offset < prefetch_bytes; offset += kCacheLineSize) {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(p + offset, _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(p + offset);
+#else
+    ORT_UNUSED_PARAMETER(p);
+#endif
+  }
+}
+
 class Gather final : public OpKernel, public GatherBase {
  public:
   Gather(const OpKernelInfo& info) : OpKernel(info), GatherBase(info) {}
@@ -3,7 +3,9 @@
 
 #include "core/providers/cpu/tensor/pad.h"
 
+#include "core/framework/copy.h"
 #include "core/framework/op_kernel_type_control_utils.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/util/math.h"
@@ -167,6 +169,72 @@ static void PadAxisConstant(T* output, T constant, size_t size) {
   }
 }
 
+// Constant padding writes each output element once: the (possibly sliced) input is copied into the interior of the
+// output with the shared parallel strided copy, then the padding around it is filled in parallel, one row of the
+// innermost axis at a time.
+template <typename T>
+static void PadConstant(concurrency::ThreadPool* tp, const T* input_data, const TensorShapeVector& input_dims,
+                        const TensorShapeVector& input_starts, const TensorShapeVector& input_extents,
+                        const PadsVector& pads, const TensorShapeVector& output_dims,
+                        const TensorPitches& output_pitches, T value, T* output) {
+  const size_t rank = output_dims.size();
+  const TensorPitches input_pitches(input_dims);
+
+  bool has_interior = true;
+  std::ptrdiff_t input_offset = 0;
+  std::ptrdiff_t output_offset = 0;
+  for (size_t i = 0; i < rank; ++i) {
+    has_interior = has_interior && input_extents[i] > 0;
+    input_offset += static_cast<std::ptrdiff_t>(input_starts[i] * input_pitches[i]);
+    output_offset += static_cast<std::ptrdiff_t>(pads[i] * output_pitches[i]);
+  }
+
+  if (has_interior) {
+    StridedCopy<T>(tp, output + output_offset, output_pitches, TensorShape(input_extents),
+                   input_data + input_offset, input_pitches);
+  }
+
+  const size_t inner_axis = rank - 1;
+  const size_t row_size = static_cast<size_t>(output_dims[inner_axis]);
+  const size_t pre_pad = static_cast<size_t>(pads[inner_axis]);
+  const size_t post_pad_start = pre_pad + static_cast<size_t>(input_extents[inner_axis]);
+  const std::ptrdiff_t num_rows = static_cast<std::ptrdiff_t>(
+      TensorShape(output_dims).SizeToDimension(inner_axis));
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, num_rows, TensorOpCost{0, static_cast<double>(row_size * sizeof(T)), 0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        // index of the first row in the outer axes
+        TensorShapeVector index(inner_axis);
+        for (size_t axis = inner_axis, remaining = static_cast<size_t>(first); axis-- > 0;) {
+          index[axis] = static_cast<int64_t>(remaining % static_cast<size_t>(output_dims[axis]));
+          remaining /= static_cast<size_t>(output_dims[axis]);
+        }
+
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          bool is_interior = has_interior;
+          for (size_t axis = 0; is_interior && axis < inner_axis; ++axis) {
+            is_interior = index[axis] >= pads[axis] && index[axis] < pads[axis] + input_extents[axis];
+          }
+
+          T* row_start = output + row * row_size;
+          if (is_interior) {
+            PadAxisConstant(row_start, value, pre_pad);
+            PadAxisConstant(row_start + post_pad_start, value, row_size - post_pad_start);
+          } else {
+            PadAxisConstant(row_start, value, row_size);
+          }
+
+          for (size_t axis = inner_axis; axis-- > 0;) {
+            if (++index[axis] < output_dims[axis]) {
+              break;
+            }
+            index[axis] = 0;
+          }
+        }
+      });
+}
+
 Status PadBase::HandleDimValueZero(const Mode& mode, const TensorShape& input_shape, TensorShape& output_shape) {
   switch (mode) {
     case Mode::Constant: {
@@ -323,15 +391,23 @@ static Status PadImpl(OpKernelContext* ctx,
     return PadInputWithDimValueOfZero(ctx, mode, orig_input_shape, output_dims, value);
   }
 
-  TensorShape input_shape(reshaped_input_dims);
-  SliceIterator<T> input(input_tensor, input_shape, input_starts, input_extents, {});
-
   // output_shape need to keep original.
   TensorShape output_shape(output_dims);
   auto& output_tensor = *ctx->Output(0, output_shape);
   auto* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
 
   TensorPitches output_pitches(reshaped_output_dims);
+
+  if (mode == Mode::Constant) {
+    PadConstant(ctx->GetOperatorThreadPool(), reinterpret_cast<const T*>(input_tensor.DataRaw()),
+                reshaped_input_dims, input_starts, input_extents, reshaped_pad, reshaped_output_dims,
+                output_pitches, value, output);
+    return Status::OK();
+  }
+
+  // edge and reflect padding read back values that were just written, so they walk the output in order
+  TensorShape input_shape(reshaped_input_dims);
+  SliceIterator<T> input(input_tensor, input_shape, input_starts, input_extents, {});
   size_t alignSkip = 0;  // Amount to skip to align to where the next input tensor data needs to be written
 
   // Initial skip, sum up the begin padding on each axis
@@ -342,34 +418,7 @@ static Status PadImpl(OpKernelContext* ctx,
 
   switch (mode) {
     case Mode::Constant:
-      // Loop over the output tensor, writing out padding between the blocks of copied data
-      // On loop entry, 'pad' is already set to the first continuous block of padding, and
-      // after every pass through the inner loop it gets set to the next continuous pad size.
-      while (input_counters) {
-        output += alignSkip;
-        {
-          T* axisStart = output;
-          output = input.CopyInnermostAxisSolitaryInnerStep(output);
-
-          int64_t prePad = reshaped_pad[inner_axis];
-          int64_t postPad = reshaped_pad[inner_axis + new_dims_count];
-          PadAxisConstant(axisStart - prePad, value, prePad);
-          PadAxisConstant(output, value, postPad);
-          output += postPad;
-          alignSkip = prePad;
-        }
-        // Calculate the size of the next block of padding (skipping over the innermost axis since that's already done)
-        while (input_counters.Increment()) {
-          ptrdiff_t inner_pitch = output_pitches[input_counters.Axis()];
-          T* axisStart = output - inner_pitch * input_extents[input_counters.Axis()];
-          int64_t prePad = reshaped_pad[input_counters.Axis()];
-          int64_t postPad = reshaped_pad[input_counters.Axis() + new_dims_count];
-          PadAxisConstant(axisStart - prePad * inner_pitch, value, prePad * inner_pitch);
-          PadAxisConstant(output, value, postPad * inner_pitch);
-          output += inner_pitch * postPad;
-          alignSkip += inner_pitch * prePad;
-        }
-      }
+      // handled by PadConstant above
       break;
 
     case Mode::Edge:
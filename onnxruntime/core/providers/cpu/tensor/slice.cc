@@ -6,6 +6,7 @@
 #include <limits>
 #include <unordered_map>
 
+#include "core/framework/copy.h"
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/providers/common.h"
@@ -45,7 +46,9 @@ using EnabledIndicesTypes = ORT_OP_KERNEL_ARG_ENABLED_TYPE_LIST_ALL_OPSETS(kCpuE
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Slice,
     1, 9,
-    KernelDefBuilder().TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<DataTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>()),
+    KernelDefBuilder()
+        .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<DataTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
+        .MayView(0, 0),
     Slice1);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -53,7 +56,8 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     10, 10,
     KernelDefBuilder()
         .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<DataTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
-        .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<IndicesTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>()),
+        .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<IndicesTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>())
+        .MayView(0, 0),
     Slice10);
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -62,7 +66,8 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     12,
     KernelDefBuilder()
         .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<DataTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
-        .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<IndicesTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>()),
+        .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<IndicesTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>())
+        .MayView(0, 0),
     Slice10);
 
 ONNX_CPU_OPERATOR_KERNEL(
@@ -70,7 +75,8 @@ ONNX_CPU_OPERATOR_KERNEL(
     13,
     KernelDefBuilder()
         .TypeConstraint("T", BuildKernelDefConstraintsFromTypeList<DataTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledDataTypes>())
-        .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<IndicesTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>()),
+        .TypeConstraint("Tind", BuildKernelDefConstraintsFromTypeList<IndicesTypes>(), BuildKernelDefConstraintsFromTypeList<EnabledIndicesTypes>())
+        .MayView(0, 0),
     Slice10);
 
 // Check if it's possible to combine innermost dimensions so we copy larger blocks.
@@ -222,41 +228,53 @@ static Status SliceImpl(OpKernelContext* ctx,
   if (output_shape.Size() == 0)
     return Status::OK();
 
-  // use MutableDataRaw as actual data type in tensor may not match as we templatize on data size
-  T* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
-  const auto* output_end = output + output_tensor.Shape().Size();
-
-  auto create_output = [&output, &output_end](SliceIterator<T>& slice_input_iterator) {
-    if (slice_input_iterator.SolitaryInnerStep()) {
-      while (output < output_end) {
-        output = slice_input_iterator.CopyInnermostAxisSolitaryInnerStep(output);
-      }
-    } else {
-      while (output < output_end) {
-        output = slice_input_iterator.CopyInnermostAxisNonSolitaryInnerStep(output);
-      }
-    }
+  // if we have flattened output dims we need to also flatten the input dims.
+  // as we're combining the innermost dims and keeping all values we can just copy the size of the last dim
+  const auto& copy_dims = compute_metadata.p_flattened_output_dims_ ? *compute_metadata.p_flattened_output_dims_
+                                                                    : compute_metadata.output_dims_;
+  auto input_dims = input_tensor.Shape().AsShapeVector();
+  if (compute_metadata.p_flattened_output_dims_) {
+    input_dims.resize(copy_dims.size());
+    input_dims.back() = copy_dims.back();
+  }
 
-    ORT_ENFORCE(output == output_end);
-  };
+  // the output is a strided view of the input: it starts at 'starts' and each axis steps 'steps' input elements,
+  // so it can be produced by the shared (parallel) strided copy.
+  const TensorPitches input_pitches(input_dims);
+  TensorShapeVector input_strides(input_dims.size());
+  std::ptrdiff_t input_offset = 0;
+  for (size_t i = 0; i < input_dims.size(); ++i) {
+    input_offset += static_cast<std::ptrdiff_t>(compute_metadata.starts_[i] * input_pitches[i]);
+    input_strides[i] = input_pitches[i] * compute_metadata.steps_[i];
+  }
 
-  if (compute_metadata.p_flattened_output_dims_) {
-    // if we have flattened output dims we need to also flatten the input dims.
-    // as we're combining the innermost dims and keeping all values we can just copy the size of the last dim
-    auto flattened_input_dims = input_tensor.Shape().AsShapeVector();
-    flattened_input_dims.resize(compute_metadata.p_flattened_output_dims_->size());
-    flattened_input_dims.back() = compute_metadata.p_flattened_output_dims_->back();
-    TensorShape input_shape(flattened_input_dims);
-
-    auto input_iterator2 = SliceIterator<T>(input_tensor, input_shape, compute_metadata.starts_,
-                                            *compute_metadata.p_flattened_output_dims_, compute_metadata.steps_);
-    create_output(input_iterator2);
-  } else {
-    auto input_iterator2 = SliceIterator<T>(input_tensor, compute_metadata.starts_, compute_metadata.output_dims_,
-                                            compute_metadata.steps_);
-    create_output(input_iterator2);
+  // a slice that keeps everything in the inner axes (e.g. a range along the outermost axis) is a contiguous range
+  // of the input. it can be a view of the input if the output was planned to share the input's buffer.
+  const TensorPitches output_pitches(copy_dims);
+  bool is_contiguous = true;
+  for (size_t i = 0; i < copy_dims.size(); ++i) {
+    if (copy_dims[i] != 1 && input_strides[i] != output_pitches[i]) {
+      is_contiguous = false;
+      break;
+    }
+  }
+
+  AllocatorPtr allocator;
+  ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
+  if (MakeViewIfSharingBuffer(input_tensor, output_tensor, is_contiguous,
+                              input_offset * static_cast<std::ptrdiff_t>(input_tensor.DataType()->Size()),
+                              allocator)) {
+    return Status::OK();
   }
 
+  // use MutableDataRaw as actual data type in tensor may not match as we templatize on data size
+  StridedCopy<T>(ctx->GetOperatorThreadPool(),
+                 reinterpret_cast<T*>(output_tensor.MutableDataRaw()),
+                 TensorPitches(copy_dims),
+                 TensorShape(copy_dims),
+                 reinterpret_cast<const T*>(input_tensor.DataRaw()) + input_offset,
+                 input_strides);
+
   return Status::OK();
 }
 
@@ -5,11 +5,10 @@
 
 #include "gsl/gsl"
 
+#include "core/framework/copy.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/providers/common.h"
 #include "core/providers/op_kernel_type_control.h"
-#include "core/util/math.h"
-#include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
 
@@ -38,7 +37,8 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
                                       BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>())
         .FixedTypeConstraintForHash(
             "T",
-            BuildKernelDefConstraintsFromTypeList<OldSplitDataTypes>()),
+            BuildKernelDefConstraintsFromTypeList<OldSplitDataTypes>())
+        .VariadicMayView(0, 0),
     Split);
 
 // Opset 11 starts to support Neg Axis.
@@ -51,7 +51,8 @@ ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
                                       BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>())
         .FixedTypeConstraintForHash(
             "T",
-            BuildKernelDefConstraintsFromTypeList<OldSplitDataTypes>()),
+            BuildKernelDefConstraintsFromTypeList<OldSplitDataTypes>())
+        .VariadicMayView(0, 0),
     Split);
 
 // Opset 13 starts to supports 'split' as optional input.
@@ -63,7 +64,8 @@ ONNX_CPU_OPERATOR_KERNEL(
                                       BuildKernelDefConstraintsFromTypeList<EnabledSplitDataTypes>())
         .FixedTypeConstraintForHash(
             "T",
-            BuildKernelDefConstraintsFromTypeList<OldSplitDataTypes>()),
+            BuildKernelDefConstraintsFromTypeList<OldSplitDataTypes>())
+        .VariadicMayView(0, 0),
     Split);
 
 Status SplitBase::PrepareForCompute(const TensorShape& input_shape, int num_outputs, int64_t& axis, int& before_dims,
@@ -108,53 +110,15 @@ Status SplitBase::PrepareForCompute(const TensorShape& input_shape, int num_outp
 Status Split::Compute(OpKernelContext* context) const {
   const Tensor& input = *context->Input<Tensor>(0);
 
-  Status status;
-
-  // Note: The non-string implementations can probably be based on data type size.
-  if (input.IsDataType<float>())
-    status = ComputeImpl<float>(*context, input);
-  else if (input.IsDataType<int32_t>())
-    status = ComputeImpl<int32_t>(*context, input);
-  else if (input.IsDataType<int64_t>())
-    status = ComputeImpl<int64_t>(*context, input);
-  else if (input.IsDataType<uint8_t>())
-    status = ComputeImpl<uint8_t>(*context, input);
-  else if (input.IsDataType<int8_t>())
-    status = ComputeImpl<int8_t>(*context, input);
-  else if (input.IsDataTypeString())
-    status = ComputeImpl<std::string>(*context, input);
-  else
-    ORT_THROW("Split operator does not support ", input.DataType(), " yet");
-
-  return status;
-}
-
-template <typename T>
-inline void copy_data(const T* src, T* dst, size_t count) {
-  memcpy(dst, src, count * sizeof(T));
-}
-
-template <>
-inline void copy_data<std::string>(const std::string* src, std::string* dst, size_t count) {
-  const std::string* end = src + count;
-  std::copy(src, end, dst);
-}
-
-template <typename T>
-Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
-  if (!utils::HasType<EnabledSplitDataTypes, T>()) {
-    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Data type is not supported in this build.");
-  }
-
   auto& input_shape = input.Shape();
-  auto num_outputs = context.OutputCount();
+  auto num_outputs = context->OutputCount();
   int64_t axis = axis_;
   int before_dims = 0;
   int after_dims_including_split_axis = 0;
   int after_dims_excluding_split = 0;
   std::vector<int64_t> split_sizes;
 
-  const Tensor* split_tensor = context.Input<Tensor>(1);
+  const Tensor* split_tensor = context->Input<Tensor>(1);
   if (split_tensor != nullptr) {
     //override the attribute value with the input value for split
     ORT_ENFORCE(split_tensor->Shape().NumDimensions() == 1, "An split tensor must be a vector tensor.");
@@ -174,28 +138,33 @@ Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
 
   // copy dimensions so we can update the selected axis in place
   auto output_dimensions = input_shape.AsShapeVector();
+  const auto input_strides = StridesForTensor(input);
 
   int64_t input_offset = 0;
-  const T* input_data = input.template Data<T>();
+
+  // when there is nothing outside the split axis (e.g. splitting along axis 0) each output is a contiguous range of
+  // the input, so outputs planned to share the input's buffer can be views of it.
+  const bool is_contiguous = before_dims == 1;
+  const auto element_size = static_cast<std::ptrdiff_t>(input.DataType()->Size());
+  AllocatorPtr allocator;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
 
   for (int i = 0; i < num_outputs; ++i) {
     // update size of dimension for axis we're splitting on
     auto split_size = gsl::narrow<int>(split_sizes[i]);
     output_dimensions[axis] = split_size;
 
-    Tensor* output = context.Output(i, TensorShape{output_dimensions});
-    T* output_data = output->template MutableData<T>();
-
-    ::onnxruntime::math::CopyMatrix<T>(
-        before_dims,                                       // M
-        split_size * after_dims_excluding_split,           // N
-        static_cast<const T*>(input_data + input_offset),  // A
-        after_dims_including_split_axis,                   // lda
-        static_cast<T*>(output_data),                      // B
-        split_size * after_dims_excluding_split,           // ldb
-        [](const T* src, T* dst, size_t count) {
-          copy_data<T>(src, dst, count);
-        });
+    Tensor* output = context->Output(i, TensorShape{output_dimensions});
+
+    // each output is a strided view of the input, offset along the split axis. copy it with the shared
+    // (parallel) strided copy.
+    if (output->Shape().Size() != 0 &&
+        !MakeViewIfSharingBuffer(input, *output, is_contiguous, input_offset * element_size, allocator)) {
+      ORT_RETURN_IF_ERROR(DispatchStridedCopy<EnabledSplitDataTypes>(context->GetOperatorThreadPool(),
+                                                                     *output, 0, StridesForTensor(*output),
+                                                                     output->Shape(),
+                                                                     input, input_strides, input_offset));
+    }
 
     input_offset += static_cast<int64_t>(split_size) * after_dims_excluding_split;  // offset by the N data we used in this iteration
   }
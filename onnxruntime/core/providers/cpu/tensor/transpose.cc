@@ -7,9 +7,12 @@
 #include "core/framework/utils.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "utils.h"
 
+#include <algorithm>
+
 namespace onnxruntime {
 
 namespace op_kernel_type_control {
@@ -313,341 +316,253 @@ static Status DoUntypedTranspose(const gsl::span<const size_t>& permutations, co
 }
 
 /*
-Optimizations for moving a single axis either inwards or outwards.
-
-If moving outwards we can use a single reader and multiple writers. The number of writers is equal to the value of
-the axis being moved.
-
-  e.g. if the input is NHWC with shape {N, 300, 300, 3}, we can transpose to NCHW by reading once and having
-       one writer for each of the 3 channels at a different offset in the output, updating the offset for each item
-       in the batch of N.
-
-Similarly if one axis is moving inwards we can use a single writer and multiple readers. The number of readers is equal
-to the value of the axis being moved.
+Blocked transpose for element sizes of 1, 2, 4 and 8 bytes.
 
-  e.g. if the input is NCHW with shape {N, 3, 300, 300}, we can transpose to NHWC by writing once using one reader for
-       each of the 3 channels at a different offset in the input, updating the read offset for each item in the batch
-       of N.
+The permutation is first simplified: axes of size 1 are dropped and input axes that stay adjacent and in the same
+order in the output are merged. e.g. the attention head transpose {B, S, N, H} -> {B, N, S, H} with perm (0, 2, 1, 3)
+stays a 4D problem, but NCHW -> NHWC becomes {N, C, HW} with perm (0, 2, 1).
 
-This can be generalized for any input where only one axis is being moved, with the block size for each read/write
-being dependent on which axis is moving, what direction it's moving in, and where it's moving to.
+After that there are two cases:
+  - the innermost input axis is still the innermost output axis. Every output row is a contiguous run of the input,
+    so the transpose is a sequence of memcpy calls.
+  - otherwise two axes form a 2D transpose: the input axis that becomes innermost in the output (rows) and the
+    innermost input axis (columns). That plane is cut into tiles that fit in cache and each tile is transposed with
+    the MLAS micro-kernels (4x4 for 32-bit, 8x8 for 8-bit and 16-bit elements). 64-bit elements use a scalar loop.
 
-We use simple pointer arithmetic if the size of each read/write is a power of 2 and between 8 and 64 bits.
-We use memcpy if the block size is larger.
-
-We fall back to the default implementation in all other cases, and if the input is std::string.
+In both cases the work is a flat list of (outer index, tile) items, which is split across the intra-op threadpool.
 */
 
 namespace {
 
-template <typename T>
-struct has_mlas_transpose : std::false_type {};
-
-template <>
-struct has_mlas_transpose<uint8_t> : std::true_type {};
-
-template <>
-struct has_mlas_transpose<uint32_t> : std::true_type {};
-
-// moving a single axis outwards where the read/write size is a power of 2 and between 8 and 64 bits.
-template <typename T>
-typename std::enable_if<!has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisOutwards(const T* input_data, T* output_data,
-                                  int64_t num_loops, int64_t num_writers,
-                                  int64_t writes_per_loop, int64_t writes_per_writer_per_loop) {
-  const T* end;
-  for (int64_t l = 0; l < num_loops; ++l) {
-    T* output_for_first_writer = output_data;
-
-    for (auto wwpl = 0; wwpl < writes_per_writer_per_loop; ++wwpl) {
-      T* output_for_current_writer = output_for_first_writer;
-
-      end = input_data + num_writers;
-      for (; input_data != end;) {
-        *output_for_current_writer = *input_data++;
-
-        // skip to output position for next writer
-        output_for_current_writer += writes_per_writer_per_loop;
-      }
-
-      ++output_for_first_writer;
+// Tile edge in elements. A 64x64 tile of 4-byte elements is 16KB, so the source and destination tiles of one worker
+// stay in L1/L2.
+constexpr size_t kTransposeTileSize = 64;
+
+// Drops size 1 axes and merges input axes that remain adjacent and in the same order after the permutation.
+// `dims` receives the resulting input dims and `perm` the permutation over them.
+void CoalesceTransposeAxes(const gsl::span<const size_t>& permutations, gsl::span<const int64_t> input_dims,
+                           InlinedVector<size_t>& dims, InlinedVector<size_t>& perm) {
+  const size_t rank = input_dims.size();
+
+  InlinedVector<size_t> squeezed_axis(rank, 0);
+  InlinedVector<size_t> squeezed_dims;
+  for (size_t i = 0; i < rank; ++i) {
+    if (input_dims[i] != 1) {
+      squeezed_axis[i] = squeezed_dims.size();
+      squeezed_dims.push_back(static_cast<size_t>(input_dims[i]));
     }
-
-    output_data += writes_per_loop;
   }
-}
 
-template <typename T>
-typename std::enable_if<has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisOutwards(const T* input_data, T* output_data,
-                                  int64_t num_loops, int64_t num_writers,
-                                  int64_t writes_per_loop, int64_t writes_per_writer_per_loop) {
-  for (int64_t l = 0; l < num_loops; ++l) {
-    MlasTranspose(input_data,
-                  output_data,
-                  static_cast<size_t>(writes_per_writer_per_loop),
-                  static_cast<size_t>(num_writers));
-    input_data += writes_per_loop;
-    output_data += writes_per_loop;
+  InlinedVector<size_t> squeezed_perm;
+  for (size_t axis : permutations) {
+    if (input_dims[axis] != 1) {
+      squeezed_perm.push_back(squeezed_axis[axis]);
+    }
   }
-}
-
-//  `input_shape_override` overrides the shape of `input` for compute purposes.
-void TransposeSingleAxisOutwards(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
-                                 int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr) {
-  ORT_UNUSED_PARAMETER(permutations);
-
-  const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
-  const auto& input_dims = input_shape.GetDims();
-
-  const auto element_size = input.DataType()->Size();
-
-  const auto* input_data = reinterpret_cast<const uint8_t*>(input.DataRaw());
-  auto* output_data = reinterpret_cast<uint8_t*>(output.MutableDataRaw());
 
-  auto num_loops = input_shape.SizeToDimension(to);
-  auto num_writers = input_dims[from];
-  auto block_size = input_shape.SizeFromDimension(from + 1);
-  auto writes_per_loop = int64_t(input_shape.Size() / num_loops / block_size);
-  auto writes_per_writer_per_loop = int64_t(writes_per_loop / num_writers);
-  const int64_t bytes_per_write = block_size * element_size;
-
-  switch (bytes_per_write) {
-    case (sizeof(uint8_t)): {
-      SimpleTransposeSingleAxisOutwards(input_data, output_data,
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    case (sizeof(uint16_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint16_t*>(input_data),
-                                        reinterpret_cast<uint16_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    case (sizeof(uint32_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint32_t*>(input_data),
-                                        reinterpret_cast<uint32_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
+  // an input axis is merged into the previous one if it directly follows it in the output
+  const size_t squeezed_rank = squeezed_dims.size();
+  InlinedVector<bool> merged(squeezed_rank, false);
+  for (size_t i = 1; i < squeezed_rank; ++i) {
+    if (squeezed_perm[i] == squeezed_perm[i - 1] + 1) {
+      merged[squeezed_perm[i]] = true;
     }
-    case (sizeof(uint64_t)): {
-      SimpleTransposeSingleAxisOutwards(reinterpret_cast<const uint64_t*>(input_data),
-                                        reinterpret_cast<uint64_t*>(output_data),
-                                        num_loops, num_writers, writes_per_loop, writes_per_writer_per_loop);
-      break;
-    }
-    default: {
-      // we need to use memcpy for each block
-      for (int64_t l = 0; l < num_loops; ++l) {
-        uint8_t* output_for_first_writer = output_data;
-
-        for (auto wwpl = 0; wwpl < writes_per_writer_per_loop; ++wwpl) {
-          uint8_t* output_for_current_writer = output_for_first_writer;
-
-          for (int64_t w = 0; w < num_writers; ++w) {
-            memcpy(output_for_current_writer, input_data, bytes_per_write);
-            // skip to output position for next writer
-            output_for_current_writer += (writes_per_writer_per_loop * bytes_per_write);
-            input_data += bytes_per_write;
-          }
-
-          output_for_first_writer += bytes_per_write;
-        }
+  }
 
-        output_data += writes_per_loop * bytes_per_write;
-      }
+  InlinedVector<size_t> coalesced_axis(squeezed_rank, 0);
+  dims.clear();
+  for (size_t i = 0; i < squeezed_rank; ++i) {
+    if (!merged[i]) {
+      dims.push_back(1);
     }
+    coalesced_axis[i] = dims.size() - 1;
+    dims.back() *= squeezed_dims[i];
   }
-}
-
-template <typename T>
-typename std::enable_if<!has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisInwards(const T* input_data, T* output_data,
-                                 int64_t num_loops, int64_t num_readers,
-                                 int64_t reads_per_loop, int64_t reads_per_reader_per_loop) {
-  T* end;
-  for (int64_t l = 0; l < num_loops; ++l) {
-    const T* input_for_first_reader = input_data;
-
-    for (auto rrpl = 0; rrpl < reads_per_reader_per_loop; ++rrpl) {
-      const T* input_for_current_reader = input_for_first_reader;
-
-      end = output_data + num_readers;
-      for (; output_data != end;) {
-        *output_data++ = *input_for_current_reader;
-        // skip to input position for next reader
-        input_for_current_reader += reads_per_reader_per_loop;
-      }
 
-      ++input_for_first_reader;
+  perm.clear();
+  for (size_t i = 0; i < squeezed_rank; ++i) {
+    if (!merged[squeezed_perm[i]]) {
+      perm.push_back(coalesced_axis[squeezed_perm[i]]);
     }
-
-    input_data += reads_per_loop;
   }
 }
 
 template <typename T>
-typename std::enable_if<has_mlas_transpose<T>::value, void>::type
-SimpleTransposeSingleAxisInwards(const T* input_data, T* output_data,
-                                 int64_t num_loops, int64_t num_readers,
-                                 int64_t reads_per_loop, int64_t reads_per_reader_per_loop) {
-  for (int64_t l = 0; l < num_loops; ++l) {
-    MlasTranspose(input_data,
-                  output_data,
-                  static_cast<size_t>(num_readers),
-                  static_cast<size_t>(reads_per_reader_per_loop));
-    input_data += reads_per_loop;
-    output_data += reads_per_loop;
+void TransposeTile(const T* input, size_t input_stride, T* output, size_t output_stride, size_t m, size_t n) {
+  for (size_t j = 0; j < n; ++j) {
+    const T* s = input + j;
+    T* d = output + j * output_stride;
+    for (size_t i = 0; i < m; ++i) {
+      d[i] = *s;
+      s += input_stride;
+    }
   }
 }
 
-// moving a single axis inwards where the read/write size is a power of 2 and between 8 and 64 bits.
-//  `input_shape_override` overrides the shape of `input` for compute purposes.
-void TransposeSingleAxisInwards(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
-                                int64_t from, int64_t to, const TensorShape* input_shape_override = nullptr) {
-  ORT_UNUSED_PARAMETER(permutations);
-
-  const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
-  const auto& input_dims = input_shape.GetDims();
+void TransposeTile(const uint8_t* input, size_t input_stride, uint8_t* output, size_t output_stride,
+                   size_t m, size_t n) {
+  MlasTranspose(input, input_stride, output, output_stride, m, n);
+}
 
-  const auto element_size = input.DataType()->Size();
+void TransposeTile(const uint16_t* input, size_t input_stride, uint16_t* output, size_t output_stride,
+                   size_t m, size_t n) {
+  MlasTranspose(input, input_stride, output, output_stride, m, n);
+}
 
-  const auto* input_data = reinterpret_cast<const uint8_t*>(input.DataRaw());
-  auto* output_data = reinterpret_cast<uint8_t*>(output.MutableDataRaw());
+void TransposeTile(const uint32_t* input, size_t input_stride, uint32_t* output, size_t output_stride,
+                   size_t m, size_t n) {
+  MlasTranspose(input, input_stride, output, output_stride, m, n);
+}
 
-  auto num_loops = input_shape.SizeToDimension(from);
-  auto num_readers = input_dims[from];
-  auto block_size = input_shape.SizeFromDimension(to + 1);
-  auto reads_per_loop = int64_t(input_shape.Size() / num_loops / block_size);
-  auto reads_per_reader_per_loop = int64_t(reads_per_loop / num_readers);
-  const int64_t bytes_per_read = block_size * element_size;
+// `dims` and `perm` must be coalesced and describe at least 2 axes.
+template <typename T>
+void TransposeBlocked(gsl::span<const size_t> dims, gsl::span<const size_t> perm, const T* input, T* output,
+                      concurrency::ThreadPool* tp) {
+  const size_t rank = dims.size();
+
+  InlinedVector<size_t> input_strides(rank);
+  InlinedVector<size_t> output_strides(rank);
+  for (size_t i = rank, input_stride = 1, output_stride = 1; i-- > 0;) {
+    input_strides[i] = input_stride;
+    input_stride *= dims[i];
+    output_strides[i] = output_stride;
+    output_stride *= dims[perm[i]];
+  }
 
-  switch (bytes_per_read) {
-    case (sizeof(uint8_t)): {
-      SimpleTransposeSingleAxisInwards(input_data, output_data,
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
+  // row axis: the input axis that is innermost in the output. column axis: the innermost input axis.
+  const size_t row_axis = perm[rank - 1];
+  const size_t column_axis_in_output = static_cast<size_t>(
+      std::find(perm.begin(), perm.end(), rank - 1) - perm.begin());
+  const bool is_row_copy = row_axis == rank - 1;
+
+  // all other axes, in output order
+  InlinedVector<size_t> outer_dims;
+  InlinedVector<size_t> outer_input_strides;
+  InlinedVector<size_t> outer_output_strides;
+  size_t num_outer = 1;
+  for (size_t i = 0; i < rank; ++i) {
+    if (i != rank - 1 && i != column_axis_in_output) {
+      outer_dims.push_back(dims[perm[i]]);
+      outer_input_strides.push_back(input_strides[perm[i]]);
+      outer_output_strides.push_back(output_strides[i]);
+      num_outer *= dims[perm[i]];
     }
-    case (sizeof(uint16_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint16_t*>(input_data),
-                                       reinterpret_cast<uint16_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint32_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint32_t*>(input_data),
-                                       reinterpret_cast<uint32_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    case (sizeof(uint64_t)): {
-      SimpleTransposeSingleAxisInwards(reinterpret_cast<const uint64_t*>(input_data),
-                                       reinterpret_cast<uint64_t*>(output_data),
-                                       num_loops, num_readers, reads_per_loop, reads_per_reader_per_loop);
-      break;
-    }
-    default: {
-      // we need to use memcpy for each block
-      for (int64_t l = 0; l < num_loops; ++l) {
-        const uint8_t* input_for_first_reader = input_data;
+  }
 
-        for (auto rrpl = 0; rrpl < reads_per_reader_per_loop; ++rrpl) {
-          const uint8_t* input_for_current_reader = input_for_first_reader;
+  const size_t rows = is_row_copy ? 1 : dims[row_axis];
+  const size_t columns = dims[rank - 1];
+  const size_t row_stride = is_row_copy ? 0 : input_strides[row_axis];
+  const size_t column_stride = is_row_copy ? 0 : output_strides[column_axis_in_output];
+
+  // keep the tile area at roughly kTransposeTileSize^2 elements when one side of the plane is short
+  constexpr size_t tile_area = kTransposeTileSize * kTransposeTileSize;
+  const size_t tile_rows = std::min(rows, kTransposeTileSize);
+  const size_t tile_columns = std::min(columns, std::max(kTransposeTileSize, tile_area / tile_rows));
+  const size_t tiles_per_row = (columns + tile_columns - 1) / tile_columns;
+  const size_t tiles_per_outer = ((rows + tile_rows - 1) / tile_rows) * tiles_per_row;
+
+  auto transpose_tile = [&](const T* source, T* target, size_t tile) {
+    const size_t row = (tile / tiles_per_row) * tile_rows;
+    const size_t column = (tile % tiles_per_row) * tile_columns;
+    const size_t m = std::min(tile_rows, rows - row);
+    const size_t n = std::min(tile_columns, columns - column);
+    if (is_row_copy) {
+      memcpy(target + column, source + column, n * sizeof(T));
+    } else {
+      TransposeTile(source + row * row_stride + column, row_stride, target + column * column_stride + row,
+                    column_stride, m, n);
+    }
+  };
 
-          for (int64_t r = 0; r < num_readers; ++r) {
-            memcpy(output_data, input_for_current_reader, bytes_per_read);
-            output_data += bytes_per_read;
+  const double tile_bytes = static_cast<double>(tile_rows * tile_columns * sizeof(T));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_outer * tiles_per_outer), TensorOpCost{tile_bytes, tile_bytes, 0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        const size_t num_outer_axes = outer_dims.size();
+        InlinedVector<size_t> index(num_outer_axes);
+        size_t outer = static_cast<size_t>(first) / tiles_per_outer;
+        size_t tile = static_cast<size_t>(first) % tiles_per_outer;
+        const T* source = input;
+        T* target = output;
+        for (size_t i = num_outer_axes; i-- > 0;) {
+          index[i] = outer % outer_dims[i];
+          outer /= outer_dims[i];
+          source += index[i] * outer_input_strides[i];
+          target += index[i] * outer_output_strides[i];
+        }
 
-            // skip to input position for next reader
-            input_for_current_reader += (reads_per_reader_per_loop * bytes_per_read);
+        for (std::ptrdiff_t work = first; work < last; ++work) {
+          transpose_tile(source, target, tile);
+          if (++tile < tiles_per_outer) {
+            continue;
           }
 
-          input_for_first_reader += bytes_per_read;
+          // move to the next outer index
+          tile = 0;
+          for (size_t i = num_outer_axes; i-- > 0;) {
+            source += outer_input_strides[i];
+            target += outer_output_strides[i];
+            if (++index[i] < outer_dims[i]) {
+              break;
+            }
+            source -= index[i] * outer_input_strides[i];
+            target -= index[i] * outer_output_strides[i];
+            index[i] = 0;
+          }
         }
+      });
+}
 
-        input_data += reads_per_loop * bytes_per_read;
-      }
-    }
+template <typename T>
+bool TypedTransposeBlocked(gsl::span<const size_t> dims, gsl::span<const size_t> perm, const void* input,
+                           void* output, concurrency::ThreadPool* tp) {
+  constexpr bool enabled = utils::HasTypeWithSameSize<EnabledDataTypes, T>();
+
+  if (enabled) {
+    TransposeBlocked(dims, perm, static_cast<const T*>(input), static_cast<T*>(output), tp);
   }
+
+  return enabled;
 }
 
+// Returns false if the element size is not handled by the blocked transpose.
 //  `input_shape_override` overrides the shape of `input` for compute purposes.
-void SingleAxisTranspose(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
-                         size_t from, size_t to, const TensorShape* input_shape_override = nullptr) {
-  if (from > to) {
-    TransposeSingleAxisOutwards(permutations, input, output, from, to, input_shape_override);
-  } else {
-    TransposeSingleAxisInwards(permutations, input, output, from, to, input_shape_override);
+bool TryTransposeBlocked(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
+                         const TensorShape* input_shape_override, concurrency::ThreadPool* tp) {
+  if (input.IsDataTypeString()) {
+    return false;
   }
-}
-
-bool IsMovingSingleAxis(const gsl::span<const size_t>& permutations, size_t& from, size_t& to) {
-  // if a single axis moved to an outer dimension, the values should be one lower than the index until the slot the
-  // axis was moved from, and equal to the index after that.
-  // e.g. axis 3 moves out to 1 would be: 0, 3, 1, 2, 4
-  auto check_moved_outwards = [&permutations](size_t cur, size_t moved_from) {
-    // we start processing with the slot after the moved one, so the expected value is one less than the index
-    size_t expected = cur - 1;
-    for (size_t end = permutations.size(); cur < end; ++cur) {
-      if (permutations[cur] != expected) {
-        return false;
-      }
-
-      // we are at the slot the axis moved from, so do an additional increment before checking the next value
-      if (cur == moved_from) {
-        ++expected;
-      }
-
-      ++expected;
-    }
 
+  const auto& input_shape = input_shape_override ? *input_shape_override : input.Shape();
+  if (input_shape.Size() == 0) {
     return true;
-  };
-
-  // if a single axis moved to an inner dimension, the values should be one higher than the index until the slot the
-  // axis was moved to, and equal to the index after that.
-  // e.g. axis 1 moves inwards to 3 would be: 0, 2, 3, 1, 4
-  auto check_moved_inwards = [&permutations](size_t cur, size_t& moved_to) {
-    size_t started_at = cur;
-    size_t expected = cur + 1;
-    moved_to = std::numeric_limits<size_t>::max();
-
-    for (size_t end = permutations.size(); cur < end; ++cur) {
-      if (permutations[cur] != expected) {
-        // if a single axis moved it must have come from the location we started at
-        if (started_at != permutations[cur]) {
-          return false;
-        }
-
-        moved_to = cur;
-      } else {
-        ++expected;
-      }
-    }
+  }
 
-    return moved_to != std::numeric_limits<size_t>::max();
-  };
+  InlinedVector<size_t> dims;
+  InlinedVector<size_t> perm;
+  CoalesceTransposeAxes(permutations, input_shape.GetDims(), dims, perm);
 
-  bool single_axis_moved = false;
-  // check axis moving outwards (earlier entry in permutations)
-  for (size_t i = 0, end = permutations.size(); i < end; ++i) {
-    size_t axis = permutations[i];
-
-    if (axis != i) {
-      if (check_moved_outwards(i + 1, axis)) {
-        single_axis_moved = true;
-        to = i;
-        from = axis;
-      } else if (check_moved_inwards(i, to)) {
-        single_axis_moved = true;
-        from = i;
-      }
+  const auto element_size = input.DataType()->Size();
+  const void* input_data = input.DataRaw();
+  void* output_data = output.MutableDataRaw();
 
-      break;
-    }
+  if (dims.size() < 2) {
+    memcpy(output_data, input_data, static_cast<size_t>(input_shape.Size()) * element_size);
+    return true;
   }
 
-  return single_axis_moved;
+  switch (element_size) {
+    case sizeof(uint8_t):
+      return TypedTransposeBlocked<uint8_t>(dims, perm, input_data, output_data, tp);
+    case sizeof(uint16_t):
+      return TypedTransposeBlocked<uint16_t>(dims, perm, input_data, output_data, tp);
+    case sizeof(uint32_t):
+      return TypedTransposeBlocked<uint32_t>(dims, perm, input_data, output_data, tp);
+    case sizeof(uint64_t):
+      return TypedTransposeBlocked<uint64_t>(dims, perm, input_data, output_data, tp);
+    default:
+      return false;
+  }
 }
 
 }  // namespace
@@ -668,7 +583,7 @@ bool IsTransposeReshape(const gsl::span<const size_t>& perm, gsl::span<const int
 
 //`input_shape_override` overrides the shape of `input` for compute purposes.
 Status TransposeBase::DoTranspose(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
-                                  const TensorShape* input_shape_override) {
+                                  const TensorShape* input_shape_override, concurrency::ThreadPool* tp) {
   Status status = Status::OK();
 
   auto input_type = input.DataType();
@@ -686,12 +601,7 @@ Status TransposeBase::DoTranspose(const gsl::span<const size_t>& permutations, c
       return Status::OK();
     }
 
-    size_t from = 0, to = 0;
-    bool moving_single_axis = IsMovingSingleAxis(permutations, from, to);
-
-    if (moving_single_axis && !input.IsDataTypeString()) {
-      SingleAxisTranspose(permutations, input, output, from, to, input_shape_override);
-    } else {
+    if (!TryTransposeBlocked(permutations, input, output, input_shape_override, tp)) {
       // fall back to default implementation
       status = DoUntypedTranspose(permutations, input, output, input_shape_override);
     }
@@ -728,12 +638,7 @@ Status Transpose::Compute(OpKernelContext* ctx) const {
     return Status::OK();
   }
 
-  size_t from = 0, to = 0;
-  bool moving_single_axis = IsMovingSingleAxis(*p_perm, from, to);
-
-  if (moving_single_axis && !X.IsDataTypeString()) {
-    SingleAxisTranspose(*p_perm, X, Y, from, to);
-  } else {
+  if (!TryTransposeBlocked(*p_perm, X, Y, nullptr, ctx->GetOperatorThreadPool())) {
     // fall back to default implementation
     status = DoUntypedTranspose(*p_perm, X, Y);
   }
@@ -26,14 +26,20 @@ Status DoTransposeEltWise(int64_t num_axes, gsl::span<const int64_t> target_dims
                           const gsl::span<const size_t>& stride, const uint8_t* source, uint8_t* target,
                           size_t element_size);
 
+namespace concurrency {
+class ThreadPool;
+}
+
 class TransposeBase {
  public:
   /**
   Transpose the input Tensor into the output Tensor using the provided permutations.
   Both Tensors must have the same data type. `input_shape_override` overrides the shape of `input` for compute purposes.
+  If `tp` is provided the transpose is split across its threads.
   */
   static Status DoTranspose(const gsl::span<const size_t>& permutations, const Tensor& input, Tensor& output,
-                            const TensorShape* input_shape_override = nullptr);
+                            const TensorShape* input_shape_override = nullptr,
+                            concurrency::ThreadPool* tp = nullptr);
 
  protected:
   TransposeBase(const OpKernelInfo& info) {
@@ -398,22 +398,32 @@ static Status UpsampleLinear(const T* input,
 */
 
 struct BilinearParams {
+  // The arguments the tables were computed for
+  int64_t input_height;
+  int64_t input_width;
+  int64_t output_height;
+  int64_t output_width;
+  float height_scale;
+  float width_scale;
+  float roi_y_start;
+  float roi_y_end;
+  float roi_x_start;
+  float roi_x_end;
+
   std::vector<float> x_original;
   std::vector<float> y_original;
 
-  BufferUniquePtr idx_scale_data_buffer_holder;
+  std::vector<int64_t> input_width_mul_y1;
+  std::vector<int64_t> input_width_mul_y2;
 
-  int64_t* input_width_mul_y1;
-  int64_t* input_width_mul_y2;
-
-  int64_t* in_x1;
-  int64_t* in_x2;
+  std::vector<int64_t> in_x1;
+  std::vector<int64_t> in_x2;
 
-  float* dx1;
-  float* dx2;
+  std::vector<float> dx1;
+  std::vector<float> dx2;
 
-  float* dy1;
-  float* dy2;
+  std::vector<float> dy1;
+  std::vector<float> dy2;
 };
 
 // The following method supports a 4-D input in 'Linear mode'
@@ -421,16 +431,29 @@ struct BilinearParams {
 // the scale values for the outermost 2 dimensions are 1.
 // This is the common use-case where the 4-D input (batched multi-channel images)
 // is usually of shape [N, C, H, W] and the scales are [1.0, 1.0, height_scale, width_scale]
-static BilinearParams SetupUpsampleBilinear(int64_t input_height,
-                                            int64_t input_width,
-                                            int64_t output_height,
-                                            int64_t output_width,
-                                            float height_scale,
-                                            float width_scale,
-                                            const std::vector<float>& roi,
-                                            AllocatorPtr& alloc,
-                                            const GetOriginalCoordinateFunc& get_original_coordinate) {
-  BilinearParams p;
+// (or of shape [N, H, W, C] with scales [1.0, height_scale, width_scale, 1.0]).
+static void SetupUpsampleBilinear(int64_t input_height,
+                                  int64_t input_width,
+                                  int64_t output_height,
+                                  int64_t output_width,
+                                  float height_scale,
+                                  float width_scale,
+                                  float roi_y_start,
+                                  float roi_y_end,
+                                  float roi_x_start,
+                                  float roi_x_end,
+                                  const GetOriginalCoordinateFunc& get_original_coordinate,
+                                  BilinearParams& p) {
+  p.input_height = input_height;
+  p.input_width = input_width;
+  p.output_height = output_height;
+  p.output_width = output_width;
+  p.height_scale = height_scale;
+  p.width_scale = width_scale;
+  p.roi_y_start = roi_y_start;
+  p.roi_y_end = roi_y_end;
+  p.roi_x_start = roi_x_start;
+  p.roi_x_end = roi_x_end;
 
   p.x_original.reserve(output_width);
   p.y_original.reserve(output_height);
@@ -438,47 +461,25 @@ static BilinearParams SetupUpsampleBilinear(int64_t input_height,
   // For each index in the output height and output width, cache its corresponding indices in the input
   // while multiplying it with the input stride for that dimension (cache because we don't have to re-compute
   // each time we come across the output width/ output height value while iterating the output image tensor
-  SafeInt<size_t> idx_buffer_size = SafeInt<size_t>(2) * sizeof(int64_t) * (output_height + output_width);
+  p.input_width_mul_y1.resize(output_height);
+  p.input_width_mul_y2.resize(output_height);
+  p.in_x1.resize(output_width);
+  p.in_x2.resize(output_width);
 
   // For each index in the output height and output width, cache its corresponding "weights/scales" for its
   // corresponding indices in the input which proportionately indicates how much they will influence the final
   // pixel value in the output
-  // (cache because we don't have to re-compute each time we come across the output width/output height
-  // value while iterating the output image tensor
-  SafeInt<size_t> scale_buffer_size = SafeInt<size_t>(2) * sizeof(float_t) * (output_height + output_width);
-
-  // Limit number of allocations to just 1
-  auto inx_scale_data_buffer = alloc->Alloc(idx_buffer_size + scale_buffer_size);
-  p.idx_scale_data_buffer_holder = BufferUniquePtr(inx_scale_data_buffer, BufferDeleter(alloc));
-
-  // Get pointers to appropriate memory locations in the scratch buffer
-  auto* idx_data = static_cast<int64_t*>(p.idx_scale_data_buffer_holder.get());
-
-  // input_width is the stride for the height dimension
-  p.input_width_mul_y1 = idx_data;
-  p.input_width_mul_y2 = p.input_width_mul_y1 + output_height;
+  p.dy1.resize(output_height);
+  p.dy2.resize(output_height);
+  p.dx1.resize(output_width);
+  p.dx2.resize(output_width);
 
-  // stride for width is 1 (no multiplication needed)
-  p.in_x1 = p.input_width_mul_y1 + 2 * output_height;
-  p.in_x2 = p.in_x1 + output_width;
-
-  auto* scale_data = reinterpret_cast<float*>(p.in_x2 + output_width);
-
-  p.dy1 = scale_data;
-  p.dy2 = p.dy1 + output_height;
-
-  p.dx1 = p.dy1 + 2 * output_height;
-  p.dx2 = p.dx1 + output_width;
-
-  // Start processing
-  auto roi_y_start = roi.size() / 2 - 2;
-  auto roi_y_end = roi.size() - 2;
   for (int64_t y = 0; y < output_height; ++y) {
     float in_y = height_scale == 1 ? static_cast<float>(y)
                                    : get_original_coordinate(static_cast<float>(y), height_scale,
                                                              static_cast<float>(output_height),
                                                              static_cast<float>(input_height),
-                                                             roi[roi_y_start], roi[roi_y_end]);
+                                                             roi_y_start, roi_y_end);
     p.y_original.emplace_back(in_y);
     in_y = std::max(0.0f, std::min(in_y, static_cast<float>(input_height - 1)));
 
@@ -496,15 +497,13 @@ static BilinearParams SetupUpsampleBilinear(int64_t input_height,
     p.input_width_mul_y2[y] = input_width * in_y2;
   }
 
-  auto roi_x_start = roi.size() / 2 - 1;
-  auto roi_x_end = roi.size() - 1;
   for (int64_t x = 0; x < output_width; ++x) {
     float in_x = width_scale == 1 ? static_cast<float>(x)
                                   : get_original_coordinate(static_cast<float>(x),
                                                             width_scale,
                                                             static_cast<float>(output_width),
                                                             static_cast<float>(input_width),
-                                                            roi[roi_x_start], roi[roi_x_end]);
+                                                            roi_x_start, roi_x_end);
     p.x_original.emplace_back(in_x);
     in_x = std::max(0.0f, std::min(in_x, static_cast<float>(input_width - 1)));
 
@@ -518,8 +517,89 @@ static BilinearParams SetupUpsampleBilinear(int64_t input_height,
       p.dx2[x] = 0.5f;
     }
   }
+}
 
-  return p;
+template <typename T>
+std::shared_ptr<const BilinearParams> Upsample<T>::GetBilinearParams(int64_t input_height, int64_t input_width,
+                                                                     int64_t output_height, int64_t output_width,
+                                                                     float height_scale, float width_scale,
+                                                                     const std::vector<float>& roi,
+                                                                     size_t roi_y_index, size_t roi_x_index) const {
+  const size_t rank = roi.size() / 2;
+  const float roi_y_start = roi[roi_y_index];
+  const float roi_y_end = roi[rank + roi_y_index];
+  const float roi_x_start = roi[roi_x_index];
+  const float roi_x_end = roi[rank + roi_x_index];
+
+  std::lock_guard<OrtMutex> lock(bilinear_params_mutex_);
+  const BilinearParams* cached = bilinear_params_.get();
+  if (cached == nullptr ||
+      cached->input_height != input_height || cached->input_width != input_width ||
+      cached->output_height != output_height || cached->output_width != output_width ||
+      cached->height_scale != height_scale || cached->width_scale != width_scale ||
+      cached->roi_y_start != roi_y_start || cached->roi_y_end != roi_y_end ||
+      cached->roi_x_start != roi_x_start || cached->roi_x_end != roi_x_end) {
+    auto params = std::make_shared<BilinearParams>();
+    SetupUpsampleBilinear(input_height, input_width, output_height, output_width, height_scale, width_scale,
+                          roi_y_start, roi_y_end, roi_x_start, roi_x_end, get_original_coordinate_, *params);
+    bilinear_params_ = std::move(params);
+  }
+  return bilinear_params_;
+}
+
+// Float images without extrapolation are interpolated horizontally into two row buffers that are then blended
+// vertically. The blend is a contiguous loop that vectorizes, and when upscaling consecutive output rows reuse
+// the horizontal pass of the same source rows.
+static void UpsampleBilinearFloatRows(int64_t input_height,
+                                      int64_t input_width,
+                                      int64_t output_height,
+                                      int64_t output_width,
+                                      const float* XdataBase,
+                                      float* YdataBase,
+                                      const BilinearParams& p,
+                                      std::ptrdiff_t first,
+                                      std::ptrdiff_t last) {
+  std::vector<float> row_buffer(SafeInt<size_t>(2) * output_width);
+  float* row1 = row_buffer.data();
+  float* row2 = row1 + output_width;
+  const float* row1_source = nullptr;
+  const float* row2_source = nullptr;
+
+  auto interpolate_row = [&](const float* source, float* row) {
+    for (int64_t x = 0; x < output_width; ++x) {
+      row[x] = p.dx2[x] * source[p.in_x1[x]] + p.dx1[x] * source[p.in_x2[x]];
+    }
+  };
+
+  for (std::ptrdiff_t output_row = first; output_row < last; ++output_row) {
+    const int64_t image = output_row / output_height;
+    const int64_t y = output_row % output_height;
+    const float* Xdata = XdataBase + image * (input_height * input_width);
+    float* Ydata = YdataBase + output_row * output_width;
+
+    const float* source1 = Xdata + p.input_width_mul_y1[y];
+    const float* source2 = Xdata + p.input_width_mul_y2[y];
+
+    if (source1 != row1_source) {
+      if (source1 == row2_source) {
+        std::swap(row1, row2);
+        std::swap(row1_source, row2_source);
+      } else {
+        interpolate_row(source1, row1);
+        row1_source = source1;
+      }
+    }
+    if (source2 != row2_source) {
+      interpolate_row(source2, row2);
+      row2_source = source2;
+    }
+
+    const float dy1 = p.dy1[y];
+    const float dy2 = p.dy2[y];
+    for (int64_t x = 0; x < output_width; ++x) {
+      Ydata[x] = dy2 * row1[x] + dy1 * row2[x];
+    }
+  }
 }
 
 template <typename T>
@@ -529,50 +609,120 @@ void UpsampleBilinear(int64_t batch_size,
                       int64_t input_width,
                       int64_t output_height,
                       int64_t output_width,
-                      float height_scale,
-                      float width_scale,
-                      const std::vector<float>& roi,
                       bool use_extrapolation,
                       float extrapolation_value,
                       const T* XdataBase,
                       T* YdataBase,
-                      AllocatorPtr& alloc,
-                      const GetOriginalCoordinateFunc& get_original_coordinate,
+                      const BilinearParams& p,
                       concurrency::ThreadPool* tp) {
-  BilinearParams p = SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
-                                           height_scale, width_scale, roi,
-                                           alloc, get_original_coordinate);
+  // Each unit of work is a row of one output image, so images with few channels are split across threads too
+  const std::ptrdiff_t output_rows = static_cast<std::ptrdiff_t>(batch_size * num_channels * output_height);
+  const TensorOpCost cost{static_cast<double>(4 * sizeof(T) * output_width),
+                          static_cast<double>(sizeof(T) * output_width),
+                          static_cast<double>(8 * output_width)};
+
+  if constexpr (std::is_same<T, float>::value) {
+    if (!use_extrapolation) {
+      concurrency::ThreadPool::TryParallelFor(
+          tp, output_rows, cost,
+          [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+            UpsampleBilinearFloatRows(input_height, input_width, output_height, output_width,
+                                      XdataBase, YdataBase, p, first, last);
+          });
+      return;
+    }
+  }
 
-  for (int64_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(
-        tp, num_channels,
-        [&](std::ptrdiff_t c) {
-          const T* Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
-          T* Ydata = YdataBase + (n * num_channels + c) * (output_height * output_width);
-          for (int64_t y = 0; y < output_height; ++y) {
-            for (int64_t x = 0; x < output_width; ++x) {
-              // when use_extrapolation is set and original index of x or y is out of the dim range
-              // then use extrapolation_value as the output value.
-              if (use_extrapolation &&
-                  ((p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
-                   (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
-                Ydata[output_width * y + x] = static_cast<T>(extrapolation_value);
-                continue;
-              }
+  concurrency::ThreadPool::TryParallelFor(
+      tp, output_rows, cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t output_row = first; output_row < last; ++output_row) {
+          const int64_t image = output_row / output_height;
+          const int64_t y = output_row % output_height;
+          const T* Xdata = XdataBase + image * (input_height * input_width);
+          T* Ydata = YdataBase + output_row * output_width;
+          for (int64_t x = 0; x < output_width; ++x) {
+            // when use_extrapolation is set and original index of x or y is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation &&
+                ((p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
+                 (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
+              Ydata[x] = static_cast<T>(extrapolation_value);
+              continue;
+            }
+
+            T X11 = Xdata[p.input_width_mul_y1[y] + p.in_x1[x]];
+            T X21 = Xdata[p.input_width_mul_y1[y] + p.in_x2[x]];
+            T X12 = Xdata[p.input_width_mul_y2[y] + p.in_x1[x]];
+            T X22 = Xdata[p.input_width_mul_y2[y] + p.in_x2[x]];
+
+            Ydata[x] = static_cast<T>(p.dx2[x] * p.dy2[y] * X11 +
+                                      p.dx1[x] * p.dy2[y] * X21 +
+                                      p.dx2[x] * p.dy1[y] * X12 +
+                                      p.dx1[x] * p.dy1[y] * X22);
+          }
+        }
+      });
+}
+
+// Bilinear resize of a [N, H, W, C] input with scales [1.0, height_scale, width_scale, 1.0]. The channels of a
+// pixel are contiguous, so the four weights of an output pixel are applied to a vector of channels.
+template <typename T>
+void NhwcUpsampleBilinear(int64_t batch_size,
+                          int64_t num_channels,
+                          int64_t input_height,
+                          int64_t input_width,
+                          int64_t output_height,
+                          int64_t output_width,
+                          bool use_extrapolation,
+                          float extrapolation_value,
+                          const T* XdataBase,
+                          T* YdataBase,
+                          const BilinearParams& p,
+                          concurrency::ThreadPool* tp) {
+  const std::ptrdiff_t output_rows = static_cast<std::ptrdiff_t>(batch_size * output_height);
+  const TensorOpCost cost{static_cast<double>(4 * sizeof(T) * output_width * num_channels),
+                          static_cast<double>(sizeof(T) * output_width * num_channels),
+                          static_cast<double>(8 * output_width * num_channels)};
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, output_rows, cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t output_row = first; output_row < last; ++output_row) {
+          const int64_t n = output_row / output_height;
+          const int64_t y = output_row % output_height;
+          const T* Xdata = XdataBase + n * (input_height * input_width * num_channels);
+          T* Ydata = YdataBase + output_row * (output_width * num_channels);
+
+          const bool y_outside = use_extrapolation &&
+                                 (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1));
+
+          for (int64_t x = 0; x < output_width; ++x) {
+            T* Ypixel = Ydata + x * num_channels;
 
-              T X11 = Xdata[p.input_width_mul_y1[y] + p.in_x1[x]];
-              T X21 = Xdata[p.input_width_mul_y1[y] + p.in_x2[x]];
-              T X12 = Xdata[p.input_width_mul_y2[y] + p.in_x1[x]];
-              T X22 = Xdata[p.input_width_mul_y2[y] + p.in_x2[x]];
+            if (y_outside ||
+                (use_extrapolation &&
+                 (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
+              std::fill_n(Ypixel, num_channels, static_cast<T>(extrapolation_value));
+              continue;
+            }
+
+            const T* X11 = Xdata + (p.input_width_mul_y1[y] + p.in_x1[x]) * num_channels;
+            const T* X21 = Xdata + (p.input_width_mul_y1[y] + p.in_x2[x]) * num_channels;
+            const T* X12 = Xdata + (p.input_width_mul_y2[y] + p.in_x1[x]) * num_channels;
+            const T* X22 = Xdata + (p.input_width_mul_y2[y] + p.in_x2[x]) * num_channels;
 
-              Ydata[output_width * y + x] = static_cast<T>(p.dx2[x] * p.dy2[y] * X11 +
-                                                           p.dx1[x] * p.dy2[y] * X21 +
-                                                           p.dx2[x] * p.dy1[y] * X12 +
-                                                           p.dx1[x] * p.dy1[y] * X22);
+            const float w11 = p.dx2[x] * p.dy2[y];
+            const float w21 = p.dx1[x] * p.dy2[y];
+            const float w12 = p.dx2[x] * p.dy1[y];
+            const float w22 = p.dx1[x] * p.dy1[y];
+
+            for (int64_t c = 0; c < num_channels; ++c) {
+              Ypixel[c] = static_cast<T>(w11 * X11[c] + w21 * X21[c] + w12 * X12[c] + w22 * X22[c]);
             }
           }
-        });
-  }
+        }
+      });
 }
 
 struct TrilinearParams {
@@ -886,9 +1036,10 @@ void ResizeBiCubic(int64_t batch_size,
                    float extrapolation_value,
                    bool exclude_outside,
                    const std::vector<float>& roi,
-                   const T* Xdata,
-                   T* Ydata,
-                   const GetOriginalCoordinateFunc& get_original_coordinate) {
+                   const T* XdataBase,
+                   T* YdataBase,
+                   const GetOriginalCoordinateFunc& get_original_coordinate,
+                   concurrency::ThreadPool* tp) {
   std::vector<float> y_original;
   y_original.reserve(output_height);
 
@@ -896,7 +1047,6 @@ void ResizeBiCubic(int64_t batch_size,
   x_original.reserve(output_width);
 
   std::unordered_map<float, std::array<float, CubicModeGridLength>> cubic_coeffs;
-  std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
   auto roi_y_start = roi.size() / 2 - 2;
   auto roi_y_end = roi.size() - 2;
   auto roi_x_start = roi.size() / 2 - 1;
@@ -913,7 +1063,6 @@ void ResizeBiCubic(int64_t batch_size,
     auto s = y_original[y] - std::floor(y_original[y]);
     if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
       cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
     }
   }
 
@@ -929,93 +1078,92 @@ void ResizeBiCubic(int64_t batch_size,
     auto s = x_original[x] - std::floor(x_original[x]);
     if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
       cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
     }
   }
 
-  // setup up temp arrays to hold coefficients when exclude_outside is set to true
-  std::array<float, CubicModeGridLength> y_coeff_holder;
-  std::array<float, CubicModeGridLength> x_coeff_holder;
-  float y_coeff_sum = 1;
-  float x_coeff_sum = 1;
+  // The channels are independent, so they are interpolated in parallel. The coefficient tables are only read
+  // from here on and each channel has its own cache of 1D interpolation results.
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(batch_size * num_channels),
+      [&](std::ptrdiff_t channel) {
+        const T* Xdata = XdataBase + channel * (input_height * input_width);
+        T* Ydata = YdataBase + channel * (output_height * output_width);
 
-  for (int64_t n = 0; n < batch_size; n++) {
-    for (int64_t c = 0; c < num_channels; c++) {
-      for (int64_t y = 0; y < output_height; ++y) {
-        auto in_y = y_original[y];
+        std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
 
-        // when use_extrapolation is set and original index is out of the dim range
-        // then use extrapolation_value as the output value.
-        if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
-          for (int64_t x = 0; x < output_width; ++x) {
-            Ydata[y * output_width + x] = extrapolation_value;
-          }
-          continue;
-        }
+        // setup up temp arrays to hold coefficients when exclude_outside is set to true
+        std::array<float, CubicModeGridLength> y_coeff_holder;
+        float y_coeff_sum = 1;
+        float x_coeff_sum = 1;
 
-        auto y_int = static_cast<int64_t>(std::floor(in_y));
-        auto& coeff_y = exclude_outside ? y_coeff_holder : cubic_coeffs[in_y - y_int];
-        y_coeff_sum = 1;
-
-        if (exclude_outside) {
-          // When true, the weight of sampling locations outside the grid will be set to 0
-          // and the weight will be renormalized so that their sum is 1.0
-          y_coeff_sum = 0;
-          auto& orig_y_coeffs = cubic_coeffs[in_y - y_int];
-          for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
-            y_coeff_holder[i] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[i];
-            y_coeff_sum += y_coeff_holder[i];
-          }
-        }
-
-        for (int64_t x = 0; x < output_width; ++x) {
-          auto in_x = x_original[x];
+        for (int64_t y = 0; y < output_height; ++y) {
+          auto in_y = y_original[y];
 
           // when use_extrapolation is set and original index is out of the dim range
           // then use extrapolation_value as the output value.
-          if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
-            Ydata[y * output_width + x] = extrapolation_value;
+          if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
+            for (int64_t x = 0; x < output_width; ++x) {
+              Ydata[y * output_width + x] = extrapolation_value;
+            }
             continue;
           }
 
-          auto x_int = static_cast<int64_t>(std::floor(in_x));
-          auto s_x = static_cast<float>(in_x - x_int);
-          auto& coeff_x = exclude_outside ? x_coeff_holder : cubic_coeffs[s_x];
-          x_coeff_sum = 1;
+          auto y_int = static_cast<int64_t>(std::floor(in_y));
+          const auto& orig_y_coeffs = cubic_coeffs.at(in_y - y_int);
+          const auto& coeff_y = exclude_outside ? y_coeff_holder : orig_y_coeffs;
+          y_coeff_sum = 1;
 
           if (exclude_outside) {
             // When true, the weight of sampling locations outside the grid will be set to 0
             // and the weight will be renormalized so that their sum is 1.0
-            x_coeff_sum = 0;
-            auto& orig_x_coeff = cubic_coeffs[s_x];
-            for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
-              x_coeff_holder[i] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[i];
-              x_coeff_sum += x_coeff_holder[i];
+            y_coeff_sum = 0;
+            for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
+              y_coeff_holder[i] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[i];
+              y_coeff_sum += y_coeff_holder[i];
             }
           }
 
-          // Compute cubic interpolation in x dimension using the x coefficients.
-          // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
-          auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
-          float result = 0;
-          for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
-            auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
-                                                               input_height, input_width, coeff_x, x_coeff_sum,
-                                                               interpolation_result_cache);
-            result += x_interpolation_result * coeff_y[i] / y_coeff_sum;
-          }
+          for (int64_t x = 0; x < output_width; ++x) {
+            auto in_x = x_original[x];
 
-          Ydata[y * output_width + x] = static_cast<T>(result);
-        }
-      }
+            // when use_extrapolation is set and original index is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
+              Ydata[y * output_width + x] = extrapolation_value;
+              continue;
+            }
 
-      Xdata += input_height * input_width;
-      Ydata += output_height * output_width;
+            auto x_int = static_cast<int64_t>(std::floor(in_x));
+            auto s_x = static_cast<float>(in_x - x_int);
+            const auto& orig_x_coeff = cubic_coeffs.at(s_x);
+            auto coeff_x = orig_x_coeff;
+            x_coeff_sum = 1;
+
+            if (exclude_outside) {
+              // When true, the weight of sampling locations outside the grid will be set to 0
+              // and the weight will be renormalized so that their sum is 1.0
+              x_coeff_sum = 0;
+              for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
+                coeff_x[i] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[i];
+                x_coeff_sum += coeff_x[i];
+              }
+            }
 
-      // clear the cache when moving to the next channel
-      coeff_to_1Dinterpolation_map.clear();
-    }
-  }
+            // Compute cubic interpolation in x dimension using the x coefficients.
+            // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
+            auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
+            float result = 0;
+            for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
+              auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
+                                                                 input_height, input_width, coeff_x, x_coeff_sum,
+                                                                 interpolation_result_cache);
+              result += x_interpolation_result * coeff_y[i] / y_coeff_sum;
+            }
+
+            Ydata[y * output_width + x] = static_cast<T>(result);
+          }
+        }
+      });
 }
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -1066,24 +1214,33 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
       // Supports 'bilinear' and 'trilinear' sampling only
 
       //'bilinear' == 2-D input or 4-D input with outermost 2 scales as 1
+      // or 4-D input with outermost and innermost scales as 1 (NHWC)
       if (dims.size() == 2 || dims.size() == 4) {
         bool is_2D = dims.size() == 2;
+        bool is_nhwc = !is_2D && scales[1] != 1.0f;
 
-        const int64_t batch_size = is_2D ? 1 : dims[0];
-        const int64_t num_channels = is_2D ? 1 : dims[1];
-        const int64_t input_height = is_2D ? dims[0] : dims[2];
-        const int64_t input_width = is_2D ? dims[1] : dims[3];
-
-        const int64_t output_height = is_2D ? output_dims[0] : output_dims[2];
-        const int64_t output_width = is_2D ? output_dims[1] : output_dims[3];
+        const size_t height_axis = is_2D ? 0 : (is_nhwc ? 1 : 2);
+        const size_t width_axis = height_axis + 1;
 
-        AllocatorPtr alloc;
-        ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-        UpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
-                         is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], roi,
-                         use_extrapolation_, extrapolation_value_, X->Data<T>(),
-                         Y->MutableData<T>(), alloc, get_original_coordinate_,
-                         output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
+        const int64_t batch_size = is_2D ? 1 : dims[0];
+        const int64_t num_channels = is_2D ? 1 : (is_nhwc ? dims[3] : dims[1]);
+        const int64_t input_height = dims[height_axis];
+        const int64_t input_width = dims[width_axis];
+
+        const int64_t output_height = output_dims[height_axis];
+        const int64_t output_width = output_dims[width_axis];
+
+        auto p = GetBilinearParams(input_height, input_width, output_height, output_width,
+                                   scales[height_axis], scales[width_axis], roi, height_axis, width_axis);
+        if (is_nhwc) {
+          NhwcUpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
+                               use_extrapolation_, extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
+                               *p, context->GetOperatorThreadPool());
+        } else {
+          UpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
+                           use_extrapolation_, extrapolation_value_, X->Data<T>(), Y->MutableData<T>(),
+                           *p, context->GetOperatorThreadPool());
+        }
         return Status::OK();
       } else if (dims.size() == 3 || dims.size() == 5) {
         //'trilinear' == 3-D input or 5-D input with outermost 2 scales as 1
@@ -1137,7 +1294,8 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
       ResizeBiCubic(batch_size, num_channels, input_height, input_width, output_height, output_width,
                     is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], cubic_coeff_a_, use_extrapolation_,
                     extrapolation_value_, exclude_outside_, roi, X->Data<float>(),
-                    Y->MutableData<float>(), get_original_coordinate_);
+                    Y->MutableData<float>(), get_original_coordinate_,
+                    output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
       return Status::OK();
     }
     default:
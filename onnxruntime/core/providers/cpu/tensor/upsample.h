@@ -6,7 +6,9 @@
 #ifndef SHARED_PROVIDER
 #include "core/framework/op_kernel.h"
 #endif
+#include "core/platform/ort_mutex.h"
 #include <cmath>
+#include <memory>
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(push)
 // Chance of arithmetic overflow could be reduced
@@ -366,6 +368,8 @@ class UpsampleBase {
   }
 };  // UpsampleBase
 
+struct BilinearParams;
+
 template <typename T>
 class Upsample : public UpsampleBase, public OpKernel {
  public:
@@ -376,6 +380,17 @@ class Upsample : public UpsampleBase, public OpKernel {
 
   Status BaseCompute(OpKernelContext* context, const std::vector<float>& roi, const std::vector<float>& scales,
                      const gsl::span<const int64_t>& output_dims) const;
+
+ private:
+  std::shared_ptr<const BilinearParams> GetBilinearParams(int64_t input_height, int64_t input_width,
+                                                          int64_t output_height, int64_t output_width,
+                                                          float height_scale, float width_scale,
+                                                          const std::vector<float>& roi,
+                                                          size_t roi_y_index, size_t roi_x_index) const;
+
+  // The bilinear interpolation tables of the last run, reused while the shapes, scales and roi are unchanged
+  mutable OrtMutex bilinear_params_mutex_;
+  mutable std::shared_ptr<const BilinearParams> bilinear_params_;
 };
 
 }  // namespace onnxruntime
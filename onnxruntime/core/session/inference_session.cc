@@ -264,6 +264,7 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
   }
 
   use_per_session_threads_ = session_options.use_per_session_threads;
+  numa_node_ = std::stoi(session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigNumaNode, "-1"));
 
   if (use_per_session_threads_) {
     LOGS(*session_logger_, INFO) << "Creating and using per session threadpools since use_per_session_threads_ is true";
@@ -285,8 +286,11 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
                              session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL &&
                              to.affinity_vec_len == 0;
       to.allow_spinning = allow_intra_op_spinning;
+      to.adaptive_spinning =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigIntraOpAdaptiveSpinning, "0") == "1";
       to.dynamic_block_base_ = std::stoi(session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDynamicBlockBase, "0"));
       LOGS(*session_logger_, INFO) << "Dynamic block base set to " << to.dynamic_block_base_;
+      to.numa_node = numa_node_;
 
       // Set custom threading functions
       to.custom_create_thread_fn = session_options_.custom_create_thread_fn;
@@ -316,7 +320,10 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
       to.name = inter_thread_pool_name_.c_str();
       to.set_denormal_as_zero = set_denormal_as_zero;
       to.allow_spinning = allow_inter_op_spinning;
+      to.adaptive_spinning =
+          session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigInterOpAdaptiveSpinning, "0") == "1";
       to.dynamic_block_base_ = std::stoi(session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDynamicBlockBase, "0"));
+      to.numa_node = numa_node_;
 
       // Set custom threading functions
       to.custom_create_thread_fn = session_options_.custom_create_thread_fn;
@@ -347,7 +354,6 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     StartProfiling(session_options_.profile_file_prefix);
   }
 
-  telemetry_ = {};
   allocator_manager_ = std::make_shared<onnxruntime::AllocatorManager>();
 }
 
@@ -1230,6 +1236,7 @@ common::Status InferenceSession::Initialize() {
     if (!have_cpu_ep) {
       LOGS(*session_logger_, INFO) << "Adding default CPU execution provider.";
       CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena};
+      epi.numa_node = numa_node_;
       auto p_cpu_exec_provider = std::make_unique<CPUExecutionProvider>(epi);
       ORT_RETURN_IF_ERROR_SESSIONID_(RegisterExecutionProvider(std::move(p_cpu_exec_provider)));
     }
@@ -1431,6 +1438,8 @@ common::Status InferenceSession::Initialize() {
     // Resolve memory pattern flags of the main graph and subgraph session states
     ResolveMemoryPatternFlags(*session_state_);
 
+    ORT_RETURN_IF_ERROR_SESSIONID_(ParseStatefulIOPairs());
+
     is_inited_ = true;
 
     // we don't directly use the ORT format bytes currently, so free those now
@@ -1766,10 +1775,145 @@ Status InferenceSession::PartialRun(onnxruntime::RunOptions& run_options,
 }
 #endif
 
+// Reads the scheduling priority and the deadline of a Run() that started at run_start from its run options.
+static Status ParseRunPriorityAndDeadline(const RunOptions& run_options, const TimePoint& run_start,
+                                          /*out*/ concurrency::WorkPriority& priority, /*out*/ TimePoint& deadline) {
+  const auto& config = run_options.config_options;
+
+  const std::string priority_str = config.GetConfigOrDefault(kOrtRunOptionsConfigPriority, "normal");
+  if (priority_str == "low") {
+    priority = concurrency::WorkPriority::kLow;
+  } else if (priority_str == "normal") {
+    priority = concurrency::WorkPriority::kNormal;
+  } else if (priority_str == "high") {
+    priority = concurrency::WorkPriority::kHigh;
+  } else {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ", kOrtRunOptionsConfigPriority, ": '",
+                           priority_str, "'. Expected 'low', 'normal' or 'high'.");
+  }
+
+  deadline = TimePoint::max();
+  const std::string deadline_str = config.GetConfigOrDefault(kOrtRunOptionsConfigDeadlineMs, "");
+  if (!deadline_str.empty()) {
+    uint32_t deadline_ms = 0;
+    if (!TryParseStringWithClassicLocale(deadline_str, deadline_ms)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid value for ", kOrtRunOptionsConfigDeadlineMs,
+                             ": '", deadline_str, "'. Expected a number of milliseconds.");
+    }
+
+    if (deadline_ms > 0) {
+      deadline = run_start + std::chrono::milliseconds(deadline_ms);
+    }
+  }
+
+  return Status::OK();
+}
+
 Status InferenceSession::Run(const RunOptions& run_options,
                              const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
                              const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
                              const std::vector<OrtDevice>* p_fetches_device_info) {
+  if (!stateful_io_pairs_.empty()) {
+    return RunStateful(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info);
+  }
+
+  return RunImpl(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info);
+}
+
+Status InferenceSession::RunStateful(const RunOptions& run_options,
+                                     const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
+                                     const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
+                                     const std::vector<OrtDevice>* p_fetches_device_info) {
+  if (p_fetches == nullptr) {
+    return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Output vector pointer is NULL");
+  }
+
+  const auto& config = run_options.config_options;
+  const std::string stream_id = config.GetConfigOrDefault(kOrtRunOptionsConfigStatefulStreamId, "");
+  const bool reset = config.GetConfigOrDefault(kOrtRunOptionsConfigStatefulReset, "0") == "1";
+  const bool end_stream = config.GetConfigOrDefault(kOrtRunOptionsConfigStatefulEndStream, "0") == "1";
+
+  const size_t num_pairs = stateful_io_pairs_.size();
+  std::vector<OrtValue> state;
+  {
+    std::lock_guard<OrtMutex> l(stateful_values_mutex_);
+    auto entry = stateful_values_.find(stream_id);
+    if (entry != stateful_values_.end()) {
+      if (reset) {
+        stateful_values_.erase(entry);
+      } else {
+        // take ownership while running. runs for the same stream are not concurrent so nothing else will use it.
+        state = std::move(entry->second);
+      }
+    }
+  }
+
+  state.resize(num_pairs);
+
+  // feed the state for any stateful input that wasn't explicitly provided, and fetch any stateful output that
+  // wasn't requested. the OrtValue instances are shared, so the buffers are handed over without copying.
+  std::vector<std::string> stateful_feed_names(feed_names);
+  std::vector<OrtValue> stateful_feeds(feeds);
+  std::vector<std::string> stateful_output_names(output_names);
+  std::vector<size_t> fetch_idxs(num_pairs);
+
+  for (size_t i = 0; i < num_pairs; ++i) {
+    const auto& pair = stateful_io_pairs_[i];
+    if (state[i].IsAllocated() &&
+        std::find(feed_names.cbegin(), feed_names.cend(), pair.input_name) == feed_names.cend()) {
+      stateful_feed_names.push_back(pair.input_name);
+      stateful_feeds.push_back(state[i]);
+    }
+
+    auto output = std::find(stateful_output_names.cbegin(), stateful_output_names.cend(), pair.output_name);
+    fetch_idxs[i] = static_cast<size_t>(output - stateful_output_names.cbegin());
+    if (output == stateful_output_names.cend()) {
+      stateful_output_names.push_back(pair.output_name);
+    }
+  }
+
+  const size_t num_outputs = output_names.size();
+  const size_t num_extra_outputs = stateful_output_names.size() - num_outputs;
+
+  // pre-allocated fetches and device info must cover the additional outputs
+  if (!p_fetches->empty() && num_extra_outputs > 0) {
+    p_fetches->resize(stateful_output_names.size());
+  }
+
+  std::vector<OrtDevice> stateful_fetches_device_info;
+  if (p_fetches_device_info && num_extra_outputs > 0) {
+    stateful_fetches_device_info = *p_fetches_device_info;
+    stateful_fetches_device_info.resize(stateful_output_names.size());
+    p_fetches_device_info = &stateful_fetches_device_info;
+  }
+
+  Status status = RunImpl(run_options, stateful_feed_names, stateful_feeds, stateful_output_names, p_fetches,
+                          p_fetches_device_info);
+
+  if (status.IsOK()) {
+    for (size_t i = 0; i < num_pairs; ++i) {
+      state[i] = (*p_fetches)[fetch_idxs[i]];
+    }
+  }
+
+  if (p_fetches->size() > num_outputs) {
+    p_fetches->resize(num_outputs);
+  }
+
+  // keep the existing state if the run failed so the stream can be retried
+  if (!end_stream) {
+    std::lock_guard<OrtMutex> l(stateful_values_mutex_);
+    stateful_values_[stream_id] = std::move(state);
+  }
+
+  return status;
+}
+
+Status InferenceSession::RunImpl(const RunOptions& run_options,
+                                 const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
+                                 const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
+                                 const std::vector<OrtDevice>* p_fetches_device_info) {
+  const TimePoint run_start = std::chrono::high_resolution_clock::now();
   TimePoint tp;
   if (session_profiler_.IsEnabled()) {
     tp = session_profiler_.Start();
@@ -1808,6 +1952,13 @@ Status InferenceSession::Run(const RunOptions& run_options,
       ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
       ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
 
+      concurrency::WorkPriority priority;
+      TimePoint deadline;
+      ORT_RETURN_IF_ERROR_SESSIONID_(ParseRunPriorityAndDeadline(run_options, run_start, priority, deadline));
+
+      // the parallel loops of the kernels and the inter-op tasks of the parallel executor inherit the priority
+      concurrency::ThreadPool::PriorityScope priority_scope(priority);
+
       // shrink certain default memory arenas if the user has requested for it
       const std::string& shrink_memory_arenas =
           run_options.config_options.GetConfigOrDefault(kOrtRunOptionsConfigEnableMemoryArenaShrinkage, "");
@@ -1867,7 +2018,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
 #endif
       ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
                                                    session_options_.execution_mode, run_options.terminate, run_logger,
-                                                   run_options.only_execute_path_to_fetches));
+                                                   run_options.only_execute_path_to_fetches, deadline));
     }
     ORT_CATCH(const std::exception& e) {
       ORT_HANDLE_EXCEPTION([&]() {
@@ -1885,24 +2036,28 @@ Status InferenceSession::Run(const RunOptions& run_options,
     }
 
     if (!arenas_to_shrink.empty()) {
+      // the memory pattern buffers kept for the next run would stay allocated from the arenas
+      session_state_->ClearExecutionFrameStates();
       ShrinkMemoryArenas(arenas_to_shrink);
     }
   }
   --current_num_runs_;
 
   // keep track of telemetry
-  ++telemetry_.total_runs_since_last_;
-  telemetry_.total_run_duration_since_last_ += TimeDiffMicroSeconds(tp);
+  telemetry_.total_runs_since_last_.fetch_add(1, std::memory_order_relaxed);
+  telemetry_.total_run_duration_since_last_.fetch_add(TimeDiffMicroSeconds(tp), std::memory_order_relaxed);
 
   // time to send telemetry?
-  if (TimeDiffMicroSeconds(telemetry_.time_sent_last_) > Telemetry::kDurationBetweenSending) {
-    // send the telemetry
-    env.GetTelemetryProvider().LogRuntimePerf(session_id_, telemetry_.total_runs_since_last_,
-                                              telemetry_.total_run_duration_since_last_);
-    // reset counters
-    telemetry_.time_sent_last_ = std::chrono::high_resolution_clock::now();
-    telemetry_.total_runs_since_last_ = 0;
-    telemetry_.total_run_duration_since_last_ = 0;
+  auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::high_resolution_clock::now().time_since_epoch())
+                    .count();
+  long long next_report_us = telemetry_.next_report_us_.load(std::memory_order_relaxed);
+  if (now_us > next_report_us &&
+      telemetry_.next_report_us_.compare_exchange_strong(next_report_us, now_us + Telemetry::kDurationBetweenSending,
+                                                         std::memory_order_relaxed)) {
+    // send the telemetry and reset counters
+    env.GetTelemetryProvider().LogRuntimePerf(session_id_, telemetry_.total_runs_since_last_.exchange(0),
+                                              telemetry_.total_run_duration_since_last_.exchange(0));
   }
 
   // log evaluation stop to trace logging provider
@@ -1925,7 +2080,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
     LOGS(*session_logger_, INFO) << "Start the second Run() to capture the graph. "
                                     "The first one is for necessary memory allocation;"
                                     "The second one is for capturing the graph.";
-    ORT_RETURN_IF_ERROR(Run(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info));
+    ORT_RETURN_IF_ERROR(RunImpl(run_options, feed_names, feeds, output_names, p_fetches, p_fetches_device_info));
   }
   return retval;
 }
@@ -2027,6 +2182,44 @@ common::Status InferenceSession::Run(IOBinding& io_binding) {
   return Run(run_options, io_binding);
 }
 
+void InferenceSession::RunAsync(const RunOptions* run_options, std::vector<std::string> feed_names,
+                                std::vector<OrtValue> feeds, std::vector<std::string> output_names,
+                                std::vector<OrtValue> fetches, RunAsyncCallback callback) {
+  struct AsyncRun {
+    std::vector<std::string> feed_names;
+    std::vector<OrtValue> feeds;
+    std::vector<std::string> output_names;
+    std::vector<OrtValue> fetches;
+    RunAsyncCallback callback;
+  };
+
+  // ThreadPool::Schedule copies the task, so the arguments are shared rather than captured by value
+  auto async_run = std::make_shared<AsyncRun>(AsyncRun{std::move(feed_names), std::move(feeds),
+                                                       std::move(output_names), std::move(fetches),
+                                                       std::move(callback)});
+
+  concurrency::ThreadPool::Schedule(GetIntraOpThreadPoolToUse(), [this, run_options, async_run]() {
+    Status status;
+    ORT_TRY {
+      if (run_options == nullptr) {
+        RunOptions default_run_options;
+        status = Run(default_run_options, async_run->feed_names, async_run->feeds, async_run->output_names,
+                     &async_run->fetches);
+      } else {
+        status = Run(*run_options, async_run->feed_names, async_run->feeds, async_run->output_names,
+                     &async_run->fetches);
+      }
+    }
+    ORT_CATCH(const std::exception& e) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, e.what());
+      });
+    }
+
+    async_run->callback(status, async_run->fetches);
+  });
+}
+
 template <typename T>
 void InferenceSession::StartProfiling(const std::basic_string<T>& file_prefix) {
   std::basic_ostringstream<T> ss;
@@ -2065,10 +2258,50 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+concurrency::ThreadPoolStats InferenceSession::GetThreadPoolStats(bool inter_op) const {
+  return concurrency::ThreadPool::GetStats(inter_op ? GetInterOpThreadPoolToUse() : GetIntraOpThreadPoolToUse());
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
 
+common::Status InferenceSession::ParseStatefulIOPairs() {
+  stateful_io_pairs_.clear();
+
+  const std::string pairs =
+      session_options_.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigStatefulIOPairs, "");
+
+  std::istringstream ss_1(pairs);
+  std::string io_pair;
+
+  while (std::getline(ss_1, io_pair, ';')) {
+    const auto separator = io_pair.find(':');
+    if (separator == std::string::npos || separator == 0 || separator == io_pair.size() - 1) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Invalid entry in the stateful input/output pairs. Expected 'output:input'. Got: ",
+                             io_pair);
+    }
+
+    StatefulIOPair pair{io_pair.substr(0, separator), io_pair.substr(separator + 1)};
+
+    if (input_def_map_.find(pair.input_name) == input_def_map_.cend()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Stateful input/output pair refers to an unknown graph input: ", pair.input_name);
+    }
+
+    if (std::none_of(output_def_list_.cbegin(), output_def_list_.cend(),
+                     [&pair](const NodeArg* output) { return output->Name() == pair.output_name; })) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Stateful input/output pair refers to an unknown graph output: ", pair.output_name);
+    }
+
+    stateful_io_pairs_.push_back(std::move(pair));
+  }
+
+  return Status::OK();
+}
+
 common::Status InferenceSession::ValidateAndParseShrinkArenaString(const std::string& ort_device_list,
                                                                    /*out*/ std::vector<AllocatorPtr>& arenas_to_shrink) const {
   arenas_to_shrink.reserve(5);  // Allocate some memory for the container (we are unlikely to see more than 5 memory arena shrink requests)
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 
@@ -326,6 +327,20 @@ class InferenceSession {
   virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding) ORT_MUST_USE_RESULT;
   common::Status Run(IOBinding& io_binding) ORT_MUST_USE_RESULT;
 
+  using RunAsyncCallback = std::function<void(const common::Status& status, std::vector<OrtValue>& fetches)>;
+
+  /**
+   * Queue a Run on the intra-op thread pool of the session and return without waiting for it.
+   * The callback is invoked on the thread that executed the run, with the status and the fetches of the run.
+   * If the session has no intra-op thread pool, or ThreadPool::Schedule hands the run to a worker whose queue is full
+   * (1024 tasks not yet started), the run and the callback happen on the calling thread before RunAsync returns.
+   * @param run_options optional. If not nullptr it must stay valid until the callback is invoked.
+   * @param fetches pre-allocated outputs, or empty OrtValues for the outputs the session should allocate.
+   * The session must not be destroyed before the callback of every queued run was invoked.
+   */
+  void RunAsync(const RunOptions* run_options, std::vector<std::string> feed_names, std::vector<OrtValue> feeds,
+                std::vector<std::string> output_names, std::vector<OrtValue> fetches, RunAsyncCallback callback);
+
 #ifdef ENABLE_TRAINING
   /**
    * Partially run a pre-loaded and pre-intialized model.
@@ -430,6 +445,13 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+   * Return the spin, steal, park and wake-up counts of the thread pool this session runs on.
+   * @param inter_op selects the inter-op thread pool instead of the intra-op one.
+   * @return zeros if the session has no such thread pool.
+   */
+  concurrency::ThreadPoolStats GetThreadPoolStats(bool inter_op) const;
+
   /**
    * Search registered execution providers for an allocator that has characteristics
    * specified within mem_info
@@ -578,6 +600,25 @@ class InferenceSession {
 
   common::Status WaitForNotification(Notification* p_executor_done, int64_t timeout_in_ms) ORT_MUST_USE_RESULT;
 
+  // Run the model without any handling of stateful input/output pairs.
+  common::Status RunImpl(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                         const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                         std::vector<OrtValue>* p_fetches,
+                         const std::vector<OrtDevice>* p_fetches_device_info) ORT_MUST_USE_RESULT;
+
+  /*
+   * Parse and validate the stateful input/output pairs from the session options.
+   * List format: "output_0:input_0;output_1:input_1"
+   */
+  common::Status ParseStatefulIOPairs() ORT_MUST_USE_RESULT;
+
+  // Run the model, feeding the state kept for the stream as the stateful inputs and keeping the stateful outputs
+  // as the state for the next Run() of the stream.
+  common::Status RunStateful(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                             const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                             std::vector<OrtValue>* p_fetches,
+                             const std::vector<OrtDevice>* p_fetches_device_info) ORT_MUST_USE_RESULT;
+
   template <typename T>
   void StartProfiling(const std::basic_string<T>& file_prefix);
 
@@ -699,13 +740,16 @@ class InferenceSession {
   static std::atomic<uint32_t> global_session_id_;  // a monotonically increasing session id
   uint32_t session_id_;                             // the current session's id
 
+  // NUMA node the session is pinned to, -1 if it is not pinned
+  int numa_node_ = -1;
+
+  // Updated by concurrent Run() calls without a lock. The run that moves next_report_us_ forward sends the report.
   struct Telemetry {
-    Telemetry() : time_sent_last_() {}
-    uint32_t total_runs_since_last_ = 0;           // the total number of Run() calls since the last report
-    long long total_run_duration_since_last_ = 0;  // the total duration (us) of Run() calls since the last report
-    std::string event_name_;                       // where the model is loaded from: ["model_loading_uri", "model_loading_proto", "model_loading_istream"]
+    std::atomic<uint32_t> total_runs_since_last_{0};           // the total number of Run() calls since the last report
+    std::atomic<long long> total_run_duration_since_last_{0};  // the total duration (us) of Run() calls since the last report
+    std::string event_name_;                                   // where the model is loaded from: ["model_loading_uri", "model_loading_proto", "model_loading_istream"]
 
-    TimePoint time_sent_last_;  // the TimePoint of the last report
+    std::atomic<long long> next_report_us_{0};  // when to send the next report, in us since the clock's epoch
     // Event Rate per provider < 20 peak events per second
     constexpr static long long kDurationBetweenSending = 1000 * 1000 * 60 * 10;  // duration in (us).  send a report every 10 mins
   } telemetry_;
@@ -792,6 +836,19 @@ class InferenceSession {
   };
 
   CachedExecutionProviderForGraphReplay cached_execution_provider_for_graph_replay_;
+
+  // Output/input pairs from kOrtSessionOptionsConfigStatefulIOPairs. Set during Initialize.
+  struct StatefulIOPair {
+    std::string output_name;
+    std::string input_name;
+  };
+
+  std::vector<StatefulIOPair> stateful_io_pairs_;
+
+  // State for each stream id. Each entry holds the OrtValue for each of stateful_io_pairs_, which is empty if no
+  // value has been produced for the stream yet.
+  std::unordered_map<std::string, std::vector<OrtValue>> stateful_values_;  // GUARDED_BY(stateful_values_mutex_)
+  OrtMutex stateful_values_mutex_;
 };
 
 struct SessionIOBinding {
@@ -742,17 +742,18 @@ ORT_API_STATUS_IMPL(OrtApis::CreateSessionFromArray, _In_ const OrtEnv* env, _In
   API_IMPL_END
 }
 
-ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
-                    _In_reads_(input_len) const char* const* input_names,
-                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
-                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
-                    _Inout_updates_all_(output_names_len) OrtValue** output) {
-  API_IMPL_BEGIN
-  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+namespace {
+// Converts the arguments of Run and RunAsync. Pre-allocated outputs become the fetches to write into.
+OrtStatus* ToRunArguments(_In_reads_(input_len) const char* const* input_names,
+                          _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                          _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                          _In_reads_(output_names_len) OrtValue* const* output,
+                          std::vector<std::string>& feed_names, std::vector<OrtValue>& feeds,
+                          std::vector<std::string>& output_names, std::vector<OrtValue>& fetches) {
   constexpr int queue_id = 0;
 
-  std::vector<std::string> feed_names(input_len);
-  std::vector<OrtValue> feeds(input_len);
+  feed_names.resize(input_len);
+  feeds.resize(input_len);
 
   for (size_t i = 0; i != input_len; ++i) {
     if (input_names[i] == nullptr || input_names[i][0] == '\0') {
@@ -766,7 +767,7 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
   }
 
   // Create output feed
-  std::vector<std::string> output_names(output_names_len);
+  output_names.resize(output_names_len);
   for (size_t i = 0; i != output_names_len; ++i) {
     if (output_names1[i] == nullptr || output_names1[i][0] == '\0') {
       return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "output name cannot be empty");
@@ -774,7 +775,7 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
     output_names[i] = output_names1[i];
   }
 
-  std::vector<OrtValue> fetches(output_names_len);
+  fetches.resize(output_names_len);
   for (size_t i = 0; i != output_names_len; ++i) {
     if (output[i] != nullptr) {
       ::OrtValue& value = *(output[i]);
@@ -783,6 +784,41 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
       fetches[i] = value;
     }
   }
+  return nullptr;
+}
+
+// Hands the fetches of a successful Run or RunAsync to the caller. Outputs the caller did not pre-allocate are
+// returned as new OrtValues.
+void FromRunFetches(std::vector<OrtValue>& fetches, _Inout_updates_all_(output_names_len) OrtValue** output,
+                    size_t output_names_len) {
+  constexpr int queue_id = 0;
+
+  for (size_t i = 0; i != output_names_len; ++i) {
+    ::OrtValue& value = fetches[i];
+    if (value.Fence())
+      value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
+    if (output[i] == nullptr) {
+      output[i] = new OrtValue(value);
+    }
+  }
+}
+}  // namespace
+
+ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+
+  std::vector<std::string> feed_names;
+  std::vector<OrtValue> feeds;
+  std::vector<std::string> output_names;
+  std::vector<OrtValue> fetches;
+  ORT_API_RETURN_IF_ERROR(ToRunArguments(input_names, input, input_len, output_names1, output_names_len, output,
+                                         feed_names, feeds, output_names, fetches));
+
   Status status;
   if (run_options == nullptr) {
     OrtRunOptions op;
@@ -793,14 +829,42 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
 
   if (!status.IsOK())
     return ToOrtStatus(status);
-  for (size_t i = 0; i != output_names_len; ++i) {
-    ::OrtValue& value = fetches[i];
-    if (value.Fence())
-      value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
-    if (output[i] == nullptr) {
-      output[i] = new OrtValue(value);
-    }
+  FromRunFetches(fetches, output, output_names_len);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data) {
+  API_IMPL_BEGIN
+  if (run_async_callback == nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "run_async_callback cannot be null");
   }
+
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+
+  std::vector<std::string> feed_names;
+  std::vector<OrtValue> feeds;
+  std::vector<std::string> output_names;
+  std::vector<OrtValue> fetches;
+  ORT_API_RETURN_IF_ERROR(ToRunArguments(input_names, input, input_len, output_names1, output_names_len, output,
+                                         feed_names, feeds, output_names, fetches));
+
+  session->RunAsync(run_options, std::move(feed_names), std::move(feeds), std::move(output_names),
+                    std::move(fetches),
+                    [output, output_names_len, run_async_callback, user_data](const Status& status,
+                                                                              std::vector<OrtValue>& fetches) {
+                      if (!status.IsOK()) {
+                        run_async_callback(user_data, output, output_names_len, ToOrtStatus(status));
+                        return;
+                      }
+                      FromRunFetches(fetches, output, output_names_len);
+                      run_async_callback(user_data, output, output_names_len, nullptr);
+                    });
   return nullptr;
   API_IMPL_END
 }
@@ -2088,6 +2152,19 @@ ORT_API_STATUS_IMPL(OrtApis::SessionGetProfilingStartTimeNs, _In_ const OrtSessi
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetThreadPoolStats, _In_ const OrtSession* sess, int inter_op,
+                    _Out_ OrtThreadPoolStats* out) {
+  API_IMPL_BEGIN
+  const auto* session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  auto stats = session->GetThreadPoolStats(inter_op != 0);
+  out->spins = stats.spins;
+  out->steals = stats.steals;
+  out->parks = stats.parks;
+  out->wakeups = stats.wakeups;
+  return nullptr;
+  API_IMPL_END
+}
+
 // End support for non-tensor types
 
 ORT_API_STATUS_IMPL(OrtApis::CreateArenaCfg, _In_ size_t max_mem, int arena_extend_strategy, int initial_chunk_size_bytes,
@@ -2522,6 +2599,8 @@ static constexpr OrtApi ort_api_1_to_12 = {
     &OrtApis::SessionOptionsAppendExecutionProvider_MIGraphX,
     // End of Version 11 - DO NOT MODIFY ABOVE (see above text for more information)
     &OrtApis::AddExternalInitializers,
+    &OrtApis::SessionGetThreadPoolStats,
+    &OrtApis::RunAsync,
 };
 
 // Asserts to do a some checks to ensure older Versions of the OrtApi never change (will detect an addition or deletion but not if they cancel out each other)
@@ -22,6 +22,24 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   if (options.affinity_vec_len != 0) {
     to.affinity.assign(options.affinity_vec, options.affinity_vec + options.affinity_vec_len);
   }
+  if (options.numa_node >= 0) {
+    // Without processors of the node that the process may run on, the threads are not pinned
+    const auto numa_nodes = Env::Default().GetNumaNodeProcessors();
+    if (static_cast<size_t>(options.numa_node) < numa_nodes.size() && !numa_nodes[options.numa_node].empty()) {
+      const auto& node_processors = numa_nodes[options.numa_node];
+      if (options.thread_pool_size <= 0) {
+        if (node_processors.size() == 1)
+          return nullptr;
+        options.thread_pool_size = static_cast<int>(node_processors.size());
+      }
+      if (to.affinity.empty()) {
+        // Threads beyond the processors of the node share them
+        for (int i = 0; i < options.thread_pool_size; ++i) {
+          to.affinity.push_back(node_processors[i % node_processors.size()]);
+        }
+      }
+    }
+  }
   if (options.thread_pool_size <= 0) {  // default
     cpu_list = Env::Default().GetThreadAffinityMasks();
     if (cpu_list.empty() || cpu_list.size() == 1)
@@ -37,6 +55,7 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   to.custom_thread_creation_options = options.custom_thread_creation_options;
   to.custom_join_thread_fn = options.custom_join_thread_fn;
   to.dynamic_block_base_ = options.dynamic_block_base_;
+  to.adaptive_spinning = options.adaptive_spinning;
   if (to.custom_create_thread_fn) {
     ORT_ENFORCE(to.custom_join_thread_fn, "custom join thread function not set");
   }
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/common/tensor_op_test_utils.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// 4 x 3 table
+static const std::vector<float> kWeight = {0.0f, 1.0f, 2.0f,
+                                           10.0f, 11.0f, 12.0f,
+                                           20.0f, 21.0f, 22.0f,
+                                           30.0f, 31.0f, 32.0f};
+
+TEST(EmbeddingBagTest, Sum2DIndices) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kWeight);
+  test.AddInput<int64_t>("indices", {2, 2}, {0, 2, 3, -1});
+  test.AddOutput<float>("output", {2, 3}, {20.0f, 22.0f, 24.0f,
+                                           60.0f, 62.0f, 64.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, MeanOffsetsWithEmptyBag) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<float>("weight", {4, 3}, kWeight);
+  test.AddInput<int32_t>("indices", {5}, {1, 3, 0, 1, 2});
+  test.AddInput<int32_t>("offsets", {3}, {0, 2, 2});
+  test.AddOutput<float>("output", {3, 3}, {20.0f, 21.0f, 22.0f,
+                                           0.0f, 0.0f, 0.0f,
+                                           10.0f, 11.0f, 12.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, PerSampleWeights) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kWeight);
+  test.AddInput<int64_t>("indices", {4}, {1, 2, 3, 0});
+  test.AddInput<int64_t>("offsets", {2}, {0, 3});
+  test.AddInput<float>("per_sample_weights", {4}, {1.0f, 0.5f, -1.0f, 2.0f});
+  test.AddOutput<float>("output", {2, 3}, {-10.0f, -9.5f, -9.0f,
+                                           0.0f, 2.0f, 4.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, Uint8RowsWithZeroPoint) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<uint8_t>("weight", {3, 2}, {128, 130,
+                                            0, 255,
+                                            10, 20});
+  test.AddInput<int64_t>("indices", {1, 3}, {0, 1, 2});
+  test.AddOptionalInputEdge<int64_t>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<float>("scale", {3}, {0.5f, 1.0f, 0.25f});
+  test.AddInput<uint8_t>("zero_point", {3}, {128, 100, 0});
+  // 0.5 * (128 - 128) + 1 * (0 - 100) + 0.25 * 10, 0.5 * (130 - 128) + 1 * (255 - 100) + 0.25 * 20
+  test.AddOutput<float>("output", {1, 2}, {-97.5f, 161.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, Int8Rows) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<int8_t>("weight", {2, 2}, {-128, 4,
+                                           127, -6});
+  test.AddInput<int32_t>("indices", {1, 2}, {0, 1});
+  test.AddOptionalInputEdge<int32_t>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<float>("scale", {2}, {0.5f, 2.0f});
+  test.AddOutput<float>("output", {1, 2}, {95.0f, -5.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, Float16Rows) {
+  // Rows longer than the float16 conversion chunk
+  constexpr int64_t embedding_size = 300;
+  std::vector<float> weight(3 * embedding_size);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = static_cast<float>(i % 17) * 0.25f;
+  }
+  std::vector<float> expected(embedding_size);
+  for (int64_t i = 0; i < embedding_size; ++i) {
+    expected[i] = weight[2 * embedding_size + i] + weight[i];
+  }
+
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<MLFloat16>("weight", {3, embedding_size}, ToFloat16(weight));
+  test.AddInput<int64_t>("indices", {1, 2}, {2, 0});
+  test.AddOutput<float>("output", {1, embedding_size}, expected);
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, IndexOutOfRange) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kWeight);
+  test.AddInput<int64_t>("indices", {1, 2}, {0, 4});
+  test.AddOutput<float>("output", {1, 3}, {0.0f, 0.0f, 0.0f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "indices element out of data bounds");
+}
+
+TEST(EmbeddingBagTest, MissingScaleForQuantizedTable) {
+  OpTester test("EmbeddingBag", 1, kMSDomain);
+  test.AddInput<uint8_t>("weight", {1, 2}, {1, 2});
+  test.AddInput<int64_t>("indices", {1, 1}, {0});
+  test.AddOutput<float>("output", {1, 2}, {1.0f, 2.0f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "scale is required for an 8-bit embedding table");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(ImagePreprocessTest, Uint8PerChannelScaleAndBias) {
+  OpTester test("ImagePreprocess", 1, kMSDomain);
+  test.AddAttribute<std::vector<float>>("scale", {2.0f, 1.0f, 0.5f});
+  test.AddAttribute<std::vector<float>>("bias", {-1.0f, 0.0f, 1.0f});
+  test.AddInput<uint8_t>("X", {1, 2, 2, 3}, {1, 2, 3, 4, 5, 6,
+                                             7, 8, 9, 10, 11, 12});
+  test.AddOutput<float>("Y", {1, 3, 2, 2}, {1.0f, 7.0f, 13.0f, 19.0f,
+                                            2.0f, 5.0f, 8.0f, 11.0f,
+                                            2.5f, 4.0f, 5.5f, 7.0f});
+  test.Run();
+}
+
+TEST(ImagePreprocessTest, FloatResize) {
+  OpTester test("ImagePreprocess", 1, kMSDomain);
+  test.AddAttribute<std::vector<float>>("bias", {1.0f});
+  test.AddAttribute<int64_t>("output_height", 1);
+  test.AddAttribute<int64_t>("output_width", 4);
+  test.AddInput<float>("X", {1, 1, 2, 1}, {0.0f, 4.0f});
+  test.AddOutput<float>("Y", {1, 1, 1, 4}, {1.0f, 2.0f, 4.0f, 5.0f});
+  test.Run();
+}
+
+TEST(ImagePreprocessTest, InvalidScaleSize) {
+  OpTester test("ImagePreprocess", 1, kMSDomain);
+  test.AddAttribute<std::vector<float>>("scale", {1.0f, 2.0f});
+  test.AddInput<uint8_t>("X", {1, 1, 1, 3}, {1, 2, 3});
+  test.AddOutput<float>("Y", {1, 3, 1, 1}, {1.0f, 2.0f, 3.0f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "The scale attribute must have 1 or 3 values");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+static void RunReduceMeanSubPowTest(const std::vector<int64_t>& dims, int64_t axis, const std::vector<float>& X) {
+  int64_t rank = static_cast<int64_t>(dims.size());
+  int64_t first = axis < 0 ? axis + rank : axis;
+  int64_t D = 1;
+  for (int64_t i = first; i < rank; ++i) {
+    D *= dims[i];
+  }
+
+  std::vector<float> centered(X.size());
+  std::vector<float> squared(X.size());
+  for (size_t row = 0; row < X.size() / D; ++row) {
+    double sum = 0.0;
+    for (int64_t i = 0; i < D; ++i) {
+      sum += X[row * D + i];
+    }
+    const float mean = static_cast<float>(sum / D);
+    for (int64_t i = 0; i < D; ++i) {
+      centered[row * D + i] = X[row * D + i] - mean;
+      squared[row * D + i] = centered[row * D + i] * centered[row * D + i];
+    }
+  }
+
+  OpTester test("ReduceMeanSubPow", 1, kMSDomain);
+  test.AddAttribute<int64_t>("axis", axis);
+  test.AddInput<float>("X", dims, X);
+  test.AddOutput<float>("centered", dims, centered);
+  test.AddOutput<float>("squared", dims, squared);
+  test.Run();
+}
+
+TEST(ReduceMeanSubPowTest, LastAxis) {
+  RunReduceMeanSubPowTest({2, 4}, -1,
+                          {1.0f, 2.0f, 3.0f, 4.0f,
+                           -1.5f, 0.5f, 8.0f, -3.0f});
+}
+
+TEST(ReduceMeanSubPowTest, TrailingAxes) {
+  std::vector<float> X(3 * 5 * 7);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>((i * 37) % 23) * 0.25f - 2.0f;
+  }
+  RunReduceMeanSubPowTest({3, 5, 7}, 1, X);
+  RunReduceMeanSubPowTest({3, 5, 7}, -1, X);
+  RunReduceMeanSubPowTest({3, 5, 7}, 0, X);
+}
+
+TEST(ReduceMeanSubPowTest, LongRows) {
+  std::vector<float> X(4 * 1031);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>((i * 13) % 101) * 0.01f;
+  }
+  RunReduceMeanSubPowTest({4, 1031}, -1, X);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
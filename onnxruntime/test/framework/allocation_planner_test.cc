@@ -166,6 +166,7 @@ class PlannerTest : public ::testing::Test {
   std::unique_ptr<::onnxruntime::KernelDef> std_kernel_;               // a unary kernel with no-aliasing and no-in-place
   std::unique_ptr<::onnxruntime::KernelDef> in_place_kernel_;          // a unary kernel with in-place
   std::unique_ptr<::onnxruntime::KernelDef> external_outputs_kernel_;  // an unary kernel with external outputs
+  std::unique_ptr<::onnxruntime::KernelDef> may_view_kernel_;          // an unary kernel whose output may be a view
 #ifdef ENABLE_TRAINING
   std::unique_ptr<::onnxruntime::KernelDef> may_strided_input_kernel_;  // an uinary kernel with may_strided_input
   std::unique_ptr<::onnxruntime::KernelDef> may_strided_output_kernel_; // an unary kernel with may_strided_output
@@ -194,6 +195,8 @@ class PlannerTest : public ::testing::Test {
         KernelDefBuilder().SetName("Relu").Provider(kCpuExecutionProvider).SinceVersion(1, 10).MayInplace(0, 0).Build();
     external_outputs_kernel_ =
         KernelDefBuilder().SetName("Tanh").Provider(kCpuExecutionProvider).SinceVersion(1, 10).ExternalOutputs().Build();
+    may_view_kernel_ =
+        KernelDefBuilder().SetName("Sigmoid").Provider(kCpuExecutionProvider).SinceVersion(1, 10).MayView(0, 0).Build();
 #ifdef ENABLE_TRAINING
     may_strided_input_kernel_ = KernelDefBuilder()
                                     .SetName("Abs")
@@ -243,6 +246,10 @@ class PlannerTest : public ::testing::Test {
     return AddNode(*external_outputs_kernel_, input, output);
   }
 
+  onnxruntime::Node* AddMayViewNode(std::string& input, std::string& output) {
+    return AddNode(*may_view_kernel_, input, output);
+  }
+
 #ifdef ENABLE_TRAINING
   onnxruntime::Node* AddMayStridedInputNode(std::string& input, std::string& output) {
     return AddNode(*may_strided_input_kernel_, input, output);
@@ -320,6 +327,14 @@ class PlannerTest : public ::testing::Test {
     EXPECT_EQ(plan_->allocation_plan[id].alloc_kind, kind) << "Error in allocation kind for " << name;
   }
 
+  void CheckReusedInput(const std::string& name, const std::string& input, bool is_view) {
+    int id, input_id;
+    index(name, id);
+    index(input, input_id);
+    EXPECT_EQ(plan_->allocation_plan[id].reused_input, input_id) << "Error in reused input for " << name;
+    EXPECT_EQ(plan_->allocation_plan[id].is_view, is_view) << "Error in view flag for " << name;
+  }
+
   void CheckFreed(int step_number, std::initializer_list<std::string> freed_items) {
     // create set and check equality
     std::unordered_set<int> expected;
@@ -440,6 +455,7 @@ TEST_F(PlannerTest, InPlaceTest) {
   CheckAllocKind(X2, AllocKind::kAllocate);
   CheckAllocKind(X3, AllocKind::kReuse);
   CheckAllocKind(X4, AllocKind::kAllocateOutput);
+  CheckReusedInput(X3, X2, false);
 
   // check each ml-value is freed at appropriate step
   CheckFreed(0, {});
@@ -476,6 +492,47 @@ TEST_F(PlannerTest, ExternalOutputsTest) {
   CheckFreed(2, {X3});
 }
 
+// MayViewTest: Check that a view shares the buffer of its input even if the input is used again later,
+// that a view of a view addresses its direct input, and that views are freed after their own last use.
+TEST_F(PlannerTest, MayViewTest) {
+  // tensor variables:
+  std::string X1("X1"), X2("X2"), X3("X3"), X4("X4"), X5("X5"), X6("X6");
+
+  // graph structure:
+  AddNormalNode(X1, X2);   // X2: temporary
+  AddMayViewNode(X2, X3);  // X3: view of X2
+  AddMayViewNode(X3, X4);  // X4: view of X3
+  AddNormalNode(X4, X5);   // X5: output
+  AddNormalNode(X2, X6);   // X6: output, X2 is still used after the views are consumed
+
+  // simulate shape-inference results:
+  Shape shape1w{"M", "N"};
+  auto shape1 = &shape1w.value;
+  Shape shape2w{"K", "N"};
+  auto shape2 = &shape2w.value;
+  SetShape({{X1, shape1}, {X2, shape1}, {X3, shape2}, {X4, shape2}, {X5, shape2}, {X6, shape1}});
+
+  CreatePlan();
+
+  // check allocation kind:
+  CheckAllocKind(X1, AllocKind::kPreExisting);
+  CheckAllocKind(X2, AllocKind::kAllocate);
+  CheckAllocKind(X3, AllocKind::kReuse);
+  CheckAllocKind(X4, AllocKind::kReuse);
+  CheckAllocKind(X5, AllocKind::kAllocateOutput);
+  CheckAllocKind(X6, AllocKind::kAllocateOutput);
+
+  CheckReusedInput(X3, X2, true);
+  CheckReusedInput(X4, X3, true);
+
+  // check each ml-value is freed at appropriate step
+  CheckFreed(0, {});
+  CheckFreed(1, {});
+  CheckFreed(2, {});
+  CheckFreed(3, {X3, X4});
+  CheckFreed(4, {X2});
+}
+
 #ifdef ENABLE_TRAINING
 TEST_F(PlannerTest, MayStridedTest1) {
   // tensor variables:
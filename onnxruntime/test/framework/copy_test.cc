@@ -3,6 +3,10 @@
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
+
+#include <algorithm>
+#include <vector>
+
 #include "core/framework/copy.h"
 #include "core/platform/threadpool.h"
 #include "core/util/thread_utils.h"
@@ -109,6 +113,65 @@ TEST_F(CopyTest, Concat2D) {
   }
 }
 
+TEST_F(CopyTest, NegativeSourceStride) {
+  // test performing a reversing slice using a strided copy
+  constexpr int64_t rows = 7;
+  constexpr int64_t cols = 9;
+  std::vector<float> src(rows * cols);
+  for (size_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<float>(i);
+  }
+  std::vector<float> dst(rows * ((cols + 1) / 2));
+
+  // rows reversed, every second column
+  TensorShapeVector src_strides = {-cols, 2};
+  const float* src_start = src.data() + (rows - 1) * cols;
+  StridedCopy<float>(tp.get(), dst.data(), {(cols + 1) / 2, 1}, {rows, (cols + 1) / 2}, src_start, src_strides);
+
+  size_t dst_access = 0;
+  for (int64_t i0 = rows - 1; i0 >= 0; i0--) {
+    for (int64_t i1 = 0; i1 < cols; i1 += 2) {
+      EXPECT_EQ(src[i0 * cols + i1], dst[dst_access++]);
+    }
+  }
+}
+
+TEST_F(CopyTest, LargeNonTemporal) {
+  // outputs at or above the threshold are written with streaming stores; make sure the
+  // unaligned head, the streamed body and the tail all land in the right place.
+  constexpr size_t rows = 4;
+  constexpr size_t cols = kStridedCopyNonTemporalThreshold / rows + 37;
+  std::vector<uint8_t> src(rows * cols);
+  for (size_t i = 0; i < src.size(); i++) {
+    src[i] = static_cast<uint8_t>(i % 251);
+  }
+
+  // copy into an odd offset of a wider destination, as concat would
+  constexpr size_t dst_cols = cols + 11;
+  constexpr std::ptrdiff_t offset = 3;
+  std::vector<uint8_t> dst(rows * dst_cols, 0);
+  StridedCopy<uint8_t>(tp.get(), dst.data() + offset, {static_cast<int64_t>(dst_cols), 1},
+                       {static_cast<int64_t>(rows), static_cast<int64_t>(cols)},
+                       src.data(), {static_cast<int64_t>(cols), 1});
+
+  for (size_t r = 0; r < rows; r++) {
+    const uint8_t* dst_row = dst.data() + r * dst_cols;
+    ASSERT_TRUE(std::equal(src.begin() + r * cols, src.begin() + (r + 1) * cols, dst_row + offset)) << "row " << r;
+    for (size_t c = 0; c < static_cast<size_t>(offset); c++) {
+      ASSERT_EQ(0, dst_row[c]) << "row " << r;
+    }
+    for (size_t c = offset + cols; c < dst_cols; c++) {
+      ASSERT_EQ(0, dst_row[c]) << "row " << r;
+    }
+  }
+
+  // and a single contiguous run
+  std::vector<uint8_t> dst_1d(src.size() + 1, 0);
+  StridedCopy<uint8_t>(tp.get(), dst_1d.data() + 1, {1}, {static_cast<int64_t>(src.size())}, src.data(), {1});
+  ASSERT_EQ(0, dst_1d[0]);
+  ASSERT_TRUE(std::equal(src.begin(), src.end(), dst_1d.begin() + 1));
+}
+
 TEST_F(CopyTest, CoalesceTensorsTest) {
   {
     TensorShapeVector strides_a{3, 1};
@@ -7,6 +7,7 @@
 #include "core/graph/model.h"
 #include "core/providers/cpu/cpu_execution_provider.h"
 #include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #include "test_utils.h"
 #include "test/test_environment.h"
 #include "test/framework/TestAllocatorManager.h"
@@ -301,6 +302,163 @@ TEST_F(ExecutionFrameTest, MemPatternTest) {
   ASSERT_EQ(p->GetBlock(4)->offset_, kAllocAlignment);
 }
 
+// Builds a MatMul followed by a Clip on the CPU provider for the tests of the state kept between frames.
+class ExecutionFrameStateTest : public ExecutionFrameTest {
+ protected:
+  void SetUp() override {
+    auto cpu_xp = CreateCPUExecutionProvider();
+    xp_type_ = cpu_xp->Type();
+    std::unordered_map<std::string, int> domain_to_version;
+    domain_to_version[onnxruntime::kOnnxDomain] = 7;
+    model_ = std::make_unique<onnxruntime::Model>("test", true, ModelMetaData(), PathString(),
+                                                  IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                                  std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                                  DefaultLoggingManager().DefaultLogger());
+    onnxruntime::Graph& graph = model_->MainGraph();
+    TypeProto tensor_float;
+    tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    onnxruntime::NodeArg input_def1("X1", &tensor_float),
+        input_def2("X2", &tensor_float),
+        gemm_out_def("T1", &tensor_float),
+        clip_out_def("T2", &tensor_float);
+
+    graph.AddNode("node1", "MatMul", "gemm1", ArgMap{&input_def1, &input_def2}, ArgMap{&gemm_out_def})
+        .SetExecutionProviderType(xp_type_);
+    graph.AddNode("node2", "Clip", "clip1", ArgMap{&gemm_out_def}, ArgMap{&clip_out_def})
+        .SetExecutionProviderType(xp_type_);
+
+    ASSERT_STATUS_OK(graph.Resolve());
+
+    ASSERT_STATUS_OK(execution_providers_.Add(xp_type_, std::move(cpu_xp)));
+    ASSERT_STATUS_OK(kernel_registry_manager_.RegisterKernels(execution_providers_));
+  }
+
+  std::unique_ptr<SessionState> CreateSessionState() {
+    return std::make_unique<SessionState>(model_->MainGraph(), execution_providers_, true, &tp_, nullptr, dtm_,
+                                          DefaultLoggingManager().DefaultLogger(), profiler_);
+  }
+
+  // creates a session state finalized with kOrtSessionOptionsConfigMaxKeptExecutionFrameStates set to max_kept
+  Status CreateSessionState(const char* max_kept, std::unique_ptr<SessionState>& state) {
+    SessionOptions so;
+    ORT_RETURN_IF_ERROR(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigMaxKeptExecutionFrameStates,
+                                                         max_kept));
+    state = CreateSessionState();
+    return state->FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager_, so);
+  }
+
+  std::string xp_type_;
+  std::unique_ptr<onnxruntime::Model> model_;
+  ExecutionProviders execution_providers_;
+  KernelRegistryManager kernel_registry_manager_;
+  DataTransferManager dtm_;
+  profiling::Profiler profiler_;
+};
+
+TEST_F(ExecutionFrameStateTest, ReuseFrameStateTest) {
+  auto session_state = CreateSessionState();
+  SessionState& state = *session_state;
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager_));
+
+  const OrtValueNameIdxMap& mlvalue_name_idx_map(state.GetOrtValueNameIdxMap());
+
+  int x1_idx = -1, x2_idx = -1, t1_idx = -1, t2_idx = -1;
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X1", x1_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X2", x2_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("T1", t1_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("T2", t2_idx).IsOK());
+
+  auto cpu_allocator = execution_providers_.Get(xp_type_)->GetAllocator(0, OrtMemTypeDefault);
+
+  OrtValue v1, v2;
+  CreateMLValue<float>(cpu_allocator, std::vector<int64_t>{1, 2}, std::vector<float>{1.0f, 1.0f}, &v1);
+  CreateMLValue<float>(cpu_allocator, std::vector<int64_t>{2, 2}, std::vector<float>(4, 1.0f), &v2);
+  const std::vector<OrtValue> feeds{v1, v2};
+
+  // the first frame traces the allocations and caches the memory patterns
+  {
+    vector<OrtValue> outputs;
+    ExecutionFrame frame({x1_idx, x2_idx}, feeds, {t2_idx}, outputs, {}, state);
+    ASSERT_TRUE(frame.HasMemoryPatternPlanner());
+
+    OrtValue& t1_value = *frame.GetMutableNodeInputOrOutputMLValue(t1_idx);
+    ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(t1_value, t1_idx, DataTypeImpl::GetType<float>(),
+                                                              cpu_allocator->Info(),
+                                                              TensorShape(std::vector<int64_t>{1, 2})));
+    ASSERT_STATUS_OK(frame.ReleaseMLValue(t1_idx));
+
+    auto pattern = std::make_unique<MemoryPatternGroup>();
+    ASSERT_STATUS_OK(frame.GeneratePatterns(pattern.get()));
+    ASSERT_STATUS_OK(state.UpdateMemoryPatternGroupCache(feeds, std::move(pattern)));
+  }
+
+  // later frames with the same input shapes allocate T1 in the memory pattern buffer,
+  // which is kept with the rest of the frame state between them
+  const void* t1_data = nullptr;
+  for (int i = 0; i < 2; ++i) {
+    vector<OrtValue> outputs;
+    ExecutionFrame frame({x1_idx, x2_idx}, feeds, {t2_idx}, outputs, {}, state);
+    ASSERT_FALSE(frame.HasMemoryPatternPlanner());
+
+    OrtValue& t1_value = *frame.GetMutableNodeInputOrOutputMLValue(t1_idx);
+    ASSERT_FALSE(t1_value.IsAllocated());
+    ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(t1_value, t1_idx, DataTypeImpl::GetType<float>(),
+                                                              cpu_allocator->Info(),
+                                                              TensorShape(std::vector<int64_t>{1, 2})));
+    if (i == 0) {
+      t1_data = t1_value.Get<Tensor>().DataRaw();
+    } else {
+      EXPECT_EQ(t1_value.Get<Tensor>().DataRaw(), t1_data);
+    }
+  }
+
+  auto frame_state = state.AcquireExecutionFrameState();
+  ASSERT_NE(frame_state.get(), nullptr);
+  EXPECT_EQ(frame_state->buffers.size(), 1u);
+  for (const auto& value : frame_state->all_values) {
+    EXPECT_FALSE(value.IsAllocated());
+  }
+  EXPECT_EQ(state.AcquireExecutionFrameState().get(), nullptr);
+
+  state.ReleaseExecutionFrameState(std::move(frame_state));
+  state.ClearExecutionFrameStates();
+  EXPECT_EQ(state.AcquireExecutionFrameState().get(), nullptr);
+}
+
+TEST_F(ExecutionFrameStateTest, MaxKeptFrameStatesTest) {
+  // "0" keeps no state between runs
+  {
+    std::unique_ptr<SessionState> state;
+    ASSERT_STATUS_OK(CreateSessionState("0", state));
+
+    state->ReleaseExecutionFrameState(std::make_unique<ExecutionFrameState>());
+    EXPECT_EQ(state->AcquireExecutionFrameState().get(), nullptr);
+  }
+
+  // "2" keeps at most two states, so a third released while both are kept is dropped
+  {
+    std::unique_ptr<SessionState> state;
+    ASSERT_STATUS_OK(CreateSessionState("2", state));
+
+    for (int i = 0; i < 3; ++i) {
+      state->ReleaseExecutionFrameState(std::make_unique<ExecutionFrameState>());
+    }
+
+    std::vector<std::unique_ptr<ExecutionFrameState>> kept;
+    while (auto frame_state = state->AcquireExecutionFrameState()) {
+      kept.push_back(std::move(frame_state));
+    }
+    EXPECT_EQ(kept.size(), 2u);
+  }
+
+  for (const char* invalid : {"17", "-1", "many"}) {
+    std::unique_ptr<SessionState> state;
+    auto status = CreateSessionState(invalid, state);
+    ASSERT_FALSE(status.IsOK());
+    EXPECT_THAT(status.ErrorMessage(), testing::HasSubstr(kOrtSessionOptionsConfigMaxKeptExecutionFrameStates));
+  }
+}
+
 #ifdef ENABLE_TRAINING
 TEST_F(ExecutionFrameTest, MemPatternWithExternalOutputsTest) {
   auto cpu_xp = CreateCPUExecutionProvider();
@@ -8,8 +8,12 @@
 #include <cfloat>
 #include <functional>
 #include <iterator>
+#include <mutex>
 #include <thread>
 #include <fstream>
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include "core/common/denormal.h"
@@ -19,6 +23,7 @@
 #include "core/framework/compute_capability.h"
 #include "core/framework/data_transfer_manager.h"
 #include "core/framework/execution_provider.h"
+#include "core/framework/execution_trace.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/session_state.h"
@@ -426,6 +431,152 @@ TEST(InferenceSessionTests, DisableCPUArena) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, PinnedToNumaNode) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.PinnedToNumaNode";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigNumaNode, "0"));
+
+  InferenceSessionWrapper session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+#if defined(__linux__)
+  // Each worker is pinned to one processor of node 0 that the process may run on
+  const auto numa_nodes = Env::Default().GetNumaNodeProcessors();
+  concurrency::ThreadPool* tp = session_object.GetSessionState().GetThreadPool();
+  if (numa_nodes.empty() || numa_nodes[0].empty() || tp == nullptr) {
+    return;
+  }
+  const auto& node_processors = numa_nodes[0];
+
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(allowed), &allowed), 0);
+
+  const auto caller = std::this_thread::get_id();
+  std::mutex mutex;
+  std::vector<cpu_set_t> worker_affinities;
+  concurrency::ThreadPool::TrySimpleParallelFor(tp, 64, [&](std::ptrdiff_t) {
+    if (std::this_thread::get_id() == caller) {
+      return;
+    }
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(affinity), &affinity), 0);
+    std::lock_guard<std::mutex> lock(mutex);
+    worker_affinities.push_back(affinity);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  });
+
+  for (auto& affinity : worker_affinities) {
+    ASSERT_EQ(CPU_COUNT(&affinity), 1);
+    const auto processor = std::find_if(node_processors.begin(), node_processors.end(),
+                                        [&](size_t cpu) { return CPU_ISSET(cpu, &affinity); });
+    ASSERT_NE(processor, node_processors.end());
+    ASSERT_TRUE(CPU_ISSET(*processor, &allowed));
+  }
+#endif
+}
+
+TEST(InferenceSessionTests, AdaptiveSpinningThreadPoolStats) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.AdaptiveSpinningThreadPoolStats";
+  so.intra_op_param.thread_pool_size = 2;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigIntraOpAdaptiveSpinning, "1"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  // Sequential execution creates no inter-op thread pool
+  auto inter_op_stats = session_object.GetThreadPoolStats(true);
+  EXPECT_EQ(inter_op_stats.spins, 0u);
+  EXPECT_EQ(inter_op_stats.parks, 0u);
+  EXPECT_EQ(inter_op_stats.wakeups, 0u);
+}
+
+// mul_1.onnx computes Y = X * W, so feeding Y back as X multiplies the state by W again in each Run()
+TEST(InferenceSessionTests, StatefulRun) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.StatefulRun";
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigStatefulIOPairs, "Y:X"));
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+
+  NameMLValMap initial_feeds;
+  initial_feeds.insert(std::make_pair("X", ml_value));
+  NameMLValMap no_feeds;
+
+  const std::vector<float> expected_step_1 = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  const std::vector<float> expected_step_2 = {1.0f, 8.0f, 27.0f, 64.0f, 125.0f, 216.0f};
+
+  std::vector<std::string> output_names{"Y"};
+  std::vector<OrtValue> fetches;
+
+  // the first run of a stream provides X. later runs use the state.
+  RunOptions run_options;
+  ASSERT_STATUS_OK(session_object.Run(run_options, initial_feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims_mul_x, expected_step_1);
+
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(run_options, no_feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims_mul_x, expected_step_2);
+
+  // a different stream has no state yet so X is missing
+  RunOptions other_stream_run_options;
+  ASSERT_STATUS_OK(other_stream_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigStatefulStreamId,
+                                                                          "other"));
+  fetches.clear();
+  ASSERT_FALSE(session_object.Run(other_stream_run_options, no_feeds, output_names, &fetches).IsOK());
+
+  // reset the default stream and start again
+  RunOptions reset_run_options;
+  ASSERT_STATUS_OK(reset_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigStatefulReset, "1"));
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(reset_run_options, initial_feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims_mul_x, expected_step_1);
+
+  // end the default stream. the state from this run is not kept.
+  RunOptions end_run_options;
+  ASSERT_STATUS_OK(end_run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigStatefulEndStream, "1"));
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(end_run_options, no_feeds, output_names, &fetches));
+  VerifyOutputs(fetches, dims_mul_x, expected_step_2);
+
+  fetches.clear();
+  ASSERT_FALSE(session_object.Run(run_options, no_feeds, output_names, &fetches).IsOK());
+}
+
+TEST(InferenceSessionTests, StatefulRunInvalidPairs) {
+  for (const char* pairs : {"Y", "Y:not_an_input", "not_an_output:X"}) {
+    SessionOptions so;
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigStatefulIOPairs, pairs));
+
+    InferenceSession session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+    ASSERT_FALSE(session_object.Initialize().IsOK()) << pairs;
+  }
+}
+
 TEST(InferenceSessionTests, TestModelSerialization) {
   // Load model with level 0 transform level
   // and assert that the model has Identity nodes.
@@ -760,6 +911,179 @@ TEST(InferenceSessionTests, MultipleSessionsNoTimeout) {
   thread2.join();
 }
 
+// Runs racing on the first lookup of the memory pattern cache and then reading it while it is published
+TEST(InferenceSessionTests, ConcurrentRunsWithMemoryPatterns) {
+  SessionOptions so;
+
+  so.session_logid = "InferenceSessionTests.ConcurrentRunsWithMemoryPatterns";
+  so.enable_mem_pattern = true;
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&session_object, i]() {
+      RunOptions run_options;
+      run_options.run_tag = "one session/thread " + std::to_string(i);
+      for (int run = 0; run < 20; ++run) {
+        RunModel(session_object, run_options);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(session_object.GetCurrentNumRuns(), 0);
+}
+
+// Runs after the warmup run with the same input shapes replay the trace cached with the memory pattern
+TEST(InferenceSessionTests, ReplayCpuGraph) {
+  // the builds with per node diagnostics or instrumentation never replay
+#ifdef REPLAY_EXECUTION_TRACE
+  constexpr bool can_replay = true;
+#else
+  constexpr bool can_replay = false;
+#endif
+
+  std::vector<float> outputs[2];
+  for (const bool enable_replay : {false, true}) {
+    SessionOptions so;
+    so.session_logid = "InferenceSessionTests.ReplayCpuGraph";
+    so.enable_mem_pattern = true;
+    if (enable_replay) {
+      ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigEnableCpuGraphReplay, "1"));
+    }
+
+    InferenceSessionWrapper session_object{so, GetEnvironment()};
+    ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    // the same shape with different values in each run, so a replay cannot pass by reusing the previous outputs
+    RunOptions run_options;
+    const std::vector<std::string> output_names{"Y"};
+    for (int run = 0; run < 3; ++run) {
+      OrtValue x_value;
+      CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {3, 2},
+                           {1.0f + run, 2.0f, 3.0f, 4.0f + run, 5.0f, 6.0f * run}, &x_value);
+      NameMLValMap feeds{{"X", x_value}};
+      std::vector<OrtValue> fetches;
+      ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+      const auto& y = fetches[0].Get<Tensor>();
+      outputs[enable_replay].insert(outputs[enable_replay].end(), y.Data<float>(),
+                                    y.Data<float>() + y.Shape().Size());
+    }
+
+    // the warmup run records the trace, the other two replay it
+    const SessionState& session_state = session_object.GetSessionState();
+    EXPECT_EQ(session_state.GetNumExecutionTraceReplays(), enable_replay && can_replay ? 2u : 0u);
+
+    int x_idx = -1;
+    ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("X", x_idx));
+    OrtValue x_value;
+    CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {3, 2},
+                         std::vector<float>(6, 1.0f), &x_value);
+    const std::vector<OrtValue> feeds{x_value};
+
+    const std::unordered_map<int, TensorShape>* inferred_shapes = nullptr;
+    const ExecutionTrace* trace = nullptr;
+    ASSERT_NE(session_state.GetMemoryPatternGroup(feeds, {x_idx}, inferred_shapes, trace), nullptr);
+    if (enable_replay) {
+      ASSERT_NE(trace, nullptr);
+      EXPECT_EQ(trace->steps.size(), session_state.GetExecutionPlan()->execution_plan.size());
+    } else {
+      EXPECT_EQ(trace, nullptr);
+    }
+  }
+
+  EXPECT_EQ(outputs[0], outputs[1]);
+}
+
+TEST(InferenceSessionTests, RunPriorityAndDeadline) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunPriorityAndDeadline";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  for (const char* priority : {"low", "normal", "high"}) {
+    RunOptions run_options;
+    ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigPriority, priority));
+    ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDeadlineMs, "60000"));
+    RunModel(session_object, run_options);
+  }
+
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {3, 2},
+                       {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}, &ml_value);
+  NameMLValMap feeds{{"X", ml_value}};
+  std::vector<OrtValue> fetches;
+
+  RunOptions invalid_priority;
+  ASSERT_STATUS_OK(invalid_priority.config_options.AddConfigEntry(kOrtRunOptionsConfigPriority, "urgent"));
+  auto status = session_object.Run(invalid_priority, feeds, {"Y"}, &fetches);
+  ASSERT_FALSE(status.IsOK());
+  EXPECT_THAT(status.ErrorMessage(), testing::HasSubstr(kOrtRunOptionsConfigPriority));
+
+  RunOptions invalid_deadline;
+  ASSERT_STATUS_OK(invalid_deadline.config_options.AddConfigEntry(kOrtRunOptionsConfigDeadlineMs, "-1"));
+  status = session_object.Run(invalid_deadline, feeds, {"Y"}, &fetches);
+  ASSERT_FALSE(status.IsOK());
+  EXPECT_THAT(status.ErrorMessage(), testing::HasSubstr(kOrtRunOptionsConfigDeadlineMs));
+}
+
+// A chain of large MatMul nodes takes far longer than 1ms, so the executor finds the deadline passed between nodes
+TEST(InferenceSessionTests, RunExceedsDeadline) {
+  constexpr int64_t dim = 512;
+  constexpr int num_nodes = 32;
+
+  onnxruntime::Model model("deadline_graph", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                           {{kOnnxDomain, 12}}, {}, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+
+  auto* input_arg = &graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto* prev_arg = input_arg;
+  for (int i = 0; i < num_nodes; ++i) {
+    auto& output_arg = graph.GetOrCreateNodeArg(i + 1 == num_nodes ? "Y" : "T" + std::to_string(i), &float_tensor);
+    graph.AddNode("matmul_" + std::to_string(i), "MatMul", "MatMul", {prev_arg, input_arg}, {&output_arg});
+    prev_arg = &output_arg;
+  }
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::string serialized_model;
+  model.ToProto().SerializeToString(&serialized_model);
+  std::stringstream model_stream(serialized_model);
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunExceedsDeadline";
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(model_stream));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {dim, dim},
+                       std::vector<float>(dim * dim, 1.0f / dim), &ml_value);
+  NameMLValMap feeds{{"X", ml_value}};
+  std::vector<OrtValue> fetches;
+
+  RunOptions run_options;
+  ASSERT_STATUS_OK(run_options.config_options.AddConfigEntry(kOrtRunOptionsConfigDeadlineMs, "1"));
+  auto status = session_object.Run(run_options, feeds, {"Y"}, &fetches);
+  ASSERT_FALSE(status.IsOK());
+  EXPECT_THAT(status.ErrorMessage(), testing::HasSubstr("exceeding its deadline"));
+
+  // the same run without a deadline completes
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(RunOptions{}, feeds, {"Y"}, &fetches));
+}
+
 TEST(InferenceSessionTests, PreAllocateOutputVector) {
   SessionOptions so;
 
@@ -0,0 +1,236 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+#include <cmath>
+#include <cstring>
+
+class MlasCastTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferFloat;
+  MatrixGuardBuffer<float> BufferFloatOutput;
+  MatrixGuardBuffer<unsigned short> BufferHalf;
+  MatrixGuardBuffer<unsigned short> BufferHalfOutput;
+
+  static uint32_t BitsOf(float Value) {
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(Bits));
+    return Bits;
+  }
+
+  static float FromBits(uint32_t Bits) {
+    float Value;
+    memcpy(&Value, &Bits, sizeof(Value));
+    return Value;
+  }
+
+  static float ReferenceHalfToFloat(unsigned short Half) {
+    const int Exponent = (Half >> 10) & 0x1F;
+    const int Mantissa = Half & 0x3FF;
+    const float Sign = (Half & 0x8000) ? -1.0f : 1.0f;
+    if (Exponent == 0x1F) {
+      return Mantissa == 0 ? Sign * std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+    }
+    if (Exponent == 0) {
+      return Sign * std::ldexp(float(Mantissa), -24);
+    }
+    return Sign * std::ldexp(float(Mantissa + 0x400), Exponent - 25);
+  }
+
+  static uint16_t ReferenceFloatToBFloat16(float Value) {
+    uint32_t Bits = BitsOf(Value);
+    if (std::isnan(Value)) {
+      return uint16_t((Bits >> 16) | 0x0040);
+    }
+    // round to nearest even using double arithmetic on the two candidates
+    const uint16_t Truncated = uint16_t(Bits >> 16);
+    const double Lower = double(FromBits(uint32_t(Truncated) << 16));
+    double Upper = double(FromBits(uint32_t(Truncated + 1) << 16));
+    if (std::isinf(Upper)) {
+      // rounding past the largest finite value overflows to infinity
+      Upper = std::copysign(std::ldexp(1.0, 128), Upper);
+    }
+    const double Error = std::fabs(double(Value) - Lower) - std::fabs(Upper - double(Value));
+    if (Error > 0 || (Error == 0 && (Truncated & 1) != 0)) {
+      return uint16_t(Truncated + 1);
+    }
+    return Truncated;
+  }
+
+  template <typename OutputType>
+  static OutputType ReferenceFloatToInteger(float Value) {
+    if (std::isnan(Value)) {
+      return std::numeric_limits<OutputType>::lowest();
+    }
+    double Truncated = std::trunc(double(Value));
+    Truncated = std::max(Truncated, double(std::numeric_limits<OutputType>::lowest()));
+    Truncated = std::min(Truncated, double(std::numeric_limits<OutputType>::max()));
+    return OutputType(Truncated);
+  }
+
+  void TestHalf(void) {
+    constexpr size_t N = 0x10000;
+
+    unsigned short* Half = BufferHalf.GetBuffer(N);
+    float* Float = BufferFloatOutput.GetBuffer(N);
+    unsigned short* HalfOutput = BufferHalfOutput.GetBuffer(N);
+
+    for (size_t n = 0; n < N; n++) {
+      Half[n] = static_cast<unsigned short>(n);
+    }
+
+    MlasConvertHalfToFloatBuffer(Half, Float, N);
+
+    for (size_t n = 0; n < N; n++) {
+      float Expected = ReferenceHalfToFloat(Half[n]);
+      if (std::isnan(Expected)) {
+        ASSERT_TRUE(std::isnan(Float[n])) << ", half=" << n;
+      } else {
+        ASSERT_EQ(BitsOf(Float[n]), BitsOf(Expected)) << ", half=" << n;
+      }
+    }
+
+    // Every half value converts back to itself (NaNs become quiet NaNs).
+    MlasConvertFloatToHalfBuffer(Float, HalfOutput, N);
+
+    for (size_t n = 0; n < N; n++) {
+      if (std::isnan(Float[n])) {
+        ASSERT_EQ(HalfOutput[n] & 0x7E00, 0x7E00) << ", half=" << n;
+      } else {
+        ASSERT_EQ(HalfOutput[n], Half[n]) << ", half=" << n;
+      }
+    }
+
+    // Values halfway between two adjacent finite halves round to the even
+    // mantissa; values just off the midpoint round to the nearer one.
+    float* Input = BufferFloat.GetBuffer(3 * 0x7BFF);
+    size_t Count = 0;
+    for (unsigned short h = 0; h < 0x7BFF; h++) {
+      float Lower = ReferenceHalfToFloat(h);
+      float Upper = ReferenceHalfToFloat(static_cast<unsigned short>(h + 1));
+      float Midpoint = float((double(Lower) + double(Upper)) / 2);
+      Input[Count++] = Midpoint;
+      Input[Count++] = std::nextafter(Midpoint, Lower);
+      Input[Count++] = std::nextafter(Midpoint, Upper);
+    }
+
+    HalfOutput = BufferHalfOutput.GetBuffer(Count);
+    MlasConvertFloatToHalfBuffer(Input, HalfOutput, Count);
+
+    for (size_t i = 0; i < Count; i += 3) {
+      unsigned short h = static_cast<unsigned short>(i / 3);
+      unsigned short Even = (h & 1) ? static_cast<unsigned short>(h + 1) : h;
+      ASSERT_EQ(HalfOutput[i], Even) << ", midpoint of half=" << h;
+      ASSERT_EQ(HalfOutput[i + 1], h) << ", below midpoint of half=" << h;
+      ASSERT_EQ(HalfOutput[i + 2], h + 1) << ", above midpoint of half=" << h;
+    }
+
+    // Overflow to infinity and sign handling.
+    const float Special[] = {65504.0f, 65519.0f, 65520.0f, 1e10f, -65520.0f, -0.0f,
+                             std::numeric_limits<float>::infinity(), 1e-10f, -1e-10f};
+    const unsigned short SpecialExpected[] = {0x7BFF, 0x7BFF, 0x7C00, 0x7C00, 0xFC00, 0x8000, 0x7C00, 0x0000, 0x8000};
+    MlasConvertFloatToHalfBuffer(Special, HalfOutput, _countof(Special));
+    for (size_t i = 0; i < _countof(Special); i++) {
+      ASSERT_EQ(HalfOutput[i], SpecialExpected[i]) << ", value=" << Special[i];
+    }
+  }
+
+  void TestBFloat16(size_t N) {
+    float* Input = BufferFloat.GetBuffer(N);
+    unsigned short* Output = BufferHalfOutput.GetBuffer(N);
+    float* Float = BufferFloatOutput.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    std::uniform_int_distribution<uint32_t> distribution;
+
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = FromBits(distribution(generator));
+    }
+    if (N > 3) {
+      Input[0] = std::numeric_limits<float>::quiet_NaN();
+      Input[1] = FromBits(0x3F808000);  // tie, rounds down to even
+      Input[2] = FromBits(0x3F818000);  // tie, rounds up to even
+    }
+
+    MlasConvertFloatToBFloat16Buffer(Input, Output, N);
+    MlasConvertBFloat16ToFloatBuffer(Output, Float, N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Output[n], ReferenceFloatToBFloat16(Input[n])) << ", size=" << N << ", index=" << n;
+      ASSERT_EQ(BitsOf(Float[n]), uint32_t(Output[n]) << 16) << ", size=" << N << ", index=" << n;
+    }
+  }
+
+  template <typename OutputType>
+  void TestFloatToInteger(size_t N) {
+    float* Input = BufferFloat.GetBuffer(N);
+    std::vector<OutputType> Output(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    const float Range = 4.0f * float(std::numeric_limits<OutputType>::max());
+    std::uniform_real_distribution<float> distribution(-Range, Range);
+
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = distribution(generator);
+    }
+    if (N > 4) {
+      Input[0] = std::numeric_limits<float>::quiet_NaN();
+      Input[1] = std::numeric_limits<float>::infinity();
+      Input[2] = -std::numeric_limits<float>::infinity();
+      Input[3] = -0.75f;
+    }
+
+    MlasConvertFloatToIntegerBuffer<OutputType>(Input, Output.data(), N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Output[n], ReferenceFloatToInteger<OutputType>(Input[n]))
+          << ", size=" << N << ", index=" << n << ", value=" << Input[n];
+    }
+  }
+
+  void TestInt32ToFloat(size_t N) {
+    std::vector<int32_t> Input(N);
+    float* Output = BufferFloatOutput.GetBuffer(N);
+
+    std::default_random_engine generator(static_cast<unsigned>(N));
+    std::uniform_int_distribution<int32_t> distribution(std::numeric_limits<int32_t>::lowest(),
+                                                        std::numeric_limits<int32_t>::max());
+    for (size_t n = 0; n < N; n++) {
+      Input[n] = distribution(generator);
+    }
+
+    MlasConvertInt32ToFloatBuffer(Input.data(), Output, N);
+
+    for (size_t n = 0; n < N; n++) {
+      ASSERT_EQ(Output[n], float(Input[n])) << ", size=" << N << ", index=" << n;
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("Cast");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    TestHalf();
+    for (size_t n = 1; n <= 128; n++) {
+      TestBFloat16(n);
+      TestFloatToInteger<int8_t>(n);
+      TestFloatToInteger<uint8_t>(n);
+      TestFloatToInteger<int32_t>(n);
+      TestInt32ToFloat(n);
+    }
+  }
+};
+
+template <> MlasCastTest* MlasTestFixture<MlasCastTest>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasCastTest>::RegisterShortExecute();
+  }
+  return count;
+});
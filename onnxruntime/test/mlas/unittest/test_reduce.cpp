@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+#include <cmath>
+
+class MlasReduceTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferInput;
+  MatrixGuardBuffer<float> BufferOutput;
+  MatrixGuardBuffer<float> BufferOutputReference;
+
+  static float ReferenceReduce(MLAS_REDUCE_KIND ReduceKind, const float* Input, size_t Count, size_t Stride) {
+    if (ReduceKind == MlasReduceLogSumExp) {
+      float Maximum = -std::numeric_limits<float>::infinity();
+      for (size_t i = 0; i < Count; i++) {
+        Maximum = std::max(Maximum, Input[i * Stride]);
+      }
+      const float Shift = std::isfinite(Maximum) ? Maximum : 0.0f;
+      double Sum = 0.0;
+      for (size_t i = 0; i < Count; i++) {
+        Sum += std::exp(double(Input[i * Stride] - Shift));
+      }
+      return float(std::log(Sum) + Shift);
+    }
+
+    double Accumulator = ReduceKind == MlasReduceMaximum   ? -std::numeric_limits<double>::infinity()
+                         : ReduceKind == MlasReduceMinimum ? std::numeric_limits<double>::infinity()
+                                                           : 0.0;
+    for (size_t i = 0; i < Count; i++) {
+      const double Value = Input[i * Stride];
+      switch (ReduceKind) {
+        case MlasReduceSum:
+          Accumulator += Value;
+          break;
+        case MlasReduceSumSquare:
+          Accumulator += Value * Value;
+          break;
+        case MlasReduceMaximum:
+          Accumulator = std::max(Accumulator, Value);
+          break;
+        default:
+          Accumulator = std::min(Accumulator, Value);
+          break;
+      }
+    }
+    return float(Accumulator);
+  }
+
+  static float Combine(MLAS_REDUCE_KIND ReduceKind, float Accumulator, float Value) {
+    switch (ReduceKind) {
+      case MlasReduceMaximum:
+        return std::max(Accumulator, Value);
+      case MlasReduceMinimum:
+        return std::min(Accumulator, Value);
+      default:
+        return Accumulator + Value;
+    }
+  }
+
+  void Test(MLAS_REDUCE_KIND ReduceKind, bool ReduceRows, size_t Rows, size_t Columns, bool Accumulate) {
+    const size_t ldInput = Columns + 3;
+    const size_t OutputCount = ReduceRows ? Rows : Columns;
+
+    float* Input = BufferInput.GetBuffer(Rows * ldInput);
+    float* Output = BufferOutput.GetBuffer(OutputCount);
+    float* OutputReference = BufferOutputReference.GetBuffer(OutputCount);
+
+    std::default_random_engine generator(static_cast<unsigned>(Rows * 131 + Columns));
+    std::uniform_real_distribution<float> distribution(-4.0f, 4.0f);
+
+    for (size_t i = 0; i < Rows * ldInput; i++) {
+      Input[i] = distribution(generator);
+    }
+
+    for (size_t i = 0; i < OutputCount; i++) {
+      Output[i] = distribution(generator);
+      OutputReference[i] = Output[i];
+    }
+
+    for (size_t i = 0; i < OutputCount; i++) {
+      const float Value = ReduceRows ? ReferenceReduce(ReduceKind, Input + i * ldInput, Columns, 1)
+                                     : ReferenceReduce(ReduceKind, Input + i, Rows, ldInput);
+      OutputReference[i] = Accumulate ? Combine(ReduceKind, OutputReference[i], Value) : Value;
+    }
+
+    if (ReduceRows) {
+      MlasReduceRows(ReduceKind, Input, Output, Rows, Columns, ldInput, Accumulate);
+    } else {
+      MlasReduceColumns(ReduceKind, Input, Output, Rows, Columns, ldInput, Accumulate);
+    }
+
+    const size_t Count = ReduceRows ? Columns : Rows;
+    const float Tolerance = 1e-5f * float(Count + 1) * 16.0f;
+
+    for (size_t i = 0; i < OutputCount; i++) {
+      ASSERT_NEAR(Output[i], OutputReference[i], std::max(Tolerance, std::fabs(OutputReference[i]) * 1e-5f))
+          << ", kind=" << int(ReduceKind) << ", rows=" << Rows << ", columns=" << Columns
+          << ", reduce_rows=" << ReduceRows << ", accumulate=" << Accumulate << ", index=" << i;
+    }
+  }
+
+  void TestLogSumExpSpecialValues(void) {
+    const float Infinity = std::numeric_limits<float>::infinity();
+    const float Input[] = {-Infinity, -Infinity, -Infinity, 1.0f, Infinity, 2.0f};
+    float Output[3];
+
+    MlasReduceRows(MlasReduceLogSumExp, Input, Output, 3, 2, 2, false);
+
+    ASSERT_EQ(Output[0], -Infinity);
+    ASSERT_NEAR(Output[1], 1.0f, 1e-6f);
+    ASSERT_EQ(Output[2], Infinity);
+
+    MlasReduceColumns(MlasReduceLogSumExp, Input, Output, 2, 3, 3, false);
+
+    ASSERT_NEAR(Output[0], 1.0f, 1e-6f);
+    ASSERT_EQ(Output[1], Infinity);
+    ASSERT_NEAR(Output[2], 2.0f, 1e-6f);
+
+    MlasReduceColumns(MlasReduceLogSumExp, Input, Output, 1, 3, 3, false);
+
+    ASSERT_EQ(Output[0], -Infinity);
+  }
+
+  void TestMaximumMinimumInfiniteValues(void) {
+    const float Infinity = std::numeric_limits<float>::infinity();
+    const size_t Counts[] = {1, 3, 4, 7, 16, 17};
+
+    // rows of -inf reduce to -inf with maximum and rows of +inf to +inf with minimum, e.g. fully masked attention rows
+    for (size_t Count : Counts) {
+      for (float Value : {-Infinity, Infinity}) {
+        const MLAS_REDUCE_KIND ReduceKind = Value < 0 ? MlasReduceMaximum : MlasReduceMinimum;
+        std::vector<float> Input(Count * 2, Value);
+        float Output[2];
+
+        MlasReduceRows(ReduceKind, Input.data(), Output, 2, Count, Count, false);
+        ASSERT_EQ(Output[0], Value) << ", kind=" << int(ReduceKind) << ", count=" << Count;
+        ASSERT_EQ(Output[1], Value) << ", kind=" << int(ReduceKind) << ", count=" << Count;
+
+        std::vector<float> ColumnOutput(Count);
+        MlasReduceColumns(ReduceKind, Input.data(), ColumnOutput.data(), 2, Count, Count, false);
+        for (size_t i = 0; i < Count; i++) {
+          ASSERT_EQ(ColumnOutput[i], Value) << ", kind=" << int(ReduceKind) << ", count=" << Count;
+        }
+      }
+    }
+  }
+
+ public:
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name("Reduce");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    const MLAS_REDUCE_KIND Kinds[] = {MlasReduceSum, MlasReduceSumSquare, MlasReduceMaximum, MlasReduceMinimum,
+                                      MlasReduceLogSumExp};
+    const size_t Sizes[] = {1, 3, 4, 7, 16, 17, 33, 64, 67, 130};
+
+    for (MLAS_REDUCE_KIND Kind : Kinds) {
+      for (size_t Rows : Sizes) {
+        for (size_t Columns : Sizes) {
+          for (bool ReduceRows : {true, false}) {
+            Test(Kind, ReduceRows, Rows, Columns, false);
+            if (Kind != MlasReduceLogSumExp) {
+              Test(Kind, ReduceRows, Rows, Columns, true);
+            }
+          }
+        }
+      }
+    }
+
+    TestLogSumExpSpecialValues();
+    TestMaximumMinimumInfiniteValues();
+  }
+};
+
+template <> MlasReduceTest* MlasTestFixture<MlasReduceTest>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasReduceTest>::RegisterShortExecute();
+  }
+  return count;
+});
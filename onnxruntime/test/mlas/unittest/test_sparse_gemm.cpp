@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test_util.h"
+
+template <bool Threaded>
+class MlasSparseGemmTest : public MlasTestBase {
+ private:
+  MatrixGuardBuffer<float> BufferA;
+  MatrixGuardBuffer<float> BufferB;
+  MatrixGuardBuffer<float> BufferC;
+  MatrixGuardBuffer<float> BufferCReference;
+  MatrixGuardBuffer<uint8_t> BufferPackedB;
+  MLAS_THREADPOOL* threadpool_;
+
+  void Test(bool TransA, bool TransB, size_t M, size_t N, size_t K, float Density, float alpha) {
+    const size_t lda = (TransA ? M : K) + 1;
+    const size_t ldb = (TransB ? K : N) + 2;
+    const size_t ldc = N + 3;
+
+    float* A = BufferA.GetBuffer((TransA ? K : M) * lda);
+    float* B = BufferB.GetBuffer((TransB ? N : K) * ldb);
+    float* C = BufferC.GetBuffer(M * ldc);
+    float* CReference = BufferCReference.GetBuffer(M * ldc);
+
+    std::default_random_engine generator(static_cast<unsigned>(M * 7919 + N * 131 + K));
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> keep(0.0f, 1.0f);
+
+    for (size_t i = 0; i < (TransA ? K : M) * lda; i++) {
+      A[i] = distribution(generator);
+    }
+    for (size_t i = 0; i < (TransB ? N : K) * ldb; i++) {
+      B[i] = keep(generator) < Density ? distribution(generator) : 0.0f;
+    }
+    for (size_t i = 0; i < M * ldc; i++) {
+      C[i] = -0.5f;
+      CReference[i] = -0.5f;
+    }
+
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < N; n++) {
+        double Sum = 0.0;
+        for (size_t k = 0; k < K; k++) {
+          const double a = TransA ? A[k * lda + m] : A[m * lda + k];
+          const double b = TransB ? B[n * ldb + k] : B[k * ldb + n];
+          Sum += a * b;
+        }
+        CReference[m * ldc + n] = float(Sum * alpha);
+      }
+    }
+
+    const CBLAS_TRANSPOSE TransposeB = TransB ? CblasTrans : CblasNoTrans;
+    const size_t PackedBSize = MlasSparseGemmPackBSize(TransposeB, N, K, B, ldb);
+    ASSERT_GT(PackedBSize, size_t(0));
+    void* PackedB = BufferPackedB.GetBuffer(PackedBSize, true);
+    MlasSparseGemmPackB(TransposeB, N, K, B, ldb, PackedB);
+
+    MlasSparseGemm(TransA ? CblasTrans : CblasNoTrans, M, N, K, alpha, A, lda, PackedB, C, ldc, threadpool_);
+
+    for (size_t m = 0; m < M; m++) {
+      for (size_t n = 0; n < ldc; n++) {
+        ASSERT_NEAR(C[m * ldc + n], CReference[m * ldc + n], 1e-4f * float(K + 1))
+            << ", M=" << M << ", N=" << N << ", K=" << K << ", TransA=" << TransA << ", TransB=" << TransB
+            << ", Density=" << Density << ", m=" << m << ", n=" << n;
+      }
+    }
+  }
+
+ public:
+  MlasSparseGemmTest() : threadpool_(Threaded ? GetMlasThreadPool() : nullptr) {}
+
+  static const char* GetTestSuiteName() {
+    static const std::string suite_name = std::string("SparseGemm") + (Threaded ? "_Threaded" : "_SingleThread");
+    return suite_name.c_str();
+  }
+
+  void ExecuteShort(void) override {
+    for (size_t M : {1, 3, 8, 9, 17, 64}) {
+      for (size_t N : {1, 5, 16, 33}) {
+        for (size_t K : {1, 7, 32, 100}) {
+          for (float Density : {0.0f, 0.1f, 0.5f, 1.0f}) {
+            for (bool TransA : {false, true}) {
+              for (bool TransB : {false, true}) {
+                Test(TransA, TransB, M, N, K, Density, 1.0f);
+              }
+            }
+          }
+        }
+      }
+    }
+
+    Test(false, false, 33, 20, 50, 0.2f, 0.5f);
+    Test(false, false, 256, 300, 512, 0.1f, 1.0f);
+  }
+};
+
+template <> MlasSparseGemmTest<false>* MlasTestFixture<MlasSparseGemmTest<false>>::mlas_tester(nullptr);
+template <> MlasSparseGemmTest<true>* MlasTestFixture<MlasSparseGemmTest<true>>::mlas_tester(nullptr);
+
+static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
+  size_t count = 0;
+  if (is_short_execute) {
+    count += MlasDirectShortExecuteTests<MlasSparseGemmTest<false>>::RegisterShortExecute();
+    if (GetMlasThreadPool() != nullptr) {
+      count += MlasDirectShortExecuteTests<MlasSparseGemmTest<true>>::RegisterShortExecute();
+    }
+  }
+  return count;
+});
@@ -22,10 +22,28 @@ class MlasTransposeTest : public MlasTestBase {
     ASSERT_EQ(memcmp(Output, OutputReference, M * N * sizeof(ElementType)), 0) << " [" << M << "," << N << "]";
   }
 
+  void
+  TestStrided(size_t M, size_t N, size_t InputStride, size_t OutputStride) {
+    ElementType* Input = BufferInput.GetBuffer(M * InputStride);
+    ElementType* Output = BufferOutput.GetBuffer(N * OutputStride, true);
+    ElementType* OutputReference = BufferOutputReference.GetBuffer(N * OutputStride, true);
+
+    MlasTranspose(Input, InputStride, Output, OutputStride, M, N);
+    ReferenceTranspose(Input, InputStride, OutputReference, OutputStride, M, N);
+
+    ASSERT_EQ(memcmp(Output, OutputReference, N * OutputStride * sizeof(ElementType)), 0)
+        << " [" << M << "," << N << "," << InputStride << "," << OutputStride << "]";
+  }
+
   void ReferenceTranspose(const ElementType* Input, ElementType* Output, size_t M, size_t N) {
+    ReferenceTranspose(Input, N, Output, M, M, N);
+  }
+
+  void ReferenceTranspose(const ElementType* Input, size_t InputStride, ElementType* Output, size_t OutputStride,
+                          size_t M, size_t N) {
     for (size_t m = 0; m < M; m++) {
       for (size_t n = 0; n < N; n++) {
-        Output[n * M + m] = Input[m * N + n];
+        Output[n * OutputStride + m] = Input[m * InputStride + n];
       }
     }
   }
@@ -40,18 +58,21 @@ class MlasTransposeTest : public MlasTestBase {
     for (size_t m = 1; m <= 32; m++) {
       for (size_t n = 1; n <= 32; n++) {
         Test(m, n);
+        TestStrided(m, n, n + 3, m + 5);
       }
     }
   }
 };
 
 template <> MlasTransposeTest<uint32_t>* MlasTestFixture<MlasTransposeTest<uint32_t>>::mlas_tester(nullptr);
+template <> MlasTransposeTest<uint16_t>* MlasTestFixture<MlasTransposeTest<uint16_t>>::mlas_tester(nullptr);
 template <> MlasTransposeTest<uint8_t>* MlasTestFixture<MlasTransposeTest<uint8_t>>::mlas_tester(nullptr);
 
 static UNUSED_VARIABLE bool added_to_main = AddTestRegister([](bool is_short_execute) {
   size_t count = 0;
   if (is_short_execute) {
       count += MlasDirectShortExecuteTests<MlasTransposeTest<uint32_t>>::RegisterShortExecute();
+      count += MlasDirectShortExecuteTests<MlasTransposeTest<uint16_t>>::RegisterShortExecute();
       count += MlasDirectShortExecuteTests<MlasTransposeTest<uint8_t>>::RegisterShortExecute();
   }
   return count;
@@ -48,6 +48,7 @@
 #include "core/optimizer/graph_transformer_mgr.h"
 #include "core/optimizer/graph_transformer_utils.h"
 #include "core/optimizer/identity_elimination.h"
+#include "core/optimizer/image_preprocess_fusion.h"
 #include "core/optimizer/initializer.h"
 #include "core/optimizer/layer_norm_fusion.h"
 #include "core/optimizer/matmul_add_fusion.h"
@@ -64,6 +65,7 @@
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/isinf_reducesum_fusion.h"
 #include "core/optimizer/propagate_cast_ops.h"
+#include "core/optimizer/reduce_mean_sub_pow_fusion.h"
 #include "core/optimizer/utils.h"
 #include "core/platform/env.h"
 #include "core/session/inference_session.h"
@@ -73,6 +75,7 @@
 #include "test/common/tensor_op_test_utils.h"
 #include "test/compare_ortvalue.h"
 #include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_builder.h"
 #include "test/optimizer/graph_transform_test_fixture.h"
 #include "test/providers/provider_test_utils.h"
 #include "test/test_environment.h"
@@ -3630,6 +3633,96 @@ TEST_F(GraphTransformationTests, BiasDropoutFusionTest) {
   TestBiasDropoutFusion(MODEL_FOLDER "fusion/bias_dropout_residual_same_shape_fusion_dim_is_param.onnx", *logger_);
 }
 
+#if !defined(DISABLE_CONTRIB_OPS)
+// X --> ReduceMean --> Sub --> Pow(2) --> ReduceMean, with Sub also feeding a Mul that is not part of a
+// layer normalization, so that only the ReduceMean + Sub + Pow head can be fused.
+static void TestReduceMeanSubPowFusion(const std::vector<int64_t>& axes, bool expect_fusion) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({2, 3, 8}, -2.f, 2.f);
+    auto* mean_out = builder.MakeIntermediate();
+    auto* sub_out = builder.MakeIntermediate();
+    auto* pow_out = builder.MakeIntermediate();
+    auto* variance_out = builder.MakeOutput();
+    auto* mul_out = builder.MakeOutput();
+
+    builder.AddNode("ReduceMean", {input_arg}, {mean_out}).AddAttribute("axes", axes);
+    builder.AddNode("Sub", {input_arg, mean_out}, {sub_out});
+    builder.AddNode("Pow", {sub_out, builder.MakeScalarInitializer<float>(2.f)}, {pow_out});
+    builder.AddNode("ReduceMean", {pow_out}, {variance_out}).AddAttribute("axes", axes);
+    builder.AddNode("Mul", {sub_out, builder.MakeScalarInitializer<float>(0.5f)}, {mul_out});
+  };
+
+  auto check_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.ReduceMeanSubPow"], expect_fusion ? 1 : 0);
+    EXPECT_EQ(op_to_count["Sub"], expect_fusion ? 0 : 1);
+    EXPECT_EQ(op_to_count["Pow"], expect_fusion ? 0 : 1);
+    EXPECT_EQ(op_to_count["ReduceMean"], expect_fusion ? 1 : 2);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13,
+                    1e-5, 1e-5, std::make_unique<ReduceMeanSubPowFusion>());
+}
+
+TEST_F(GraphTransformationTests, ReduceMeanSubPowFusionTest) {
+  TestReduceMeanSubPowFusion({-1}, true);
+  TestReduceMeanSubPowFusion({1, 2}, true);
+  TestReduceMeanSubPowFusion({2, -2}, true);
+  // The mean must be over trailing axes
+  TestReduceMeanSubPowFusion({1}, false);
+  TestReduceMeanSubPowFusion({0, 2}, false);
+}
+
+// X(uint8, NHWC) --> Cast --> Sub(mean) --> Div(std) --> Transpose --> Mul --> Resize
+static void TestImagePreprocessFusion(const std::vector<int64_t>& perm, bool resize_by_sizes, bool expect_fusion) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<uint8_t>({2, 6, 5, 3}, 0, 255);
+    auto* cast_out = builder.MakeIntermediate();
+    auto* sub_out = builder.MakeIntermediate();
+    auto* div_out = builder.MakeIntermediate();
+    auto* transpose_out = builder.MakeIntermediate();
+    auto* mul_out = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    builder.AddNode("Cast", {input_arg}, {cast_out})
+        .AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+    builder.AddNode("Sub", {cast_out, builder.MakeInitializer<float>({1, 1, 1, 3}, {123.7f, 116.3f, 103.5f})},
+                    {sub_out});
+    builder.AddNode("Div", {sub_out, builder.Make1DInitializer<float>({58.4f, 57.1f, 57.4f})}, {div_out});
+    builder.AddNode("Transpose", {div_out}, {transpose_out}).AddAttribute("perm", perm);
+    builder.AddNode("Mul", {builder.MakeScalarInitializer<float>(0.5f), transpose_out}, {mul_out});
+
+    auto* roi = builder.Make1DInitializer<float>({});
+    if (resize_by_sizes) {
+      auto* sizes = builder.Make1DInitializer<int64_t>({2, 3, 4, 8});
+      builder.AddNode("Resize", {mul_out, roi, builder.Make1DInitializer<float>({}), sizes}, {output_arg})
+          .AddAttribute("mode", "linear");
+    } else {
+      auto* scales = builder.Make1DInitializer<float>({1.0f, 1.0f, 0.5f, 2.0f});
+      builder.AddNode("Resize", {mul_out, roi, scales}, {output_arg}).AddAttribute("mode", "linear");
+    }
+  };
+
+  auto check_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.ImagePreprocess"], expect_fusion ? 1 : 0);
+    EXPECT_EQ(op_to_count["Cast"], expect_fusion ? 0 : 1);
+    EXPECT_EQ(op_to_count["Transpose"], expect_fusion ? 0 : 1);
+    EXPECT_EQ(op_to_count["Resize"], expect_fusion ? 0 : 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13,
+                    1e-4, 1e-4, std::make_unique<ImagePreprocessFusion>());
+}
+
+TEST_F(GraphTransformationTests, ImagePreprocessFusionTest) {
+  TestImagePreprocessFusion({0, 3, 1, 2}, true, true);
+  TestImagePreprocessFusion({0, 3, 1, 2}, false, true);
+  // The Transpose must produce NCHW
+  TestImagePreprocessFusion({0, 3, 2, 1}, true, false);
+}
+#endif
+
 TEST_F(GraphTransformationTests, LayerNormFusionTest) {
   auto model_uri = MODEL_FOLDER "fusion/layer_norm.onnx";
   std::shared_ptr<Model> p_model;
@@ -1212,6 +1212,44 @@ TEST(NchwcOptimizerTests, ConvReorderOutputCnhw) {
   NchwcOptimizerTester(build_test_case, check_nchwc_graph);
 }
 
+TEST(NchwcOptimizerTests, ConvRoiAlign) {
+  auto test_case = [&](const std::string& mode) {
+    auto build_test_case = [&](NchwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<float>({2, 32, 28, 30});
+      auto* conv_output_arg = helper.MakeIntermediate();
+      auto* output_arg = helper.MakeOutput();
+      auto* rois_arg = helper.MakeInitializer<float>({3, 4}, {1.f, 2.f, 19.f, 21.f,
+                                                              0.f, 0.f, 29.f, 27.f,
+                                                              4.5f, 3.f, 7.f, 12.5f});
+      auto* batch_indices_arg = helper.MakeInitializer<int64_t>({3}, {0, 1, 1});
+
+      helper.AddConvNode(input_arg, conv_output_arg, {40, 32, 3, 3});
+      auto& roi_align_node = helper.AddNode("RoiAlign", {conv_output_arg, rois_arg, batch_indices_arg},
+                                            {output_arg});
+      roi_align_node.AddAttribute("mode", mode);
+      roi_align_node.AddAttribute("output_height", static_cast<int64_t>(7));
+      roi_align_node.AddAttribute("output_width", static_cast<int64_t>(6));
+      roi_align_node.AddAttribute("sampling_ratio", static_cast<int64_t>(2));
+    };
+
+    auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Conv"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.ReorderOutput"], 1);
+      EXPECT_EQ(op_to_count["com.microsoft.RoiAlign"], 1);
+      EXPECT_EQ(op_to_count["RoiAlign"], 0);
+      EXPECT_EQ(op_to_count["Transpose"], 1);
+    };
+
+    // Verify that the NCHWc output is reordered to NHWC for the channels last
+    // RoiAlign.
+    NchwcOptimizerTester(build_test_case, check_nchwc_graph);
+  };
+
+  test_case("avg");
+  test_case("max");
+}
+
 TEST(NchwcOptimizerTests, UpsampleNearest) {
   auto test_case = [&](int opset_version, float scale_h, float scale_w, bool use_sizes_arg) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
@@ -1285,6 +1323,51 @@ TEST(NchwcOptimizerTests, UpsampleNearest) {
   test_case(13, 2.2f, 2.8f, true);
 }
 
+TEST(NchwcOptimizerTests, UpsampleNearestTransformationModes) {
+  auto test_case = [&](const std::string& transformation_mode, const std::string& nearest_mode, bool expect_nchwc) {
+    auto build_test_case = [&](NchwcTestHelper& helper) {
+      auto* input_arg = helper.MakeInput<float>({1, 16, 13, 11});
+      auto* conv_output_arg = helper.MakeIntermediate();
+      auto* output_arg = helper.MakeOutput();
+
+      helper.AddConvNode(input_arg, conv_output_arg, {24, 16, 1, 1});
+
+      std::vector<NodeArg*> input_args;
+      input_args.push_back(conv_output_arg);
+      input_args.push_back(helper.Make1DInitializer<float>({0.f, 0.f, 0.f, 0.f, 1.f, 1.f, 1.f, 1.f}));
+      input_args.push_back(helper.Make1DInitializer<float>({1.f, 1.f, 3.f, 2.f}));
+      Node& resize_node = helper.AddNode("Resize", input_args, {output_arg});
+      // An empty string leaves the attribute at its default value.
+      if (!transformation_mode.empty()) {
+        resize_node.AddAttribute("coordinate_transformation_mode", transformation_mode);
+      }
+      if (!nearest_mode.empty()) {
+        resize_node.AddAttribute("nearest_mode", nearest_mode);
+      }
+    };
+
+    auto check_nchwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.microsoft.nchwc.Upsample"], expect_nchwc ? 1 : 0);
+      EXPECT_EQ(op_to_count["Resize"], expect_nchwc ? 0 : 1);
+    };
+
+    NchwcOptimizerTester(build_test_case, check_nchwc_graph, 13);
+  };
+
+  // With integral scales these modes select the same input pixels as the NCHWc kernel.
+  test_case("", "", true);
+  test_case("half_pixel", "round_prefer_ceil", true);
+  test_case("pytorch_half_pixel", "round_prefer_floor", true);
+  test_case("tf_half_pixel_for_nn", "floor", true);
+  test_case("asymmetric", "floor", true);
+
+  // These modes select different input pixels.
+  test_case("asymmetric", "round_prefer_floor", false);
+  test_case("half_pixel", "floor", false);
+  test_case("align_corners", "floor", false);
+}
+
 TEST(NchwcOptimizerTests, UpsampleLinear) {
   auto test_case = [&](int opset_version, float scale_h, float scale_w, const std::string& transformation_mode) {
     auto build_test_case = [&](NchwcTestHelper& helper) {
@@ -1324,12 +1407,12 @@ TEST(NchwcOptimizerTests, UpsampleLinear) {
 
   // Verify that upsample nodes can be converted to the NCHWc format for
   // various versions of the operator.
-  std::vector<std::string> transformation_modes{"asymmetric", "align_corners", "half_pixel"};
+  std::vector<std::string> transformation_modes{"asymmetric", "align_corners", "half_pixel", "pytorch_half_pixel"};
   for (auto& transformation_mode : transformation_modes) {
     static const int opset_versions[] = {9, 10, 11, 13};
     for (auto opset_version : opset_versions) {
       // Older versions of the operator do not support transformation modes.
-      if (opset_version < 11 && transformation_mode == "asymmetric") {
+      if (opset_version < 11 && (transformation_mode == "asymmetric" || transformation_mode == "pytorch_half_pixel")) {
         continue;
       }
       test_case(opset_version, 1.f, 1.f, transformation_mode);
@@ -176,6 +176,43 @@ TEST(NhwcTransformerTests, ConvMaxPoolIndexTensor) {
                     TransformerLevel::Level3);
 }
 
+TEST(NhwcTransformerTests, ConvRoiAlign) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<uint8_t>({2, 16, 17, 17}, 0, 31);
+    auto* conv_output_arg = builder.MakeIntermediate();
+    auto* dequantize_output_arg = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+    auto* conv_weight_arg = NhwcMakeInitializer<uint8_t>(builder, {32, 16, 3, 3});
+    auto* rois_arg = builder.MakeInitializer<float>({3, 4}, {1.f, 2.f, 9.f, 11.f,
+                                                             0.f, 0.f, 14.f, 14.f,
+                                                             4.5f, 3.f, 7.f, 12.5f});
+    auto* batch_indices_arg = builder.MakeInitializer<int64_t>({3}, {0, 1, 1});
+
+    builder.AddQLinearConvNode<uint8_t>(input_arg, .01f, 135,
+                                        conv_weight_arg, .02f, 126,
+                                        conv_output_arg, .37f, 131);
+    builder.AddDequantizeLinearNode<uint8_t>(conv_output_arg, .37f, 131, dequantize_output_arg);
+    Node& roi_align_node = builder.AddNode("RoiAlign", {dequantize_output_arg, rois_arg, batch_indices_arg},
+                                           {output_arg});
+    roi_align_node.AddAttribute("output_height", static_cast<int64_t>(4));
+    roi_align_node.AddAttribute("output_width", static_cast<int64_t>(5));
+    roi_align_node.AddAttribute("sampling_ratio", static_cast<int64_t>(2));
+  };
+
+  auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.microsoft.QLinearConv"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.RoiAlign"], 1);
+    EXPECT_EQ(op_to_count["RoiAlign"], 0);
+    EXPECT_EQ(op_to_count["Transpose"], 2);
+  };
+
+  TransformerTester(build_test_case,
+                    check_nhwc_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3);
+}
+
 TEST(NhwcTransformerTests, ConvGlobalAveragePool) {
   auto build_test_case = [&](ModelTestBuilder& builder) {
     auto* input_arg = builder.MakeInput<uint8_t>({1, 23, 13, 13}, 0, 31);
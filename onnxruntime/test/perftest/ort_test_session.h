@@ -35,8 +35,8 @@ class OnnxRuntimeTestSession : public TestSession {
 
  private:
   Ort::Session session_{nullptr};
-  std::mt19937 rand_engine_;
-  std::uniform_int_distribution<int> dist_;
+  // seeds the per thread engines that pick the inputs of each run
+  const std::random_device::result_type seed_;
   std::vector<std::vector<Ort::Value>> test_inputs_;
   std::vector<std::string> output_names_;
   // The same size with output_names_.
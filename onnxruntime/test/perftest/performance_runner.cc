@@ -121,15 +121,10 @@ Status PerformanceRunner::Run() {
   performance_result_.start = std::chrono::high_resolution_clock::now();
 
   std::unique_ptr<utils::ICPUUsage> p_ICPUUsage = utils::CreateICPUUsage();
-  switch (performance_test_config_.run_config.test_mode) {
-    case TestMode::kFixDurationMode:
-      ORT_RETURN_IF_ERROR(FixDurationTest());
-      break;
-    case TestMode::KFixRepeatedTimesMode:
-      ORT_RETURN_IF_ERROR(RepeatedTimesTest());
-      break;
-    default:
-      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "unknown test mode.");
+  if (performance_test_config_.run_config.f_scaling_test) {
+    ORT_RETURN_IF_ERROR(ScalingTest());
+  } else {
+    ORT_RETURN_IF_ERROR(RunTestMode());
   }
   performance_result_.end = std::chrono::high_resolution_clock::now();
 
@@ -155,6 +150,63 @@ Status PerformanceRunner::Run() {
   return Status::OK();
 }
 
+Status PerformanceRunner::RunTestMode() {
+  switch (performance_test_config_.run_config.test_mode) {
+    case TestMode::kFixDurationMode:
+      return FixDurationTest();
+    case TestMode::KFixRepeatedTimesMode:
+      return RepeatedTimesTest();
+    default:
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "unknown test mode.");
+  }
+}
+
+// Runs the test mode once per concurrency level, doubling it up to concurrent_session_runs, so that
+// contention inside the session shows up as throughput that stops growing with the number of requests.
+Status PerformanceRunner::ScalingTest() {
+  auto& run_config = performance_test_config_.run_config;
+  const size_t max_concurrency = run_config.concurrent_session_runs;
+  double single_throughput = 0;
+
+  for (size_t concurrency = 1;; concurrency = std::min(concurrency * 2, max_concurrency)) {
+    run_config.concurrent_session_runs = concurrency;
+    const size_t first_request = performance_result_.time_costs.size();
+    const double time_cost_before = performance_result_.total_time_cost;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ORT_RETURN_IF_ERROR(RunTestMode());
+    std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+    std::vector<double> latencies(performance_result_.time_costs.begin() + first_request,
+                                  performance_result_.time_costs.end());
+    if (latencies.empty()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "no inference requests completed with ", concurrency,
+                             " concurrent runs.");
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    double throughput = latencies.size() / elapsed.count();
+    if (concurrency == 1) {
+      single_throughput = throughput;
+    }
+    std::cout << "Concurrent runs: " << concurrency
+              << ", inferences per second: " << throughput
+              << ", speedup: " << throughput / single_throughput
+              << ", average latency: "
+              << (performance_result_.total_time_cost - time_cost_before) / latencies.size() * 1000 << " ms"
+              << ", P50 latency: " << latencies[latencies.size() / 2] * 1000 << " ms"
+              << ", P99 latency: " << latencies[static_cast<size_t>(latencies.size() * 0.99)] * 1000 << " ms"
+              << std::endl;
+
+    if (concurrency == max_concurrency) {
+      break;
+    }
+  }
+
+  run_config.concurrent_session_runs = max_concurrency;
+  return Status::OK();
+}
+
 Status PerformanceRunner::FixDurationTest() {
   if (performance_test_config_.run_config.concurrent_session_runs <= 1) {
     return RunFixDuration();
@@ -84,6 +84,8 @@ class PerformanceRunner {
     return Status::OK();
   }
 
+  Status RunTestMode();
+  Status ScalingTest();
   Status FixDurationTest();
   Status RepeatedTimesTest();
   Status ForkJoinRepeat();
@@ -41,6 +41,7 @@ struct RunConfig {
   size_t repeated_times{1000};
   size_t duration_in_seconds{600};
   size_t concurrent_session_runs{1};
+  bool f_scaling_test{false};
   bool f_dump_statistics{false};
   bool f_verbose{false};
   bool enable_memory_pattern{true};
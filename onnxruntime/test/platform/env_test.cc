@@ -3,7 +3,9 @@
 
 #include "core/platform/env.h"
 
+#include <algorithm>
 #include <fstream>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -33,5 +35,28 @@ TEST(PlatformEnvTest, DirectoryCreationAndDeletion) {
   ASSERT_FALSE(env.FolderExists(root_dir));
 }
 
+TEST(PlatformEnvTest, NumaNodeProcessors) {
+  const auto& env = Env::Default();
+  std::vector<size_t> processors;
+  for (const auto& node_processors : env.GetNumaNodeProcessors()) {
+    processors.insert(processors.end(), node_processors.begin(), node_processors.end());
+  }
+
+  // Each logical processor belongs to at most one node
+  std::sort(processors.begin(), processors.end());
+  EXPECT_EQ(std::adjacent_find(processors.begin(), processors.end()), processors.end());
+}
+
+TEST(PlatformEnvTest, SetPreferredNumaNode) {
+  const auto& env = Env::Default();
+  std::vector<char> buffer(1 << 20);
+
+  // A hint only, the memory must stay usable whether or not the node exists
+  env.SetPreferredNumaNode(buffer.data(), buffer.size(), 0);
+  env.SetPreferredNumaNode(buffer.data(), buffer.size(), 1000);
+  std::fill(buffer.begin(), buffer.end(), 'x');
+  EXPECT_EQ(buffer.back(), 'x');
+}
+
 }  // namespace test
 }  // namespace onnxruntime
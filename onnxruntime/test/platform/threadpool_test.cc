@@ -7,8 +7,10 @@
 
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <functional>
+#include <thread>
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -505,6 +507,245 @@ TEST(ThreadPoolTest, TestStagedMultiLoopSections_4Thread_100Loop) {
   TestStagedMultiLoopSections("TestStagedMultiLoopSections_4Thread_100Loop", 4, 100);
 }
 
+TEST(ThreadPoolTest, TestStatsWithoutPool) {
+  ThreadPoolStats stats = ThreadPool::GetStats(nullptr);
+  ASSERT_EQ(stats.spins + stats.steals + stats.parks + stats.wakeups, 0u);
+}
+
+TEST(ThreadPoolTest, TestAdaptiveSpinning) {
+  ThreadOptions to;
+  to.adaptive_spinning = true;
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), to, nullptr, 4, true);
+
+  for (int rep = 0; rep < 20; rep++) {
+    auto test_data = CreateTestData(1000);
+    ThreadPool::TrySimpleParallelFor(tp.get(), 1000, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    ValidateTestData(*test_data);
+
+    // Alternate back to back loops with gaps longer than any adaptive spin
+    if (rep % 4 == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  }
+
+  // The workers must have blocked during the long gaps, and been woken for the next loop
+  ThreadPoolStats stats = ThreadPool::GetStats(tp.get());
+  ASSERT_GT(stats.parks, 0u);
+  ASSERT_GT(stats.wakeups, 0u);
+}
+
+// Runs parallel loops separated by 3ms gaps, which is shorter than the 2^20 iterations of fixed spinning but longer
+// than the longest adaptive spin
+static ThreadPoolStats RunLoopsWithGaps(bool adaptive_spinning, int gaps) {
+  ThreadOptions to;
+  to.adaptive_spinning = adaptive_spinning;
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), to, nullptr, 2, true);
+
+  for (int rep = 0; rep <= gaps; rep++) {
+    auto test_data = CreateTestData(1000);
+    ThreadPool::TrySimpleParallelFor(tp.get(), 1000, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    ValidateTestData(*test_data);
+    if (rep < gaps) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+  }
+
+  return ThreadPool::GetStats(tp.get());
+}
+
+TEST(ThreadPoolTest, TestAdaptiveSpinningParksInGapsThatFixedSpinningSpansAcross) {
+  constexpr int gaps = 20;
+  ThreadPoolStats fixed = RunLoopsWithGaps(false, gaps);
+  ThreadPoolStats adaptive = RunLoopsWithGaps(true, gaps);
+
+  // The adaptive worker blocks in the gaps and has to be woken for the next loop, while the fixed one is still
+  // spinning when the next loop arrives
+  ASSERT_GE(adaptive.parks, static_cast<uint64_t>(gaps) / 2);
+  ASSERT_GE(adaptive.wakeups, static_cast<uint64_t>(gaps) / 2);
+  ASSERT_LT(fixed.parks, adaptive.parks / 2);
+}
+
+TEST(ThreadPoolTest, TestStatsCountWorkersParkedNow) {
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), ThreadOptions{}, nullptr, 3, false);
+
+  // Nothing was scheduled, so the workers block and are never woken, but they are counted as soon as they block
+  ThreadPoolStats stats = ThreadPool::GetStats(tp.get());
+  for (int wait_ms = 0; stats.parks < 2 && wait_ms < 1000; wait_ms++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    stats = ThreadPool::GetStats(tp.get());
+  }
+  ASSERT_EQ(stats.parks, 2u);
+  ASSERT_EQ(stats.wakeups, 0u);
+}
+
+TEST(ThreadPoolTest, TestStatsWithoutSpinning) {
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), ThreadOptions{}, nullptr, 2, false);
+
+  std::atomic<int> ctr{0};
+  for (int rep = 0; rep < 10; rep++) {
+    ThreadPool::Schedule(tp.get(), [&]() { ctr++; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  // Without spinning the worker blocks as soon as its queue is empty
+  ThreadPoolStats stats = ThreadPool::GetStats(tp.get());
+  ASSERT_EQ(stats.spins, 0u);
+  ASSERT_GT(stats.parks, 0u);
+  ASSERT_GT(stats.wakeups, 0u);
+
+  tp.reset();
+  ASSERT_EQ(ctr, 10);
+}
+
+TEST(ThreadPoolTest, TestPriorityScope) {
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), ThreadOptions{}, nullptr, 2, true);
+  ASSERT_EQ(ThreadPool::GetCurrentPriority(), WorkPriority::kNormal);
+
+  std::atomic<int> task_priority{-1};
+  {
+    ThreadPool::PriorityScope high(WorkPriority::kHigh);
+    {
+      ThreadPool::PriorityScope low(WorkPriority::kLow);
+      ASSERT_EQ(ThreadPool::GetCurrentPriority(), WorkPriority::kLow);
+    }
+    ASSERT_EQ(ThreadPool::GetCurrentPriority(), WorkPriority::kHigh);
+
+    // Scheduled tasks run with the priority of the thread scheduling them
+    ThreadPool::Schedule(tp.get(), [&]() { task_priority = static_cast<int>(ThreadPool::GetCurrentPriority()); });
+  }
+  ASSERT_EQ(ThreadPool::GetCurrentPriority(), WorkPriority::kNormal);
+
+  tp.reset();
+  ASSERT_EQ(task_priority, static_cast<int>(WorkPriority::kHigh));
+}
+
+TEST(ThreadPoolTest, TestHighPriorityLoopPreemptsLowPriorityLoop) {
+  constexpr int num_threads = 4;
+  constexpr int low_iterations = 2000;
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), ThreadOptions{}, nullptr, num_threads, true);
+
+  auto low_data = CreateTestData(low_iterations);
+  std::atomic<int> low_iterations_on_workers{0};
+  std::atomic<int> high_iterations_running{0};
+  std::atomic<int> low_iterations_on_workers_during_high{0};
+
+  std::thread low_thread([&]() {
+    ThreadPool::PriorityScope priority(WorkPriority::kLow);
+    const auto low_thread_id = std::this_thread::get_id();
+    ThreadPool::TrySimpleParallelFor(tp.get(), low_iterations, [&](std::ptrdiff_t i) {
+      if (std::this_thread::get_id() != low_thread_id) {
+        low_iterations_on_workers++;
+        if (high_iterations_running > 0) {
+          low_iterations_on_workers_during_high++;
+        }
+      }
+      IncrementElement(*low_data, i);
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    });
+  });
+
+  // Start the high-priority loop once the workers are busy with the low-priority one
+  while (low_iterations_on_workers < 10) {
+    std::this_thread::yield();
+  }
+
+  auto high_data = CreateTestData(8);
+  {
+    ThreadPool::PriorityScope priority(WorkPriority::kHigh);
+    ThreadPool::TrySimpleParallelFor(tp.get(), 8, [&](std::ptrdiff_t i) {
+      high_iterations_running++;
+      IncrementElement(*high_data, i);
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      high_iterations_running--;
+    });
+  }
+  low_thread.join();
+
+  ValidateTestData(*high_data);
+  ValidateTestData(*low_data);
+
+  // Each worker finishes at most the iteration it claimed before the high-priority loop started
+  ASSERT_LE(low_iterations_on_workers_during_high, num_threads - 1);
+}
+
+TEST(ThreadPoolTest, TestLowPriorityLoopGetsWorkersBackAfterHighPriorityLoop) {
+  constexpr int low_iterations = 2000;
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), ThreadOptions{}, nullptr, 4, true);
+
+  auto low_data = CreateTestData(low_iterations);
+  std::atomic<int> low_iterations_on_workers{0};
+  std::atomic<bool> high_done{false};
+  std::atomic<int> low_iterations_on_workers_after_high{0};
+
+  std::thread low_thread([&]() {
+    ThreadPool::PriorityScope priority(WorkPriority::kLow);
+    const auto low_thread_id = std::this_thread::get_id();
+    ThreadPool::TrySimpleParallelFor(tp.get(), low_iterations, [&](std::ptrdiff_t i) {
+      if (std::this_thread::get_id() != low_thread_id) {
+        low_iterations_on_workers++;
+        if (high_done) {
+          low_iterations_on_workers_after_high++;
+        }
+      }
+      IncrementElement(*low_data, i);
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    });
+  });
+
+  while (low_iterations_on_workers < 10) {
+    std::this_thread::yield();
+  }
+
+  auto high_data = CreateTestData(8);
+  {
+    ThreadPool::PriorityScope priority(WorkPriority::kHigh);
+    ThreadPool::TrySimpleParallelFor(tp.get(), 8, [&](std::ptrdiff_t i) {
+      IncrementElement(*high_data, i);
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+  }
+  high_done = true;
+  low_thread.join();
+
+  ValidateTestData(*high_data);
+  ValidateTestData(*low_data);
+
+  // The workers that left for the high-priority loop help the low-priority loop again once it is done
+  ASSERT_GT(low_iterations_on_workers_after_high, 0);
+}
+
+#ifndef ORT_NO_EXCEPTIONS
+TEST(ThreadPoolTest, TestThrowingHighPriorityLoopDoesNotBlockLowPriorityLoops) {
+  auto tp = std::make_unique<ThreadPool>(&onnxruntime::Env::Default(), ThreadOptions{}, nullptr, 4, true);
+  const auto main_thread_id = std::this_thread::get_id();
+
+  {
+    ThreadPool::PriorityScope priority(WorkPriority::kHigh);
+    ASSERT_THROW(ThreadPool::TrySimpleParallelFor(tp.get(), 100, [&](std::ptrdiff_t) {
+                   if (std::this_thread::get_id() == main_thread_id) {
+                     throw std::runtime_error("high-priority loop failed");
+                   }
+                   std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                 }),
+                 std::runtime_error);
+  }
+
+  // The failed loop no longer counts as running, so the workers still help low-priority loops
+  ThreadPool::PriorityScope priority(WorkPriority::kLow);
+  std::atomic<int> low_iterations_on_workers{0};
+  auto low_data = CreateTestData(100);
+  ThreadPool::TrySimpleParallelFor(tp.get(), 100, [&](std::ptrdiff_t i) {
+    if (std::this_thread::get_id() != main_thread_id) {
+      low_iterations_on_workers++;
+    }
+    IncrementElement(*low_data, i);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  });
+  ValidateTestData(*low_data);
+  ASSERT_GT(low_iterations_on_workers, 0);
+}
+#endif
+
 #ifdef _WIN32
 #if WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP)
 #pragma warning(push)
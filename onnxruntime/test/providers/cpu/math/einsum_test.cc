@@ -540,6 +540,42 @@ TEST(Einsum, ImplicitEinsumAsTensorContraction) {
   test.Run();
 }
 
+// Theme: Contraction order
+
+// The last two inputs are cheaper to contract first ((4x3) * ((3x3) * (3x1)))
+TEST(Einsum, ExplicitEinsumAsMatmulChain_ContractRightPairFirst) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ij,jk,kl->il");
+  test.AddInput<float>("x", {4, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f});
+  test.AddInput<float>("y", {3, 3}, {1.f, 2.f, 3.f, 0.f, 1.f, 2.f, 3.f, 0.f, 1.f});
+  test.AddInput<float>("z", {3, 1}, {1.f, 2.f, 3.f});
+  test.AddOutput<float>("o", {4, 1}, {48.f, 132.f, 216.f, 300.f});
+  test.Run();
+}
+
+// The first two inputs share no label - contracting them first would produce an outer product
+TEST(Einsum, ExplicitEinsumAsMatmulChain_ContractNonAdjacentInputs) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ab,cd,bc,de->ae");
+  test.AddInput<float>("x", {2, 3}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f});
+  test.AddInput<float>("y", {4, 2}, {1.f, 2.f, 0.f, 1.f, 2.f, 0.f, 1.f, 2.f});
+  test.AddInput<float>("z", {3, 4}, {1.f, 2.f, 3.f, 4.f, 0.f, 1.f, 2.f, 3.f, 4.f, 0.f, 1.f, 2.f});
+  test.AddInput<float>("w", {2, 1}, {1.f, -1.f});
+  test.AddOutput<float>("o", {2, 1}, {-13.f, -28.f});
+  test.Run();
+}
+
+TEST(Einsum, ExplicitEinsumAsMatmulChain_ContractNonAdjacentInputs_double) {
+  OpTester test("Einsum", 12, onnxruntime::kOnnxDomain);
+  test.AddAttribute<std::string>("equation", "ab,cd,bc,de->ae");
+  test.AddInput<double>("x", {2, 3}, {1., 2., 3., 4., 5., 6.});
+  test.AddInput<double>("y", {4, 2}, {1., 2., 0., 1., 2., 0., 1., 2.});
+  test.AddInput<double>("z", {3, 4}, {1., 2., 3., 4., 0., 1., 2., 3., 4., 0., 1., 2.});
+  test.AddInput<double>("w", {2, 1}, {1., -1.});
+  test.AddOutput<double>("o", {2, 1}, {-13., -28.});
+  test.Run();
+}
+
 // Theme: Half support
 
 TEST(Einsum, ExplicitEinsumAsIdentity_1D_input_Half) {
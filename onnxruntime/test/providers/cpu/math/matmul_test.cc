@@ -163,6 +163,31 @@ TEST(MathOpTest, MatMulUint64Type) {
   RunMatMulTest<uint64_t>(9);
 }
 
+TEST(MathOpTest, MatMulSparseInitializer) {
+  OpTester test("MatMul", 13);
+
+  std::vector<float> a_values(24);
+  for (size_t i = 0; i < a_values.size(); ++i) {
+    a_values[i] = static_cast<float>(i) - 8.0f;
+  }
+  test.AddInput<float>("A", {2, 3, 4}, a_values);
+  // 16 of the 20 elements are zero so the CPU kernel multiplies with the sparse representation of B
+  test.AddInput<float>("B", {4, 5},
+                       {0.0f, 2.0f, 0.0f, 0.0f, 0.0f,
+                        1.5f, 0.0f, 0.0f, 0.0f, 0.0f,
+                        0.0f, -1.0f, 0.0f, 0.0f, 0.0f,
+                        0.0f, 0.0f, 0.0f, 0.0f, 0.5f},
+                       true);
+  test.AddOutput<float>("Y", {2, 3, 5},
+                        {-10.5f, -10.0f, 0.0f, 0.0f, -2.5f,
+                         -4.5f, -6.0f, 0.0f, 0.0f, -0.5f,
+                         1.5f, -2.0f, 0.0f, 0.0f, 1.5f,
+                         7.5f, 2.0f, 0.0f, 0.0f, 3.5f,
+                         13.5f, 6.0f, 0.0f, 0.0f, 5.5f,
+                         19.5f, 10.0f, 0.0f, 0.0f, 7.5f});
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
 #if defined(USE_CUDA) || defined(USE_ROCM)
 TEST(MathOpTest, MatMul_Float16) {
 #ifdef USE_CUDA
@@ -861,5 +861,38 @@ TEST(TopKOperator, SelectTopKThreaded) {
   TestThreaded<double>(k, n, batch_size);
 }
 
+// create input of 1x100000 so the single row is split across threads. the values repeat every 20000 elements so
+// the ties for the top k are spread across segments, and the lowest indices must be selected when merging.
+template <typename T>
+static void TestSplitAxisThreaded(int64_t largest) {
+  constexpr int64_t k = 3;
+  constexpr int64_t n = 100000;
+  constexpr int64_t period = 20000;
+  std::vector<T> input_vals(n);
+  for (int64_t i = 0; i < n; ++i) {
+    input_vals[i] = static_cast<T>(i % period);
+  }
+
+  std::vector<T> expected_vals;
+  std::vector<int64_t> expected_indices;
+  if (largest == 1) {
+    expected_vals = {static_cast<T>(period - 1), static_cast<T>(period - 1), static_cast<T>(period - 1)};
+    expected_indices = {period - 1, 2 * period - 1, 3 * period - 1};
+  } else {
+    expected_vals = {0, 0, 0};
+    expected_indices = {0, period, 2 * period};
+  }
+
+  RunTest(11, k, input_vals, {1, n}, expected_vals, expected_indices, {1, k}, false, -1, largest);
+  RunTest(11, k, input_vals, {1, n}, expected_vals, expected_indices, {1, k}, false, -1, largest, 0);  // unsorted
+}
+
+TEST(TopKOperator, SplitAxisThreaded) {
+  TestSplitAxisThreaded<float>(1);
+  TestSplitAxisThreaded<float>(0);
+  TestSplitAxisThreaded<double>(1);
+  TestSplitAxisThreaded<int64_t>(0);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
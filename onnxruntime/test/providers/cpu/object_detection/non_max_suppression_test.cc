@@ -1,6 +1,10 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -383,5 +387,111 @@ TEST(NonMaxSuppressionOpTest, WithIOUThresholdOpset11) {
   test.Run();
 }
 
+// Straightforward NMS used as the reference for the large inputs below.
+static std::vector<int64_t> ReferenceNonMaxSuppression(const std::vector<float>& boxes,
+                                                       const std::vector<float>& scores,
+                                                       int64_t num_batches, int64_t num_classes, int64_t num_boxes,
+                                                       int64_t max_output_boxes_per_class,
+                                                       float iou_threshold, float score_threshold) {
+  auto iou = [](const float* a, const float* b) {
+    const float a_y_min = std::min(a[0], a[2]), a_y_max = std::max(a[0], a[2]);
+    const float a_x_min = std::min(a[1], a[3]), a_x_max = std::max(a[1], a[3]);
+    const float b_y_min = std::min(b[0], b[2]), b_y_max = std::max(b[0], b[2]);
+    const float b_x_min = std::min(b[1], b[3]), b_x_max = std::max(b[1], b[3]);
+    const float w = std::min(a_x_max, b_x_max) - std::max(a_x_min, b_x_min);
+    const float h = std::min(a_y_max, b_y_max) - std::max(a_y_min, b_y_min);
+    if (w <= 0.f || h <= 0.f) {
+      return 0.f;
+    }
+    const float intersection = w * h;
+    const float a_area = (a_x_max - a_x_min) * (a_y_max - a_y_min);
+    const float b_area = (b_x_max - b_x_min) * (b_y_max - b_y_min);
+    return intersection / (a_area + b_area - intersection);
+  };
+
+  std::vector<int64_t> result;
+  for (int64_t b = 0; b < num_batches; ++b) {
+    const float* batch_boxes = boxes.data() + b * num_boxes * 4;
+    for (int64_t c = 0; c < num_classes; ++c) {
+      const float* class_scores = scores.data() + (b * num_classes + c) * num_boxes;
+      std::vector<int64_t> order;
+      for (int64_t i = 0; i < num_boxes; ++i) {
+        if (class_scores[i] > score_threshold) {
+          order.push_back(i);
+        }
+      }
+      std::stable_sort(order.begin(), order.end(),
+                       [class_scores](int64_t l, int64_t r) { return class_scores[l] > class_scores[r]; });
+
+      std::vector<int64_t> selected;
+      for (int64_t i : order) {
+        if (static_cast<int64_t>(selected.size()) == max_output_boxes_per_class) {
+          break;
+        }
+        bool keep = std::none_of(selected.begin(), selected.end(), [&](int64_t s) {
+          return iou(batch_boxes + i * 4, batch_boxes + s * 4) > iou_threshold;
+        });
+        if (keep) {
+          selected.push_back(i);
+          result.insert(result.end(), {b, c, i});
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+TEST(NonMaxSuppressionOpTest, ManyBoxesMultipleBatchesAndClasses) {
+  // enough boxes to use the spatial grid when checking the IoU with the selected boxes
+  constexpr int64_t num_batches = 2;
+  constexpr int64_t num_classes = 3;
+  constexpr int64_t num_boxes = 2000;
+  constexpr int64_t max_output_boxes_per_class = 1500;
+  constexpr float iou_threshold = 0.4f;
+  constexpr float score_threshold = 0.1f;
+
+  std::default_random_engine generator(1234);
+  std::uniform_real_distribution<float> position(0.f, 100.f);
+  std::uniform_real_distribution<float> size(0.5f, 8.f);
+  std::uniform_real_distribution<float> score(0.f, 1.f);
+
+  std::vector<float> boxes(num_batches * num_boxes * 4);
+  for (int64_t i = 0; i < num_batches * num_boxes; ++i) {
+    const float y = position(generator), x = position(generator);
+    const float h = size(generator), w = size(generator);
+    // flip the corners of some boxes
+    if (i % 7 == 0) {
+      boxes[i * 4 + 0] = y + h;
+      boxes[i * 4 + 1] = x + w;
+      boxes[i * 4 + 2] = y;
+      boxes[i * 4 + 3] = x;
+    } else {
+      boxes[i * 4 + 0] = y;
+      boxes[i * 4 + 1] = x;
+      boxes[i * 4 + 2] = y + h;
+      boxes[i * 4 + 3] = x + w;
+    }
+  }
+
+  std::vector<float> scores(num_batches * num_classes * num_boxes);
+  for (auto& s : scores) {
+    // quantize so there are plenty of ties that need to be broken by box index
+    s = std::round(score(generator) * 64.f) / 64.f;
+  }
+
+  auto expected = ReferenceNonMaxSuppression(boxes, scores, num_batches, num_classes, num_boxes,
+                                             max_output_boxes_per_class, iou_threshold, score_threshold);
+
+  OpTester test("NonMaxSuppression", 11, kOnnxDomain);
+  test.AddInput<float>("boxes", {num_batches, num_boxes, 4}, boxes);
+  test.AddInput<float>("scores", {num_batches, num_classes, num_boxes}, scores);
+  test.AddInput<int64_t>("max_output_boxes_per_class", {}, {max_output_boxes_per_class});
+  test.AddInput<float>("iou_threshold", {}, {iou_threshold});
+  test.AddInput<float>("score_threshold", {}, {score_threshold});
+  test.AddOutput<int64_t>("selected_indices", {static_cast<int64_t>(expected.size() / 3), 3}, expected);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
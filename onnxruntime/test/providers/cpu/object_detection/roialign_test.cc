@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -350,5 +352,82 @@ TEST(RoiAlignTest, MismatchNumRois) {
 
   test.Run(OpTester::ExpectResult::kExpectFailure, "[ShapeInferenceError] Dimension mismatch in unification between 4 and 5");
 }
+#ifndef DISABLE_CONTRIB_OPS
+// The com.microsoft RoiAlign inserted by the layout transformers consumes and produces NHWC tensors when
+// channels_last is set.
+static void ChannelsLastTest(const std::string& mode, const std::vector<float>& expected_nchw) {
+  OpTester test("RoiAlign", 1, kMSDomain);
+  test.AddAttribute<std::string>("mode", mode);
+  test.AddAttribute<int64_t>("output_height", 3);
+  test.AddAttribute<int64_t>("output_width", 4);
+  test.AddAttribute<int64_t>("sampling_ratio", 2);
+  test.AddAttribute<float>("spatial_scale", 1.0f / 16.0f);
+  test.AddAttribute<int64_t>("channels_last", 1);
+
+  constexpr int64_t N = 1;
+  constexpr int64_t C = 3;
+  constexpr int64_t H = 5;
+  constexpr int64_t W = 5;
+  constexpr int64_t num_rois = 5;
+  constexpr int64_t output_height = 3;
+  constexpr int64_t output_width = 4;
+
+  auto to_nhwc = [](const std::vector<float>& nchw, int64_t n, int64_t c, int64_t hw) {
+    std::vector<float> nhwc(nchw.size());
+    for (int64_t i = 0; i < n; ++i) {
+      for (int64_t j = 0; j < c; ++j) {
+        for (int64_t k = 0; k < hw; ++k) {
+          nhwc[(i * hw + k) * c + j] = nchw[(i * c + j) * hw + k];
+        }
+      }
+    }
+    return nhwc;
+  };
+
+  std::vector<float> X(N * C * H * W);
+  std::iota(X.begin(), X.end(), 0.f);
+
+  test.AddInput<float>("X", {N, H, W, C}, to_nhwc(X, N, C, H * W));
+  test.AddInput<float>("rois", {num_rois, 4}, {7.,5.,7.,5.,-15.,-15.,-15.,-15.,-10.,21.,-10.,21.,13.,8.,13.,8.,-14.,19.,-14.,19.});
+  test.AddInput<int64_t>("batch_indices", {num_rois}, {0, 0, 0, 0, 0});
+  test.AddOutput<float>("Y", {num_rois, output_height, output_width, C},
+                        to_nhwc(expected_nchw, num_rois, C, output_height * output_width));
+
+  test.Run();
+}
+
+TEST(RoiAlignTest, ChannelsLast) {
+  ChannelsLastTest("avg", {
+      2.95833f,3.20833f,3.45833f,3.70833f,4.625f,4.875f,5.125f,5.375f,6.29167f,6.54167f,6.79167f,7.04167f,27.9583f,
+      28.2083f,28.4583f,28.7083f,29.625f,29.875f,30.125f,30.375f,31.2917f,31.5417f,31.7917f,32.0417f,52.9583f,
+      53.2083f,53.4583f,53.7083f,54.625f,54.875f,55.125f,55.375f,56.2917f,56.5417f,56.7917f,57.0417f,0.f,0.f,0.f,
+      0.f,0.f,0.f,0.f,0.f,0.f,0.f,0.f,0.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,50.f,50.f,
+      50.f,50.f,50.f,50.f,50.f,50.f,50.f,50.f,50.f,50.f,7.39583f,7.39583f,7.42708f,7.64583f,9.0625f,9.0625f,
+      9.09375f,9.3125f,10.7292f,10.7292f,10.7604f,10.9792f,32.3958f,32.3958f,32.4271f,32.6458f,34.0625f,34.0625f,
+      34.0938f,34.3125f,35.7292f,35.7292f,35.7604f,35.9792f,57.3958f,57.3958f,57.4271f,57.6458f,59.0625f,59.0625f,
+      59.0938f,59.3125f,60.7292f,60.7292f,60.7604f,60.9792f,4.27083f,4.52083f,4.77083f,5.02083f,5.9375f,6.1875f,
+      6.4375f,6.6875f,7.60417f,7.85417f,8.10417f,8.35417f,29.2708f,29.5208f,29.7708f,30.0208f,30.9375f,31.1875f,
+      31.4375f,31.6875f,32.6042f,32.8542f,33.1042f,33.3542f,54.2708f,54.5208f,54.7708f,55.0208f,55.9375f,56.1875f,
+      56.4375f,56.6875f,57.6042f,57.8542f,58.1042f,58.3542f,6.77083f,6.77083f,6.77083f,6.80208f,8.4375f,8.4375f,
+      8.4375f,8.46875f,10.1042f,10.1042f,10.1042f,10.1354f,31.7708f,31.7708f,31.7708f,31.8021f,33.4375f,33.4375f,
+      33.4375f,33.4688f,35.1042f,35.1042f,35.1042f,35.1354f,56.7708f,56.7708f,56.7708f,56.8021f,58.4375f,58.4375f,
+      58.4375f,58.4688f,60.1042f,60.1042f,60.1042f,60.1354f});
+  ChannelsLastTest("max", {
+      2.10938f,2.95313f,3.375f,2.53125f,3.35938f,4.70313f,5.375f,4.03125f,3.51563f,4.92188f,5.625f,4.21875f,
+      10.8984f,15.2578f,17.4375f,13.0781f,17.3568f,24.2995f,27.7708f,20.8281f,18.1641f,25.4297f,29.0625f,21.7969f,
+      19.6875f,27.5625f,31.5f,23.625f,31.3542f,43.8958f,50.1667f,37.625f,32.8125f,45.9375f,52.5f,39.375f,0.f,0.f,
+      0.f,0.f,0.f,0.f,0.f,0.f,0.f,0.f,0.f,0.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,25.f,50.f,50.f,
+      50.f,50.f,50.f,50.f,50.f,50.f,50.f,50.f,50.f,50.f,5.625f,5.625f,5.625f,4.57031f,8.95833f,8.95833f,8.95833f,
+      7.27865f,9.375f,9.375f,9.375f,7.61719f,19.6875f,19.6875f,19.6875f,15.9961f,31.3542f,31.3542f,31.3542f,
+      25.4753f,32.8125f,32.8125f,32.8125f,26.6602f,33.75f,33.75f,33.75f,27.4219f,53.75f,53.75f,53.75f,43.6719f,
+      56.25f,56.25f,56.25f,45.7031f,4.5f,3.9375f,2.8125f,3.9375f,5.5f,4.8125f,3.4375f,4.8125f,4.58333f,4.01042f,
+      2.86458f,3.9375f,23.25f,20.3438f,14.5313f,18.f,28.4167f,24.86458f,17.76042f,22.f,23.25f,20.3437f,14.5312f,
+      18.f,42.f,36.75f,26.25f,32.0625f,51.3333f,44.9167f,32.08333f,39.1875f,42.f,36.75f,26.25f,32.0625f,4.375f,
+      4.375f,4.375f,4.375f,7.70833f,7.70833f,7.70833f,7.70833f,9.375f,9.375f,9.375f,9.375f,21.875f,21.875f,21.875f,
+      21.875f,26.9792f,26.9792f,26.9792f,26.9792f,32.8125f,32.8125f,32.8125f,32.8125f,40.1042f,40.1042f,40.1042f,
+      40.1042f,46.25f,46.25f,46.25f,46.25f,56.25f,56.25f,56.25f,56.25f});
+}
+#endif  // DISABLE_CONTRIB_OPS
+
 }  // namespace test
 }  // namespace onnxruntime
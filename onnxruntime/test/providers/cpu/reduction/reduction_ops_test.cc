@@ -733,6 +733,23 @@ TEST(ReductionOpTest, ReduceMax) {
   test.Run();
 }
 
+// A row of -inf, e.g. a fully masked attention row, reduces to -inf rather than the lowest finite value
+TEST(ReductionOpTest, ReduceMax_all_negative_infinity) {
+  for (int64_t axis : {0, 1}) {
+    OpTester test("ReduceMax");
+    test.AddAttribute("axes", std::vector<int64_t>{axis});
+    test.AddAttribute("keepdims", (int64_t)0);
+    test.AddInput<float>("data", {5, 5},
+                         {FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF,
+                          FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF,
+                          FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF,
+                          FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF,
+                          FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, 1.0f});
+    test.AddOutput<float>("reduced", {5}, {FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, FLOAT_NINF, 1.0f});
+    test.Run();
+  }
+}
+
 TEST(ReductionOpTest, ReduceMax_double) {
   OpTester test("ReduceMax");
   test.AddAttribute("axes", std::vector<int64_t>{1, 2});
@@ -1234,6 +1251,23 @@ TEST(ReductionOpTest, ReduceMin) {
   test.Run();
 }
 
+// A row of +inf reduces to +inf rather than the largest finite value
+TEST(ReductionOpTest, ReduceMin_all_positive_infinity) {
+  for (int64_t axis : {0, 1}) {
+    OpTester test("ReduceMin");
+    test.AddAttribute("axes", std::vector<int64_t>{axis});
+    test.AddAttribute("keepdims", (int64_t)0);
+    test.AddInput<float>("data", {5, 5},
+                         {FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF,
+                          FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF,
+                          FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF,
+                          FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF,
+                          FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF, -1.0f});
+    test.AddOutput<float>("reduced", {5}, {FLOAT_INF, FLOAT_INF, FLOAT_INF, FLOAT_INF, -1.0f});
+    test.Run();
+  }
+}
+
 TEST(ReductionOpTest, ReduceMin_double) {
   OpTester test("ReduceMin");
   test.AddAttribute("axes", std::vector<int64_t>{0, 2});
@@ -4512,5 +4546,76 @@ TEST(ReductionOpTest, ReduceSum_RKRK_keepdims) {
   test.Run();
 }
 
+// Reduces non-adjacent and strided axes of a float tensor whose rows are long enough to go through the
+// vectorized row and column kernels, and checks every float reduction against a double precision reference.
+// The inputs are multiples of 1/16 so the sums are exact in float.
+TEST(ReductionOpTest, ReduceFloat_MultipleAxes) {
+  const std::vector<int64_t> input_dims{3, 5, 4, 37};
+  std::vector<float> input(3 * 5 * 4 * 37);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<float>(static_cast<int>((i * 7919) % 97) - 48) / 16.0f;
+  }
+
+  const std::vector<std::vector<int64_t>> axes_list{{0, 2}, {1, 3}, {0, 1, 3}, {0, 3}, {1, 2}, {2}};
+  const std::vector<std::string> ops{"ReduceSum", "ReduceSumSquare", "ReduceMean", "ReduceL2",
+                                     "ReduceMax", "ReduceMin", "ReduceLogSumExp"};
+
+  for (const auto& axes : axes_list) {
+    std::vector<int64_t> expected_dims(input_dims);
+    for (auto axis : axes) {
+      expected_dims[axis] = 1;
+    }
+    const int64_t output_size = expected_dims[0] * expected_dims[1] * expected_dims[2] * expected_dims[3];
+
+    for (const auto& op : ops) {
+      std::vector<std::vector<double>> groups(static_cast<size_t>(output_size));
+      for (int64_t a = 0; a < input_dims[0]; ++a) {
+        for (int64_t b = 0; b < input_dims[1]; ++b) {
+          for (int64_t c = 0; c < input_dims[2]; ++c) {
+            for (int64_t d = 0; d < input_dims[3]; ++d) {
+              const int64_t index[4] = {a, b, c, d};
+              int64_t out = 0;
+              for (size_t k = 0; k < 4; ++k) {
+                out = out * expected_dims[k] + (expected_dims[k] == 1 ? 0 : index[k]);
+              }
+              groups[out].push_back(input[((a * input_dims[1] + b) * input_dims[2] + c) * input_dims[3] + d]);
+            }
+          }
+        }
+      }
+
+      std::vector<float> expected;
+      for (const auto& group : groups) {
+        double sum = 0.0, sum_square = 0.0, sum_exp = 0.0;
+        double max = group[0], min = group[0];
+        for (double v : group) {
+          sum += v;
+          sum_square += v * v;
+          max = std::max(max, v);
+          min = std::min(min, v);
+        }
+        for (double v : group) {
+          sum_exp += std::exp(v - max);
+        }
+        double result = op == "ReduceSum"         ? sum
+                        : op == "ReduceSumSquare" ? sum_square
+                        : op == "ReduceMean"      ? sum / group.size()
+                        : op == "ReduceL2"        ? std::sqrt(sum_square)
+                        : op == "ReduceMax"       ? max
+                        : op == "ReduceMin"       ? min
+                                                  : std::log(sum_exp) + max;
+        expected.push_back(static_cast<float>(result));
+      }
+
+      OpTester test(op.c_str(), 11);
+      test.AddAttribute("axes", axes);
+      test.AddAttribute("keepdims", static_cast<int64_t>(1));
+      test.AddInput<float>("data", input_dims, input);
+      test.AddOutput<float>("reduced", expected_dims, expected);
+      test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
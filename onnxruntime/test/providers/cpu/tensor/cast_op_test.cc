@@ -13,6 +13,7 @@
 
 #include "test/common/cuda_op_test_utils.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -184,5 +185,59 @@ TEST(CastOpTest, ToString) {
   TestCastOp(gsl::make_span(int_16_input), gsl::make_span(int_string_data), shape);
 }
 
+// The CPU EP truncates towards zero and saturates when casting float to 8-bit integers.
+// Other EPs don't define the out of range behavior so only the CPU EP is run.
+TEST(CastOpTest, FloatToInt8Saturates) {
+  const std::vector<int64_t> shape{10};
+  const std::vector<float> input = {-1e10f, -300.f, -128.5f, -1.9f, -0.5f, 0.5f, 1.9f, 127.9f, 300.f, 1e10f};
+
+  auto run_test = [&](auto expected) {
+    using DstType = typename decltype(expected)::value_type;
+    OpTester test("Cast", 13);
+    test.AddAttribute<int64_t>("to", utils::ToTensorProtoElementType<DstType>());
+    test.AddInput<float>("input", shape, input);
+    test.AddOutput<DstType>("output", shape, expected);
+
+    std::vector<std::unique_ptr<IExecutionProvider>> eps;
+    eps.push_back(DefaultCpuExecutionProvider());
+    test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &eps);
+  };
+
+  run_test(std::vector<int8_t>{-128, -128, -128, -1, 0, 0, 1, 127, 127, 127});
+  run_test(std::vector<uint8_t>{0, 0, 0, 0, 0, 0, 1, 127, 255, 255});
+}
+
+// Large enough to be split across the thread pool, covering the MLAS conversions and the generic path.
+TEST(CastOpTest, LargeTensor) {
+  const std::vector<int64_t> shape{3, 257, 131};
+  const size_t size = static_cast<size_t>(3 * 257 * 131);
+
+  // values are exactly representable in every type below
+  const std::vector<float> float_values = [size]() {
+    std::vector<float> values(size);
+    for (size_t i = 0; i < size; ++i) {
+      values[i] = static_cast<float>(static_cast<int>(i % 255) - 127);
+    }
+    return values;
+  }();
+
+  const auto float_span = gsl::make_span(float_values);
+  TestCastOp(float_span, gsl::make_span(CastedValues<float, MLFloat16>(float_span)), shape);
+  TestCastOp(float_span, gsl::make_span(CastedValues<float, BFloat16>(float_span)), shape);
+  TestCastOp(float_span, gsl::make_span(CastedValues<float, int32_t>(float_span)), shape);
+  TestCastOp(float_span, gsl::make_span(CastedValues<float, int8_t>(float_span)), shape);
+  TestCastOp(float_span, gsl::make_span(CastedValues<float, double>(float_span)), shape);
+
+  const auto float16_values = CastedValues<float, MLFloat16>(float_span);
+  TestCastOp(gsl::make_span(float16_values), float_span, shape);
+  TestCastOp(gsl::make_span(float16_values), gsl::make_span(CastedValues<float, int64_t>(float_span)), shape);
+
+  const auto bfloat16_values = CastedValues<float, BFloat16>(float_span);
+  TestCastOp(gsl::make_span(bfloat16_values), float_span, shape);
+
+  const auto int32_values = CastedValues<float, int32_t>(float_span);
+  TestCastOp(gsl::make_span(int32_values), float_span, shape);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
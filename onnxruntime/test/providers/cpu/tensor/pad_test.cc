@@ -807,5 +807,37 @@ TEST(PadOpTest, BoolType) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
 }
 
+// Large enough for the constant-mode interior copy and border fill to be split across threads,
+// with positive and negative pads mixed on the same axes.
+TEST(PadOpTest, Pad_Constant_3D_Large_Mixed_Pads) {
+  const std::vector<int64_t> input_dims = {6, 37, 129};
+  const std::vector<int64_t> pads = {2, -3, 5, -1, 4, -7};
+  std::vector<int64_t> output_dims(3);
+  for (size_t i = 0; i < 3; ++i) {
+    output_dims[i] = input_dims[i] + pads[i] + pads[i + 3];
+  }
+
+  std::vector<float> input(static_cast<size_t>(input_dims[0] * input_dims[1] * input_dims[2]));
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<float>(i % 1000);
+  }
+
+  const float value = -1.5f;
+  std::vector<float> output;
+  output.reserve(static_cast<size_t>(output_dims[0] * output_dims[1] * output_dims[2]));
+  for (int64_t i0 = 0; i0 < output_dims[0]; ++i0) {
+    for (int64_t i1 = 0; i1 < output_dims[1]; ++i1) {
+      for (int64_t i2 = 0; i2 < output_dims[2]; ++i2) {
+        const int64_t s0 = i0 - pads[0], s1 = i1 - pads[1], s2 = i2 - pads[2];
+        const bool inside = s0 >= 0 && s0 < input_dims[0] && s1 >= 0 && s1 < input_dims[1] &&
+                            s2 >= 0 && s2 < input_dims[2];
+        output.push_back(inside ? input[static_cast<size_t>((s0 * input_dims[1] + s1) * input_dims[2] + s2)] : value);
+      }
+    }
+  }
+
+  RunAllOpsetAllDomainPadTests<float>(input_dims, input, pads, value, output_dims, output);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
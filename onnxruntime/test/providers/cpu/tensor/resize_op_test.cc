@@ -4,6 +4,7 @@
 #include "core/providers/cpu/tensor/resize.h"
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -254,6 +255,66 @@ TEST(ResizeOpTest, ResizeOpLinearUpSampleTest_4DBilinear_asymmetric) {
   run_test(true);
 }
 
+TEST(ResizeOpTest, ResizeOpLinearUpSampleTest_4DBilinear_asymmetric_Nhwc) {
+  // Same images as ResizeOpLinearUpSampleTest_4DBilinear_asymmetric, stored as the 2 channels of an NHWC tensor
+  OpTester test("Resize", 13);
+  std::vector<float> roi{};
+  std::vector<float> scales{1.0f, 2.0f, 4.0f, 1.0f};
+
+  test.AddAttribute("mode", "linear");
+  test.AddAttribute("coordinate_transformation_mode", "asymmetric");
+
+  constexpr int64_t N = 1, H = 2, W = 2, C = 2;
+  std::vector<float> X = {1.0f, 6.0f, 3.0f, 2.0f,
+                          4.0f, 7.0f, 8.0f, 11.0f};
+
+  test.AddInput<float>("X", {N, H, W, C}, X);
+  test.AddInput<float>("roi", {0}, roi);
+  test.AddInput<float>("scales", {4}, scales, true);
+
+  std::vector<float> Y = {
+      1.0f, 6.0f, 1.5f, 5.0f, 2.0f, 4.0f, 2.5f, 3.0f, 3.0f, 2.0f, 3.0f, 2.0f, 3.0f, 2.0f, 3.0f, 2.0f,
+      2.5f, 6.5f, 3.25f, 6.5f, 4.0f, 6.5f, 4.75f, 6.5f, 5.5f, 6.5f, 5.5f, 6.5f, 5.5f, 6.5f, 5.5f, 6.5f,
+      4.0f, 7.0f, 5.0f, 8.0f, 6.0f, 9.0f, 7.0f, 10.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f,
+      4.0f, 7.0f, 5.0f, 8.0f, 6.0f, 9.0f, 7.0f, 10.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f, 8.0f, 11.0f};
+
+  test.AddOutput<float>("Y", {N, static_cast<int64_t>(H * scales[1]), static_cast<int64_t>(W * scales[2]), C}, Y);
+  // The NHWC layout is only implemented by the CPU kernel
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(ResizeOpTest, ResizeOpLinearUpSampleTest_4DBilinear_asymmetric_Nhwc_uint8) {
+  OpTester test("Resize", 13);
+  std::vector<float> roi{};
+  std::vector<float> scales{1.0f, 2.0f, 4.0f, 1.0f};
+
+  test.AddAttribute("mode", "linear");
+  test.AddAttribute("coordinate_transformation_mode", "asymmetric");
+
+  constexpr int64_t N = 1, H = 2, W = 2, C = 2;
+  std::vector<uint8_t> X = {1, 6, 3, 2,
+                            4, 7, 8, 11};
+
+  test.AddInput<uint8_t>("X", {N, H, W, C}, X);
+  test.AddInput<float>("roi", {0}, roi);
+  test.AddInput<float>("scales", {4}, scales, true);
+
+  // The interpolated values are truncated
+  std::vector<uint8_t> Y = {
+      1, 6, 1, 5, 2, 4, 2, 3, 3, 2, 3, 2, 3, 2, 3, 2,
+      2, 6, 3, 6, 4, 6, 4, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+      4, 7, 5, 8, 6, 9, 7, 10, 8, 11, 8, 11, 8, 11, 8, 11,
+      4, 7, 5, 8, 6, 9, 7, 10, 8, 11, 8, 11, 8, 11, 8, 11};
+
+  test.AddOutput<uint8_t>("Y", {N, static_cast<int64_t>(H * scales[1]), static_cast<int64_t>(W * scales[2]), C}, Y);
+  // The NHWC layout is only implemented by the CPU kernel
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
 TEST(ResizeOpTest, ResizeOpLinearUpSampleTest_2DBilinear_align_corners) {
   OpTester test("Resize", 13);
   std::vector<float> roi{};
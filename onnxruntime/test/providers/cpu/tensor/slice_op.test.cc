@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -649,5 +650,96 @@ TEST(SliceTest, EmptyDim) {
                       {0, 6},
                       {});
 }
+
+// Large enough for the strided copy to be split across threads, with a reversed axis
+// and a step > 1 on the innermost axis.
+TEST(SliceTest, Slice3D_LargeReverseAndStep) {
+  const std::vector<int64_t> input_dims = {4, 64, 257};
+  std::vector<int32_t> input(static_cast<size_t>(input_dims[0] * input_dims[1] * input_dims[2]));
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<int32_t>(i);
+  }
+
+  // axis 1: 60 down to 1 step -1, axis 2: 3 to 250 step 3
+  std::vector<int32_t> output;
+  int64_t out_d1 = 0, out_d2 = 0;
+  for (int64_t i0 = 0; i0 < input_dims[0]; ++i0) {
+    out_d1 = 0;
+    for (int64_t i1 = 60; i1 > 0; --i1, ++out_d1) {
+      out_d2 = 0;
+      for (int64_t i2 = 3; i2 < 250; i2 += 3, ++out_d2) {
+        output.push_back(input[static_cast<size_t>((i0 * input_dims[1] + i1) * input_dims[2] + i2)]);
+      }
+    }
+  }
+
+  RunSliceTest<int32_t>(input_dims, input,
+                        {60, 3},   // starts
+                        {0, 250},  // ends
+                        {1, 2},    // axes
+                        {-1, 3},   // steps
+                        {input_dims[0], out_d1, out_d2},
+                        output,
+                        true);
+}
+
+// Slices a value that is used again after the Slice output is consumed, so the planner makes the Slice output share
+// its input's buffer: output0 = Neg(Slice(Neg(data))) and output1 = Neg(Neg(data)).
+class SliceOfIntermediateTester : public OpTester {
+ public:
+  SliceOfIntermediateTester() : OpTester("Slice", 13) {}
+
+ protected:
+  void AddNodes(onnxruntime::Graph& graph,
+                std::vector<onnxruntime::NodeArg*>& graph_input_defs,
+                std::vector<onnxruntime::NodeArg*>& graph_output_defs,
+                std::vector<std::function<void(onnxruntime::Node& node)>>& /*add_attribute_funcs*/) override {
+    const auto* type = graph_input_defs[0]->TypeAsProto();
+    auto& intermediate = graph.GetOrCreateNodeArg("intermediate", type);
+    auto& sliced = graph.GetOrCreateNodeArg("sliced", type);
+
+    std::vector<onnxruntime::NodeArg*> slice_inputs = graph_input_defs;
+    slice_inputs[0] = &intermediate;
+
+    graph.AddNode("neg_data", "Neg", "", {graph_input_defs[0]}, {&intermediate});
+    graph.AddNode("slice", "Slice", "", slice_inputs, {&sliced});
+    graph.AddNode("neg_sliced", "Neg", "", {&sliced}, {graph_output_defs[0]});
+    graph.AddNode("neg_intermediate", "Neg", "", {&intermediate}, {graph_output_defs[1]});
+  }
+};
+
+static void RunSliceOfIntermediateTest(const std::vector<int64_t>& starts, const std::vector<int64_t>& ends,
+                                       const std::vector<int64_t>& axes,
+                                       const std::vector<int64_t>& output_dims,
+                                       const std::vector<float>& output_vals) {
+  const std::vector<int64_t> input_dims{4, 3};
+  const std::vector<float> input_vals{0.f, 1.f, 2.f,
+                                      3.f, 4.f, 5.f,
+                                      6.f, 7.f, 8.f,
+                                      9.f, 10.f, 11.f};
+
+  SliceOfIntermediateTester test;
+  test.AddInput<float>("data", input_dims, input_vals);
+  test.AddInput<int64_t>("starts", {static_cast<int64_t>(starts.size())}, starts);
+  test.AddInput<int64_t>("ends", {static_cast<int64_t>(ends.size())}, ends);
+  test.AddInput<int64_t>("axes", {static_cast<int64_t>(axes.size())}, axes);
+  test.AddOutput<float>("output", output_dims, output_vals);
+  test.AddOutput<float>("data_copy", input_dims, input_vals);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(SliceTest, OuterAxisSliceOfIntermediate) {
+  // rows 1 and 2 are a contiguous range of the input, so the Slice output can be a view of it
+  RunSliceOfIntermediateTest({1}, {3}, {0}, {2, 3}, {3.f, 4.f, 5.f, 6.f, 7.f, 8.f});
+}
+
+TEST(SliceTest, InnerAxisSliceOfIntermediate) {
+  // columns 1 and 2 are not contiguous, so the Slice output needs storage of its own
+  RunSliceOfIntermediateTest({1}, {3}, {1}, {4, 2}, {1.f, 2.f, 4.f, 5.f, 7.f, 8.f, 10.f, 11.f});
+}
+
 }  // namespace test
 }  // namespace onnxruntime
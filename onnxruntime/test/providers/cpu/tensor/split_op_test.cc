@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
+#include "test/util/include/default_providers.h"
 
 namespace onnxruntime {
 namespace test {
@@ -640,5 +641,64 @@ TEST(SplitOperatorTest, MissingOptionalInputAdded) {
   RunTest<float>(axis, {}, input, outputs, false, false, true, false, {}, false);
 }
 
+// Splits a value that is used again after the Split outputs are consumed, so the planner makes the Split outputs share
+// the input's buffer: output<i> = Neg(Split(Neg(input))[i]) and the last output is Neg(Neg(input)).
+class SplitOfIntermediateTester : public OpTester {
+ public:
+  SplitOfIntermediateTester() : OpTester("Split", 13) {}
+
+ protected:
+  void AddNodes(onnxruntime::Graph& graph,
+                std::vector<onnxruntime::NodeArg*>& graph_input_defs,
+                std::vector<onnxruntime::NodeArg*>& graph_output_defs,
+                std::vector<std::function<void(onnxruntime::Node& node)>>& add_attribute_funcs) override {
+    const auto* type = graph_input_defs[0]->TypeAsProto();
+    auto& intermediate = graph.GetOrCreateNodeArg("intermediate", type);
+
+    std::vector<onnxruntime::NodeArg*> split_outputs;
+    for (size_t i = 0; i + 1 < graph_output_defs.size(); ++i) {
+      split_outputs.push_back(&graph.GetOrCreateNodeArg("split_" + std::to_string(i), type));
+    }
+
+    graph.AddNode("neg_input", "Neg", "", {graph_input_defs[0]}, {&intermediate});
+    auto& split = graph.AddNode("split", "Split", "", {&intermediate}, split_outputs);
+    for (auto& add_attribute_fn : add_attribute_funcs) {
+      add_attribute_fn(split);
+    }
+    for (size_t i = 0; i < split_outputs.size(); ++i) {
+      graph.AddNode("neg_split_" + std::to_string(i), "Neg", "", {split_outputs[i]}, {graph_output_defs[i]});
+    }
+    graph.AddNode("neg_intermediate", "Neg", "", {&intermediate}, {graph_output_defs.back()});
+  }
+};
+
+static void RunSplitOfIntermediateTest(int64_t axis, const ShapeAndFloatData& input,
+                                       const std::vector<ShapeAndFloatData>& outputs) {
+  SplitOfIntermediateTester test;
+  test.AddAttribute("axis", axis);
+  test.AddInput<float>("input", input.first, input.second);
+  int i = 0;
+  for (auto& output : outputs) {
+    test.AddOutput<float>(("output" + std::to_string(i++)).c_str(), output.first, output.second);
+  }
+  test.AddOutput<float>("input_copy", input.first, input.second);
+
+  std::vector<std::unique_ptr<IExecutionProvider>> execution_providers;
+  execution_providers.push_back(DefaultCpuExecutionProvider());
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {}, nullptr, &execution_providers);
+}
+
+TEST(SplitOperatorTest, Axis0SplitOfIntermediate) {
+  // each output is a contiguous range of the input so can be a view of it
+  ShapeAndFloatData input = {{3, 2}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f}};
+  RunSplitOfIntermediateTest(0, input, {{{1, 2}, {1.f, 2.f}}, {{1, 2}, {3.f, 4.f}}, {{1, 2}, {5.f, 6.f}}});
+}
+
+TEST(SplitOperatorTest, Axis1SplitOfIntermediate) {
+  // the outputs interleave in the input so need storage of their own
+  ShapeAndFloatData input = {{2, 4}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f}};
+  RunSplitOfIntermediateTest(1, input, {{{2, 2}, {1.f, 2.f, 5.f, 6.f}}, {{2, 2}, {3.f, 4.f, 7.f, 8.f}}});
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -595,6 +595,76 @@ TEST(TransposeOpTest, DoTransposeEltWise) {
   }
 }
 
+// Reference transpose used to check the blocked implementation on shapes that are too large to list.
+template <typename T>
+static std::vector<T> ReferenceTranspose(const std::vector<T>& input, const std::vector<int64_t>& input_shape,
+                                         const std::vector<int64_t>& perm, std::vector<int64_t>& output_shape) {
+  const size_t rank = input_shape.size();
+  std::vector<size_t> input_strides(rank);
+  for (size_t i = rank, stride = 1; i-- > 0;) {
+    input_strides[i] = stride;
+    stride *= static_cast<size_t>(input_shape[i]);
+  }
+
+  output_shape.resize(rank);
+  for (size_t i = 0; i < rank; ++i) {
+    output_shape[i] = input_shape[perm[i]];
+  }
+
+  std::vector<T> output(input.size());
+  std::vector<int64_t> index(rank, 0);
+  for (size_t i = 0; i < output.size(); ++i) {
+    size_t offset = 0;
+    for (size_t axis = 0; axis < rank; ++axis) {
+      offset += static_cast<size_t>(index[axis]) * input_strides[perm[axis]];
+    }
+    output[i] = input[offset];
+
+    for (size_t axis = rank; axis-- > 0;) {
+      if (++index[axis] < output_shape[axis]) {
+        break;
+      }
+      index[axis] = 0;
+    }
+  }
+
+  return output;
+}
+
+template <typename T>
+static void TransposeLargeTest(const std::vector<int64_t>& input_shape, const std::vector<int64_t>& perm) {
+  const size_t size = static_cast<size_t>(TensorShape(input_shape).Size());
+  std::vector<T> input(size);
+  for (size_t i = 0; i < size; ++i) {
+    input[i] = static_cast<T>(static_cast<float>(i % 127));
+  }
+
+  std::vector<int64_t> output_shape;
+  std::vector<T> expected = ReferenceTranspose(input, input_shape, perm, output_shape);
+
+  OpTester test("Transpose");
+  test.AddAttribute("perm", perm);
+  test.AddInput<T>("X", input_shape, input);
+  test.AddOutput<T>("Y", output_shape, expected);
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider});
+}
+
+// Shapes large enough to span several tiles and threads, with permutations that exercise the row copy path,
+// the tiled 2D path and axis coalescing.
+TEST(TransposeOpTest, BlockedLargeShapes) {
+  // attention heads: {B, S, N, H} -> {B, N, S, H}
+  TransposeLargeTest<float>({2, 130, 12, 64}, {0, 2, 1, 3});
+  // NCHW <-> NHWC
+  TransposeLargeTest<float>({2, 3, 67, 65}, {0, 2, 3, 1});
+  TransposeLargeTest<uint8_t>({2, 67, 65, 3}, {0, 3, 1, 2});
+  TransposeLargeTest<MLFloat16>({1, 100, 33, 70}, {0, 3, 1, 2});
+  // general permutations that cannot be reduced to a single 2D transpose
+  TransposeLargeTest<int8_t>({5, 7, 9, 11, 13}, {4, 2, 0, 3, 1});
+  TransposeLargeTest<int16_t>({3, 70, 1, 90}, {3, 2, 0, 1});
+  TransposeLargeTest<double>({17, 19, 23, 29}, {2, 0, 3, 1});
+  TransposeLargeTest<int64_t>({70, 4, 130}, {2, 1, 0});
+}
+
 #if USE_CUDA
 constexpr const char* kGpuExecutionProvider = kCudaExecutionProvider;
 #elif USE_ROCM
@@ -10,6 +10,7 @@
 #include <mutex>
 #include <algorithm>
 #include <thread>
+#include <future>
 
 #include <gtest/gtest.h>
 
@@ -251,6 +252,107 @@ TEST(CApiTest, dim_param) {
   ASSERT_EQ(strcmp(dim_param, ""), 0);
 }
 
+TEST(CApiTest, RunAsync) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(2);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  std::vector<int64_t> dims_x = {3, 2};
+  std::vector<float> values_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::Value input = Ort::Value::CreateTensor<float>(info, values_x.data(), values_x.size(), dims_x.data(),
+                                                      dims_x.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  Ort::Value output{nullptr};
+  Ort::RunOptions run_options;
+
+  struct Completion {
+    std::promise<void> done;
+    std::string error;
+  } completion;
+
+  session.RunAsync(run_options, input_names, &input, 1, output_names, &output, 1,
+                   [](void* user_data, OrtValue** /*outputs*/, size_t num_outputs, OrtStatusPtr status) {
+                     auto* completion = static_cast<Completion*>(user_data);
+                     if (status != nullptr) {
+                       completion->error = Ort::GetApi().GetErrorMessage(status);
+                       Ort::GetApi().ReleaseStatus(status);
+                     } else if (num_outputs != 1) {
+                       completion->error = "unexpected number of outputs";
+                     }
+                     completion->done.set_value();
+                   },
+                   &completion);
+
+  completion.done.get_future().wait();
+  ASSERT_EQ(completion.error, "");
+  ASSERT_TRUE(output.IsTensor());
+  const float* values_y = output.GetTensorData<float>();
+  const std::vector<float> expected_values_y = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  for (size_t i = 0; i != expected_values_y.size(); ++i) {
+    ASSERT_EQ(values_y[i], expected_values_y[i]);
+  }
+}
+
+TEST(CApiTest, RunAsyncReportsRunErrors) {
+  Ort::SessionOptions session_options;
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  std::vector<int64_t> dims_x = {3, 2};
+  std::vector<float> values_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::Value input = Ort::Value::CreateTensor<float>(info, values_x.data(), values_x.size(), dims_x.data(),
+                                                      dims_x.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"not_an_output"};
+  Ort::Value output{nullptr};
+  Ort::RunOptions run_options;
+
+  std::promise<OrtErrorCode> error_code;
+  session.RunAsync(run_options, input_names, &input, 1, output_names, &output, 1,
+                   [](void* user_data, OrtValue** /*outputs*/, size_t /*num_outputs*/, OrtStatusPtr status) {
+                     OrtErrorCode code = ORT_OK;
+                     if (status != nullptr) {
+                       code = Ort::GetApi().GetErrorCode(status);
+                       Ort::GetApi().ReleaseStatus(status);
+                     }
+                     static_cast<std::promise<OrtErrorCode>*>(user_data)->set_value(code);
+                   },
+                   &error_code);
+
+  ASSERT_NE(error_code.get_future().get(), ORT_OK);
+  ASSERT_EQ(static_cast<OrtValue*>(output), nullptr);
+}
+
+TEST(CApiTest, SessionGetThreadPoolStats) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(2);
+  session_options.AddConfigEntry(kOrtSessionOptionsConfigIntraOpAdaptiveSpinning, "1");
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  Ort::MemoryInfo info("Cpu", OrtDeviceAllocator, 0, OrtMemTypeDefault);
+  std::vector<int64_t> dims_x = {3, 2};
+  std::vector<float> values_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::Value input = Ort::Value::CreateTensor<float>(info, values_x.data(), values_x.size(), dims_x.data(),
+                                                      dims_x.size());
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  session.Run(Ort::RunOptions{}, input_names, &input, 1, output_names, 1);
+
+  // An adaptive worker that saw no work yet spins only briefly before it blocks, and is counted once it blocks
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  OrtThreadPoolStats intra_op_stats{};
+  Ort::ThrowOnError(Ort::GetApi().SessionGetThreadPoolStats(session, 0, &intra_op_stats));
+  ASSERT_GT(intra_op_stats.parks, 0u);
+
+  // Sequential execution creates no inter-op thread pool
+  OrtThreadPoolStats inter_op_stats = session.GetThreadPoolStats(true);
+  ASSERT_EQ(inter_op_stats.spins + inter_op_stats.steals + inter_op_stats.parks + inter_op_stats.wakeups, 0u);
+}
+
 INSTANTIATE_TEST_SUITE_P(CApiTestWithProviders,
                          CApiTestWithProvider,
                          ::testing::Values(0, 1, 2, 3, 4));
@@ -0,0 +1,360 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "batching_queue.h"
+
+namespace onnxruntime {
+namespace server {
+
+namespace {
+
+// Size of one element of the types whose tensors can be concatenated with memcpy, 0 for the others
+size_t ElementSize(ONNXTensorElementDataType type) {
+  switch (type) {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+      return 1;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
+      return 2;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+      return 4;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX64:
+      return 8;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_COMPLEX128:
+      return 16;
+    default:
+      return 0;
+  }
+}
+
+size_t ElementCount(const std::vector<int64_t>& shape) {
+  return static_cast<size_t>(std::accumulate(shape.begin(), shape.end(), int64_t{1}, std::multiplies<int64_t>()));
+}
+
+}  // namespace
+
+BatchingQueue::BatchingQueue(const Ort::Session& session, const BatchingOptions& options, OrtLoggingLevel severity,
+                             std::shared_ptr<spdlog::logger> logger) : session_(session),
+                                                                       options_(options),
+                                                                       severity_(severity),
+                                                                       logger_(std::move(logger)) {
+  worker_ = std::thread([this]() { WorkerLoop(); });
+}
+
+BatchingQueue::~BatchingQueue() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  cv_.notify_all();
+  worker_.join();
+
+  logger_->info("Batching queue: {} requests in {} runs, {} rows per run on average, {}us mean queue time",
+                metrics_.requests, metrics_.runs,
+                metrics_.runs == 0 ? 0.0 : static_cast<double>(metrics_.batched_rows) / metrics_.runs,
+                metrics_.requests == 0 ? 0 : metrics_.total_queue_time_us / metrics_.requests);
+}
+
+std::vector<Ort::Value> BatchingQueue::Run(std::vector<std::string> input_names,
+                                           std::vector<Ort::Value> input_values,
+                                           const std::vector<std::string>& output_names,
+                                           const std::string& run_tag) {
+  auto request = std::make_unique<Request>();
+
+  std::vector<size_t> order(input_names.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&input_names](size_t a, size_t b) { return input_names[a] < input_names[b]; });
+
+  // A request can be merged if all its inputs are tensors of fixed size elements with the same batch dimension
+  bool mergeable = !order.empty();
+  int64_t rows = -1;
+  for (auto i : order) {
+    auto& value = input_values[i];
+    ONNXTensorElementDataType type = ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED;
+    std::vector<int64_t> shape;
+    if (value.IsTensor()) {
+      auto info = value.GetTensorTypeAndShapeInfo();
+      type = info.GetElementType();
+      shape = info.GetShape();
+    }
+
+    if (shape.empty() || ElementSize(type) == 0 || (rows != -1 && shape[0] != rows)) {
+      mergeable = false;
+    } else {
+      rows = shape[0];
+    }
+
+    request->input_names.push_back(std::move(input_names[i]));
+    request->input_values.push_back(std::move(value));
+    request->input_types.push_back(type);
+    request->input_shapes.push_back(std::move(shape));
+  }
+
+  request->rows = mergeable && rows > 0 ? rows : 0;
+  request->output_names = output_names;
+  request->run_tag = run_tag;
+  auto result = request->result.get_future();
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (request->rows == 0 || merging_disabled_) {
+      // There is no batch to wait for, so run on the calling thread instead of queueing behind the worker
+      metrics_.requests++;
+      lock.unlock();
+      return RunSession(request->input_names, request->input_values, request->output_names, request->run_tag,
+                        std::max<int64_t>(request->rows, 1));
+    }
+
+    request->enqueue_time = std::chrono::steady_clock::now();
+    queue_.push_back(std::move(request));
+  }
+  cv_.notify_one();
+
+  return result.get();
+}
+
+BatchingMetrics BatchingQueue::GetMetrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+bool BatchingQueue::CanMerge(const Request& first, const Request& other) {
+  if (first.rows == 0 || other.rows == 0 ||
+      first.input_names != other.input_names || first.output_names != other.output_names ||
+      first.input_types != other.input_types) {
+    return false;
+  }
+
+  for (size_t i = 0; i < first.input_shapes.size(); ++i) {
+    if (!std::equal(first.input_shapes[i].begin() + 1, first.input_shapes[i].end(),
+                    other.input_shapes[i].begin() + 1, other.input_shapes[i].end())) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+size_t BatchingQueue::MergeableRows() const {
+  const auto& first = *queue_.front();
+  if (first.rows == 0 || merging_disabled_) {
+    return options_.max_batch_size;
+  }
+
+  size_t rows = 0;
+  for (const auto& request : queue_) {
+    if (CanMerge(first, *request)) {
+      rows += static_cast<size_t>(request->rows);
+    }
+  }
+  return rows;
+}
+
+void BatchingQueue::WorkerLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    cv_.wait(lock, [this]() { return shutdown_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      return;
+    }
+
+    // Give other requests until the deadline of the oldest one to fill its batch
+    const auto deadline = queue_.front()->enqueue_time + options_.max_queue_delay;
+    cv_.wait_until(lock, deadline, [this]() { return shutdown_ || MergeableRows() >= options_.max_batch_size; });
+
+    auto batch = TakeBatch();
+    lock.unlock();
+    RunBatch(batch);
+    lock.lock();
+  }
+}
+
+std::vector<std::unique_ptr<BatchingQueue::Request>> BatchingQueue::TakeBatch() {
+  std::vector<std::unique_ptr<Request>> batch;
+  batch.push_back(std::move(queue_.front()));
+  queue_.pop_front();
+
+  const Request& first = *batch.front();
+  size_t rows = static_cast<size_t>(first.rows);
+  if (first.rows != 0 && !merging_disabled_) {
+    for (auto it = queue_.begin(); it != queue_.end() && rows < options_.max_batch_size;) {
+      if (CanMerge(first, **it) && rows + static_cast<size_t>((*it)->rows) <= options_.max_batch_size) {
+        rows += static_cast<size_t>((*it)->rows);
+        batch.push_back(std::move(*it));
+        it = queue_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  for (const auto& request : batch) {
+    auto queue_time = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - request->enqueue_time).count());
+    metrics_.requests++;
+    metrics_.total_queue_time_us += queue_time;
+    metrics_.max_queue_time_us = std::max(metrics_.max_queue_time_us, queue_time);
+  }
+
+  return batch;
+}
+
+std::vector<Ort::Value> BatchingQueue::RunSession(const std::vector<std::string>& input_names,
+                                                  std::vector<Ort::Value>& input_values,
+                                                  const std::vector<std::string>& output_names,
+                                                  const std::string& run_tag,
+                                                  int64_t rows) {
+  std::vector<const char*> input_ptrs;
+  input_ptrs.reserve(input_names.size());
+  for (const auto& name : input_names) {
+    input_ptrs.push_back(name.c_str());
+  }
+  std::vector<const char*> output_ptrs;
+  output_ptrs.reserve(output_names.size());
+  for (const auto& name : output_names) {
+    output_ptrs.push_back(name.c_str());
+  }
+
+  Ort::RunOptions run_options{};
+  run_options.SetRunLogVerbosityLevel(static_cast<int>(severity_));
+  run_options.SetRunTag(run_tag.c_str());
+
+  auto outputs = const_cast<Ort::Session&>(session_).Run(run_options, input_ptrs.data(), input_values.data(),
+                                                          input_values.size(), output_ptrs.data(),
+                                                          output_ptrs.size());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  metrics_.runs++;
+  metrics_.batched_rows += static_cast<uint64_t>(rows);
+  metrics_.max_batch_rows = std::max(metrics_.max_batch_rows, static_cast<uint64_t>(rows));
+  return outputs;
+}
+
+std::vector<std::vector<Ort::Value>> BatchingQueue::RunMerged(std::vector<std::unique_ptr<Request>>& batch) {
+  const Request& first = *batch.front();
+  int64_t total_rows = 0;
+  std::string run_tag;
+  for (const auto& request : batch) {
+    total_rows += request->rows;
+    if (!run_tag.empty()) {
+      run_tag += ',';
+    }
+    run_tag += request->run_tag;
+  }
+
+  Ort::AllocatorWithDefaultOptions allocator;
+  std::vector<Ort::Value> merged_inputs;
+  merged_inputs.reserve(first.input_values.size());
+  for (size_t i = 0; i < first.input_values.size(); ++i) {
+    auto shape = first.input_shapes[i];
+    shape[0] = total_rows;
+    auto merged = Ort::Value::CreateTensor(allocator, shape.data(), shape.size(), first.input_types[i]);
+
+    auto* dst = merged.GetTensorMutableData<uint8_t>();
+    for (const auto& request : batch) {
+      const size_t bytes = ElementCount(request->input_shapes[i]) * ElementSize(request->input_types[i]);
+      std::memcpy(dst, request->input_values[i].GetTensorData<uint8_t>(), bytes);
+      dst += bytes;
+    }
+
+    merged_inputs.push_back(std::move(merged));
+  }
+
+  auto outputs = RunSession(first.input_names, merged_inputs, first.output_names, run_tag, total_rows);
+
+  // Split every output along the batch dimension, in the order the requests were concatenated
+  std::vector<std::vector<Ort::Value>> split(batch.size());
+  for (auto& output : outputs) {
+    if (!output.IsTensor()) {
+      return {};
+    }
+
+    auto info = output.GetTensorTypeAndShapeInfo();
+    const auto type = info.GetElementType();
+    const auto shape = info.GetShape();
+    if (shape.empty() || shape[0] != total_rows || ElementSize(type) == 0) {
+      return {};
+    }
+
+    const size_t row_bytes = ElementCount(shape) / static_cast<size_t>(total_rows) * ElementSize(type);
+    const auto* src = output.GetTensorData<uint8_t>();
+    for (size_t r = 0; r < batch.size(); ++r) {
+      auto request_shape = shape;
+      request_shape[0] = batch[r]->rows;
+      auto value = Ort::Value::CreateTensor(allocator, request_shape.data(), request_shape.size(), type);
+
+      const size_t bytes = static_cast<size_t>(batch[r]->rows) * row_bytes;
+      std::memcpy(value.GetTensorMutableData<uint8_t>(), src, bytes);
+      src += bytes;
+
+      split[r].push_back(std::move(value));
+    }
+  }
+
+  return split;
+}
+
+bool BatchingQueue::RunAlone(Request& request) {
+  try {
+    request.result.set_value(RunSession(request.input_names, request.input_values, request.output_names,
+                                        request.run_tag, std::max<int64_t>(request.rows, 1)));
+    return true;
+  } catch (...) {
+    request.result.set_exception(std::current_exception());
+    return false;
+  }
+}
+
+void BatchingQueue::RunBatch(std::vector<std::unique_ptr<Request>>& batch) {
+  if (batch.size() == 1) {
+    RunAlone(*batch.front());
+    return;
+  }
+
+  std::vector<std::vector<Ort::Value>> outputs;
+  try {
+    outputs = RunMerged(batch);
+  } catch (const Ort::Exception& e) {
+    logger_->debug("Batch of {} requests failed, running them one at a time. Error Message: {}", batch.size(), e.what());
+  }
+
+  if (!outputs.empty()) {
+    logger_->debug("Ran a batch of {} requests", batch.size());
+    for (size_t r = 0; r < batch.size(); ++r) {
+      batch[r]->result.set_value(std::move(outputs[r]));
+    }
+    return;
+  }
+
+  // Either one of the requests is invalid, or the first dimension of the model inputs or outputs is not a batch
+  // dimension. In the latter case every request runs fine alone and there is no point in merging them again.
+  bool all_succeeded = true;
+  for (auto& request : batch) {
+    all_succeeded = RunAlone(*request) && all_succeeded;
+  }
+
+  if (all_succeeded) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      merging_disabled_ = true;
+    }
+    logger_->warn("Model inputs and outputs cannot be batched along their first dimension, requests will run one at a time");
+  }
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include "onnxruntime_cxx_api.h"
+
+namespace onnxruntime {
+namespace server {
+
+struct BatchingOptions {
+  // Maximum number of rows (sum of the batch dimensions) a merged run may have. 1 disables batching.
+  size_t max_batch_size = 1;
+  // How long the oldest queued request waits for other requests to fill its batch
+  std::chrono::microseconds max_queue_delay{1000};
+};
+
+struct BatchingMetrics {
+  uint64_t requests = 0;           // requests that went through the queue
+  uint64_t runs = 0;               // Session::Run calls made for them
+  uint64_t batched_rows = 0;       // rows of all runs, batched_rows / runs is the mean batch size
+  uint64_t max_batch_rows = 0;     // rows of the largest run
+  uint64_t total_queue_time_us = 0;
+  uint64_t max_queue_time_us = 0;
+};
+
+// Per model queue that merges concurrent requests into one Session::Run.
+// A worker thread waits until the queued requests fill max_batch_size rows or the oldest of them waited
+// max_queue_delay, concatenates the inputs of the requests with the same input names, element types and inner
+// dimensions along the first (batch) dimension, runs the session once and splits the outputs back.
+// Requests that cannot be merged (string or scalar inputs) run alone on the calling thread, and a model whose inputs
+// or outputs turn out not to have a batch dimension stops merging after the first batch and from then on runs every
+// request on its calling thread. A merged run is tagged with the run tags of its requests joined by commas.
+class BatchingQueue {
+ public:
+  BatchingQueue(const Ort::Session& session, const BatchingOptions& options, OrtLoggingLevel severity,
+                std::shared_ptr<spdlog::logger> logger);
+  ~BatchingQueue();
+  BatchingQueue(const BatchingQueue&) = delete;
+  BatchingQueue& operator=(const BatchingQueue&) = delete;
+
+  // Queues the request and blocks until it ran. Throws Ort::Exception if the run failed.
+  std::vector<Ort::Value> Run(std::vector<std::string> input_names, std::vector<Ort::Value> input_values,
+                              const std::vector<std::string>& output_names, const std::string& run_tag);
+
+  BatchingMetrics GetMetrics() const;
+
+ private:
+  struct Request {
+    std::vector<std::string> input_names;  // sorted, so that equal sets of inputs compare equal
+    std::vector<Ort::Value> input_values;
+    std::vector<std::string> output_names;
+    std::string run_tag;
+    std::vector<ONNXTensorElementDataType> input_types;
+    std::vector<std::vector<int64_t>> input_shapes;
+    int64_t rows = 0;  // 0 if the request cannot be merged with others
+    std::chrono::steady_clock::time_point enqueue_time;
+    std::promise<std::vector<Ort::Value>> result;
+  };
+
+  static bool CanMerge(const Request& first, const Request& other);
+  // Rows of the queued requests that can join the batch of the oldest one. Called with mutex_ held.
+  size_t MergeableRows() const;
+  void WorkerLoop();
+  // Removes the oldest request and the ones that can join its batch from the queue. Called with mutex_ held.
+  std::vector<std::unique_ptr<Request>> TakeBatch();
+  void RunBatch(std::vector<std::unique_ptr<Request>>& batch);
+  // Returns the outputs of each request, or nothing if the outputs cannot be split along the batch dimension
+  std::vector<std::vector<Ort::Value>> RunMerged(std::vector<std::unique_ptr<Request>>& batch);
+  // Returns false if the run failed, the error is reported to the request
+  bool RunAlone(Request& request);
+  std::vector<Ort::Value> RunSession(const std::vector<std::string>& input_names,
+                                     std::vector<Ort::Value>& input_values,
+                                     const std::vector<std::string>& output_names, const std::string& run_tag,
+                                     int64_t rows);
+
+  const Ort::Session& session_;
+  const BatchingOptions options_;
+  const OrtLoggingLevel severity_;
+  std::shared_ptr<spdlog::logger> logger_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::unique_ptr<Request>> queue_;
+  bool shutdown_ = false;
+  bool merging_disabled_ = false;
+  BatchingMetrics metrics_;
+
+  std::thread worker_;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -18,6 +18,8 @@ std::string InternalRequestId() {
 }
 const std::string MS_REQUEST_ID_HEADER = "x-ms-request-id";
 const std::string MS_CLIENT_REQUEST_ID_HEADER = "x-ms-client-request-id";
+const std::string MS_MODEL_NAME_HEADER = "x-ms-model-name";
+const std::string MS_MODEL_VERSION_HEADER = "x-ms-model-version";
 }  // namespace util
 }  // namespace server
 }  // namespace onnxruntime
\ No newline at end of file
@@ -11,6 +11,8 @@ namespace util {
 std::string InternalRequestId();
 extern const std::string MS_REQUEST_ID_HEADER;
 extern const std::string MS_CLIENT_REQUEST_ID_HEADER;
+extern const std::string MS_MODEL_NAME_HEADER;
+extern const std::string MS_MODEL_VERSION_HEADER;
 }  // namespace util
 }  // namespace server
 }  // namespace onnxruntime
\ No newline at end of file
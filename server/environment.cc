@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <fstream>
 #include <memory>
 #include "environment.h"
 #include "onnxruntime_cxx_api.h"
@@ -56,14 +57,29 @@ void ORT_API_CALL Log(void* param, OrtLoggingLevel severity, const char* categor
   return;
 }
 
-ServerEnvironment::ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink) : severity_(severity),
-                                                                                               logger_id_("ServerApp"),
-                                                                                               sink_(sink),
-                                                                                               default_logger_(std::make_shared<spdlog::logger>(logger_id_, sink)),
-                                                                                               runtime_environment_(severity, logger_id_.c_str(), Log, default_logger_.get()) {
+// The sessions of all models share the global thread pools, so that hosting many models does not multiply the threads
+static Ort::Env CreateRuntimeEnvironment(OrtLoggingLevel severity, const std::string& logger_id, spdlog::logger* logger,
+                                         int intra_op_threads, int inter_op_threads) {
+  OrtThreadingOptions* threading_options = nullptr;
+  Ort::ThrowOnError(Ort::GetApi().CreateThreadingOptions(&threading_options));
+  std::unique_ptr<OrtThreadingOptions, decltype(Ort::GetApi().ReleaseThreadingOptions)> threading_options_holder(
+      threading_options, Ort::GetApi().ReleaseThreadingOptions);
+  Ort::ThrowOnError(Ort::GetApi().SetGlobalIntraOpNumThreads(threading_options, intra_op_threads));
+  Ort::ThrowOnError(Ort::GetApi().SetGlobalInterOpNumThreads(threading_options, inter_op_threads));
+  return Ort::Env(threading_options, Log, logger, severity, logger_id.c_str());
+}
+
+ServerEnvironment::ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink,
+                                     int intra_op_threads, int inter_op_threads) : severity_(severity),
+                                                                                   logger_id_("ServerApp"),
+                                                                                   sink_(sink),
+                                                                                   default_logger_(std::make_shared<spdlog::logger>(logger_id_, sink)),
+                                                                                   runtime_environment_(CreateRuntimeEnvironment(severity, logger_id_, default_logger_.get(), intra_op_threads, inter_op_threads)) {
   spdlog::set_automatic_registration(false);
   spdlog::set_level(Convert(severity_));
   spdlog::initialize_logger(default_logger_);
+  options_.DisablePerSessionThreads();
+  RegisterExecutionProviders();
 }
 
 void ServerEnvironment::RegisterExecutionProviders(){
@@ -86,47 +102,162 @@ void ServerEnvironment::RegisterExecutionProviders(){
 
 }
 
-void ServerEnvironment::InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version) {
-  RegisterExecutionProviders();
-  auto result = sessions_.emplace(std::piecewise_construct, std::forward_as_tuple(model_name, model_version), std::forward_as_tuple(runtime_environment_, model_path.c_str(), options_));
+void ServerEnvironment::RegisterModel(const std::string& model_path, const std::string& model_name, const std::string& model_version,
+                                      size_t memory_bytes) {
+  if (memory_bytes == 0) {
+    // The initializers make up most of the memory of a session, and most of the model file
+    std::ifstream model_file(model_path, std::ios::binary | std::ios::ate);
+    if (!model_file) {
+      throw Ort::Exception("Model file not found: " + model_path, ORT_NO_SUCHFILE);
+    }
+    memory_bytes = static_cast<size_t>(model_file.tellg());
+  }
 
-  if (!result.second) {
+  std::lock_guard<std::mutex> lock(models_mutex_);
+  ModelEntry entry;
+  entry.path = model_path;
+  entry.memory_bytes = memory_bytes;
+  if (!models_.emplace(std::make_pair(model_name, model_version), std::move(entry)).second) {
     throw Ort::Exception("Model of that name already loaded.", ORT_INVALID_ARGUMENT);
   }
+}
+
+void ServerEnvironment::InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version,
+                                        size_t memory_bytes) {
+  RegisterModel(model_path, model_name, model_version, memory_bytes);
+  try {
+    GetModel(model_name, model_version);
+  } catch (const Ort::Exception&) {
+    UnloadModel(model_name, model_version);
+    throw;
+  }
+}
 
-  auto iterator = result.first;
-  auto output_count = (iterator->second).session.GetOutputCount();
+std::shared_ptr<LoadedModel> ServerEnvironment::LoadModel(const std::string& model_path, const BatchingOptions& batching_options) {
+  auto model = std::make_shared<LoadedModel>(runtime_environment_, model_path, options_);
+  auto output_count = model->session.GetOutputCount();
 
   Ort::AllocatorWithDefaultOptions allocator;
   for (size_t i = 0; i < output_count; i++) {
-    auto name = (iterator->second).session.GetOutputName(i, allocator);
-    (iterator->second).output_names.push_back(name);
+    auto name = model->session.GetOutputName(i, allocator);
+    model->output_names.push_back(name);
     allocator.Free(name);
   }
-}
 
-const std::vector<std::string>& ServerEnvironment::GetModelOutputNames(const std::string& model_name, const std::string& model_version) const {
-  auto identifier = std::make_pair(model_name, model_version);
-  auto it = sessions_.find(identifier);
-  if (it == sessions_.end()) {
-    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+  if (batching_options.max_batch_size > 1) {
+    model->batching_queue = std::make_unique<BatchingQueue>(model->session, batching_options, severity_, default_logger_);
   }
 
-  return it->second.output_names;
+  return model;
 }
 
-OrtLoggingLevel ServerEnvironment::GetLogSeverity() const {
-  return severity_;
+std::vector<std::shared_ptr<LoadedModel>> ServerEnvironment::UnloadIdleModels(size_t memory_bytes) {
+  std::vector<std::shared_ptr<LoadedModel>> unloaded;
+  while (memory_budget_ != 0 && loaded_memory_ + memory_bytes > memory_budget_) {
+    ModelEntry* least_recently_used = nullptr;
+    for (auto& it : models_) {
+      auto& entry = it.second;
+      // Only this map references an idle model, and new references are only handed out under models_mutex_
+      if (entry.model && entry.model.use_count() == 1 &&
+          (least_recently_used == nullptr || entry.last_used < least_recently_used->last_used)) {
+        least_recently_used = &entry;
+      }
+    }
+
+    if (least_recently_used == nullptr) {
+      default_logger_->warn("Memory budget of {} bytes exceeded, all loaded models are in use", memory_budget_);
+      break;
+    }
+
+    default_logger_->info("Unloading model {} to stay within the memory budget", least_recently_used->path);
+    loaded_memory_ -= least_recently_used->memory_bytes;
+    unloaded.push_back(std::move(least_recently_used->model));
+    least_recently_used->model = nullptr;
+  }
+
+  return unloaded;
 }
 
-const Ort::Session& ServerEnvironment::GetSession(const std::string& model_name, const std::string& model_version) const {
-  auto identifier = std::make_pair(model_name, model_version);
-  auto it = sessions_.find(identifier);
-  if (it == sessions_.end()) {
-    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+std::shared_ptr<LoadedModel> ServerEnvironment::GetModel(const std::string& model_name, const std::string& model_version) {
+  const auto identifier = std::make_pair(model_name, model_version);
+  std::unique_lock<std::mutex> lock(models_mutex_);
+  ModelEntry* entry = nullptr;
+  for (;;) {
+    auto it = models_.find(identifier);
+    if (it == models_.end()) {
+      throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+    }
+
+    entry = &it->second;
+    entry->last_used = ++use_count_;
+    if (entry->model) {
+      return entry->model;
+    }
+    if (!entry->loading) {
+      break;
+    }
+
+    // Another request is loading the model
+    model_loaded_.wait(lock);
+  }
+
+  entry->loading = true;
+  auto unloaded = UnloadIdleModels(entry->memory_bytes);
+  loaded_memory_ += entry->memory_bytes;
+  const auto model_path = entry->path;
+  const auto memory_bytes = entry->memory_bytes;
+  const auto batching_options = batching_options_;
+  lock.unlock();
+
+  unloaded.clear();
+  std::shared_ptr<LoadedModel> model;
+  std::exception_ptr error;
+  try {
+    model = LoadModel(model_path, batching_options);
+  } catch (...) {
+    error = std::current_exception();
   }
 
-  return it->second.session;
+  lock.lock();
+  // UnloadModel waits for loads to finish, so the entry is still there
+  entry = &models_.at(identifier);
+  entry->loading = false;
+  if (error) {
+    loaded_memory_ -= memory_bytes;
+  } else {
+    entry->model = model;
+  }
+  model_loaded_.notify_all();
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return model;
+}
+
+bool ServerEnvironment::IsModelLoaded(const std::string& model_name, const std::string& model_version) const {
+  std::lock_guard<std::mutex> lock(models_mutex_);
+  auto it = models_.find(std::make_pair(model_name, model_version));
+  return it != models_.end() && it->second.model != nullptr;
+}
+
+void ServerEnvironment::SetMemoryBudget(size_t bytes) {
+  std::lock_guard<std::mutex> lock(models_mutex_);
+  memory_budget_ = bytes;
+}
+
+size_t ServerEnvironment::GetLoadedModelsMemory() const {
+  std::lock_guard<std::mutex> lock(models_mutex_);
+  return loaded_memory_;
+}
+
+void ServerEnvironment::SetBatchingOptions(const BatchingOptions& options) {
+  std::lock_guard<std::mutex> lock(models_mutex_);
+  batching_options_ = options;
+}
+
+OrtLoggingLevel ServerEnvironment::GetLogSeverity() const {
+  return severity_;
 }
 
 std::shared_ptr<spdlog::logger> ServerEnvironment::GetLogger(const std::string& request_id) const {
@@ -140,13 +271,27 @@ std::shared_ptr<spdlog::logger> ServerEnvironment::GetAppLogger() const {
 }
 
 void ServerEnvironment::UnloadModel(const std::string& model_name, const std::string& model_version) {
-  auto identifier = std::make_pair(model_name, model_version);
-  auto it = sessions_.find(identifier);
-  if (it == sessions_.end()) {
-    throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+  const auto identifier = std::make_pair(model_name, model_version);
+  std::shared_ptr<LoadedModel> model;
+  {
+    std::unique_lock<std::mutex> lock(models_mutex_);
+    auto it = models_.find(identifier);
+    while (it != models_.end() && it->second.loading) {
+      model_loaded_.wait(lock);
+      it = models_.find(identifier);
+    }
+
+    if (it == models_.end()) {
+      throw Ort::Exception("No model loaded of that name.", ORT_NO_MODEL);
+    }
+
+    if (it->second.model) {
+      loaded_memory_ -= it->second.memory_bytes;
+    }
+    model = std::move(it->second.model);
+    models_.erase(it);
   }
-
-  sessions_.erase(it);
+  // Requests still running keep the model alive until they finish
 }
 
 }  // namespace server
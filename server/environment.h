@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "onnxruntime_cxx_api.h"
@@ -11,26 +13,63 @@
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
 
+#include "batching_queue.h"
+
 namespace onnxruntime {
 namespace server {
 
+// A model loaded into a session. Requests hold a reference while they run, so that the model is not unloaded
+// under them when the memory budget requires room for another model.
+struct LoadedModel {
+  Ort::Session session;
+  std::vector<std::string> output_names;
+  // Declared after the session so that queued requests finish before the session is destroyed
+  std::unique_ptr<BatchingQueue> batching_queue;
+  explicit LoadedModel(Ort::Env& env, const std::string& path, const Ort::SessionOptions& options) : session(nullptr) {
+    session = Ort::Session(env, path.c_str(), options);
+  };
+  ~LoadedModel() = default;
+  LoadedModel(const LoadedModel&) = delete;
+  LoadedModel(const LoadedModel&&) = delete;
+  LoadedModel& operator=(const LoadedModel&) = delete;
+};
+
+// Hosts any number of models. All sessions share the global thread pools of the environment. Models can be
+// registered to load on their first request and, when a memory budget is set, the least recently used idle models
+// are unloaded to keep the memory of the loaded models within the budget.
 class ServerEnvironment {
  public:
-  explicit ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink);
+  // intra_op_threads and inter_op_threads size the global thread pools, 0 picks the default size
+  explicit ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink,
+                             int intra_op_threads = 0, int inter_op_threads = 0);
   ~ServerEnvironment() = default;
   ServerEnvironment(const ServerEnvironment&) = delete;
 
   OrtLoggingLevel GetLogSeverity() const;
 
-  const Ort::Session& GetSession(const std::string& model_name, const std::string& model_version) const;
-  void InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version);
-  const std::vector<std::string>& GetModelOutputNames(const std::string& model_name, const std::string& model_version) const;
+  // Registers a model that is loaded by its first request. memory_bytes is the memory accounted to the model
+  // against the budget, 0 estimates it from the size of the model file.
+  void RegisterModel(const std::string& model_path, const std::string& model_name, const std::string& model_version,
+                     size_t memory_bytes = 0);
+  // Registers a model and loads it right away
+  void InitializeModel(const std::string& model_path, const std::string& model_name, const std::string& model_version,
+                       size_t memory_bytes = 0);
+  // Returns the model, loading it first if needed. Throws Ort::Exception if no such model is registered.
+  std::shared_ptr<LoadedModel> GetModel(const std::string& model_name, const std::string& model_version);
+  bool IsModelLoaded(const std::string& model_name, const std::string& model_version) const;
+  void UnloadModel(const std::string& model_name, const std::string& model_version);
+
+  // Memory the loaded models may take together, 0 for no limit. Applies to the models loaded afterwards.
+  void SetMemoryBudget(size_t bytes);
+  size_t GetLoadedModelsMemory() const;
+  // Applies to the models loaded afterwards
+  void SetBatchingOptions(const BatchingOptions& options);
+
   std::shared_ptr<spdlog::logger> GetLogger(const std::string& request_id) const;
   std::shared_ptr<spdlog::logger> GetAppLogger() const;
-  void UnloadModel(const std::string& model_name, const std::string& model_version);
+ private:
   void RegisterExecutionProviders();
 
- private:
   const OrtLoggingLevel severity_;
   const std::string logger_id_;
   const std::vector<spdlog::sink_ptr> sink_;
@@ -38,20 +77,29 @@ class ServerEnvironment {
 
   Ort::Env runtime_environment_;
   Ort::SessionOptions options_;
+  BatchingOptions batching_options_;
 
-  struct SessionHolder {
-    Ort::Session session;
-    std::vector<std::string> output_names;
-    explicit SessionHolder(Ort::Env& env, std::string path, const Ort::SessionOptions& options) : session(nullptr) {
-      session = Ort::Session(env, path.c_str(), options);
-    };
-    ~SessionHolder() = default;
-    SessionHolder(const SessionHolder&) = delete;
-    SessionHolder(const SessionHolder&&) = delete;
-    SessionHolder& operator=(const SessionHolder&) = delete;
+  struct ModelEntry {
+    std::string path;
+    size_t memory_bytes = 0;
+    std::shared_ptr<LoadedModel> model;  // nullptr while the model is not loaded
+    bool loading = false;
+    uint64_t last_used = 0;
   };
 
-  std::unordered_map<std::pair<std::string, std::string>, ServerEnvironment::SessionHolder, boost::hash<std::pair<std::string, std::string>>> sessions_;
+  using ModelKey = std::pair<std::string, std::string>;
+
+  std::shared_ptr<LoadedModel> LoadModel(const std::string& model_path, const BatchingOptions& batching_options);
+  // Unloads idle models, least recently used first, until memory_bytes more fit in the budget.
+  // Called with models_mutex_ held, the unloaded models are returned to be destroyed after releasing it.
+  std::vector<std::shared_ptr<LoadedModel>> UnloadIdleModels(size_t memory_bytes);
+
+  mutable std::mutex models_mutex_;
+  std::condition_variable model_loaded_;
+  std::unordered_map<ModelKey, ModelEntry, boost::hash<ModelKey>> models_;
+  size_t memory_budget_ = 0;
+  size_t loaded_memory_ = 0;
+  uint64_t use_count_ = 0;
 };
 
 }  // namespace server
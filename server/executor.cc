@@ -23,6 +23,16 @@ protobufutil::Status Executor::SetMLValue(const onnx::TensorProto& input_tensor,
                                           /* out */ Ort::Value& ml_value) {
   auto logger = env_->GetLogger(request_id_);
 
+  // Tensors in raw_data are run straight from the request when possible
+  try {
+    if (onnxruntime::server::TryWrapRawData(input_tensor, *cpu_memory_info, ml_value)) {
+      return protobufutil::Status::OK;
+    }
+  } catch (const Ort::Exception& e) {
+    logger->error("TryWrapRawData() failed. Error Message: {}", e.what());
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
   size_t cpu_tensor_length = 0;
   try {
     onnxruntime::server::GetSizeInBytesFromTensorProto<0>(input_tensor, &cpu_tensor_length);
@@ -97,6 +107,44 @@ std::vector<Ort::Value> Run(const Ort::Session& session, const Ort::RunOptions&
   return const_cast<Ort::Session&>(session).Run(options, input_ptrs.data(), const_cast<Ort::Value*>(input_values.data()), input_count, output_ptrs.data(), output_count);
 }
 
+protobufutil::Status Executor::Predict(const std::string& model_name,
+                                       const std::string& model_version,
+                                       std::vector<std::string> input_names,
+                                       std::vector<Ort::Value> input_values,
+                                       /* in, out */ std::vector<std::string>& output_names,
+                                       /* out */ std::vector<Ort::Value>& outputs) {
+  auto logger = env_->GetLogger(request_id_);
+
+  // Holding the model keeps it loaded until the outputs are released
+  try {
+    model_ = env_->GetModel(model_name, model_version);
+  } catch (const Ort::Exception& e) {
+    logger->error("GetModel() failed. Model: {}, Version: {}. Error Message: {}", model_name, model_version, e.what());
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
+  Ort::RunOptions run_options{};
+  run_options.SetRunLogVerbosityLevel(static_cast<int>(env_->GetLogSeverity()));
+  run_options.SetRunTag(request_id_.c_str());
+
+  if (output_names.empty()) {
+    output_names = model_->output_names;
+  }
+
+  try {
+    if (model_->batching_queue != nullptr) {
+      outputs = model_->batching_queue->Run(std::move(input_names), std::move(input_values), output_names,
+                                                request_id_);
+    } else {
+      outputs = Run(model_->session, run_options, input_names, input_values, output_names);
+    }
+  } catch (const Ort::Exception& e) {
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
+  return protobufutil::Status::OK;
+}
+
 protobufutil::Status Executor::Predict(const std::string& model_name,
                                        const std::string& model_version,
                                        const onnxruntime::server::PredictRequest& request,
@@ -112,27 +160,17 @@ protobufutil::Status Executor::Predict(const std::string& model_name,
     return conversion_status;
   }
 
-  Ort::RunOptions run_options{};
-  run_options.SetRunLogVerbosityLevel(static_cast<int>(env_->GetLogSeverity()));
-  run_options.SetRunTag(request_id_.c_str());
-
   // Prepare the output names
   std::vector<std::string> output_names;
-
-  if (!request.output_filter().empty()) {
-    output_names.reserve(request.output_filter_size());
-    for (const auto& name : request.output_filter()) {
-      output_names.push_back(name);
-    }
-  } else {
-    output_names = env_->GetModelOutputNames(model_name, model_version);
+  output_names.reserve(request.output_filter_size());
+  for (const auto& name : request.output_filter()) {
+    output_names.push_back(name);
   }
 
   std::vector<Ort::Value> outputs;
-  try {
-    outputs = Run(env_->GetSession(model_name, model_version), run_options, input_names, input_values, output_names);
-  } catch (const Ort::Exception& e) {
-    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  auto status = Predict(model_name, model_version, std::move(input_names), std::move(input_values), output_names, outputs);
+  if (!status.ok()) {
+    return status;
   }
 
   // Build the response
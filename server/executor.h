@@ -25,10 +25,21 @@ class Executor {
                                          const onnxruntime::server::PredictRequest& request,
                                          /* out */ onnxruntime::server::PredictResponse& response);
 
+  // Runs the model on inputs that already are values, such as the ones wrapping a raw tensor payload.
+  // An empty output_names requests all outputs of the model and is filled with their names.
+  // The executor keeps the model loaded, so it must outlive the outputs.
+  google::protobuf::util::Status Predict(const std::string& model_name,
+                                         const std::string& model_version,
+                                         std::vector<std::string> input_names,
+                                         std::vector<Ort::Value> input_values,
+                                         /* in, out */ std::vector<std::string>& output_names,
+                                         /* out */ std::vector<Ort::Value>& outputs);
+
  private:
   ServerEnvironment* env_;
   const std::string request_id_;
   bool using_raw_data_;
+  std::shared_ptr<LoadedModel> model_;
 
   google::protobuf::util::Status SetMLValue(const onnx::TensorProto& input_tensor,
                                             MemBufferArray& buffers,
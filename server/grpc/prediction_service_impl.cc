@@ -13,14 +13,24 @@ PredictionServiceImpl::PredictionServiceImpl(const std::shared_ptr<onnxruntime::
 ::grpc::Status PredictionServiceImpl::Predict(::grpc::ServerContext* context, const ::onnxruntime::server::PredictRequest* request, ::onnxruntime::server::PredictResponse* response) {
   auto request_id = SetRequestContext(context);
   onnxruntime::server::Executor executor(environment_.get(), request_id);
-  //TODO: (csteegz) Add modelspec for both paths.
-  auto status = executor.Predict("default", "1", *request, *response);  // Currently only support one model so hard coded.
+  auto status = executor.Predict(GetMetadata(context, util::MS_MODEL_NAME_HEADER, "default"),
+                                 GetMetadata(context, util::MS_MODEL_VERSION_HEADER, "1"),
+                                 *request, *response);
   if (!status.ok()) {
     return ::grpc::Status(::grpc::StatusCode(status.error_code()), status.error_message());
   }
   return ::grpc::Status::OK;
 }
 
+std::string PredictionServiceImpl::GetMetadata(::grpc::ServerContext* context, const std::string& key, const std::string& default_value) {
+  const auto& metadata = context->client_metadata();
+  auto search = metadata.find(key);
+  if (search == metadata.end()) {
+    return default_value;
+  }
+  return std::string{search->second.data(), search->second.length()};
+}
+
 std::string PredictionServiceImpl::SetRequestContext(::grpc::ServerContext* context) {
   auto metadata = context->client_metadata();
   auto request_id = util::InternalRequestId();
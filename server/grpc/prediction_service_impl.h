@@ -20,6 +20,9 @@ class PredictionServiceImpl final : public onnxruntime::server::PredictionServic
 
   //Extract customer request ID and set request ID for response.
   std::string SetRequestContext(::grpc::ServerContext* context);
+
+  //Value of a client metadata entry, such as the model name and version to route the request to.
+  static std::string GetMetadata(::grpc::ServerContext* context, const std::string& key, const std::string& default_value);
 };
 }  // namespace grpc
 }  // namespace server
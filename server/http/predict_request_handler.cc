@@ -7,6 +7,7 @@
 #include "http_server.h"
 #include "json_handling.h"
 #include "executor.h"
+#include "serializing/raw_tensor_payload.h"
 #include "util.h"
 
 namespace onnxruntime {
@@ -31,6 +32,10 @@ namespace protobufutil = google::protobuf::util;
 static bool ParseRequestPayload(const HttpContext& context, SupportedContentType request_type,
                                 /* out */ PredictRequest& predictRequest, /* out */ http::status& error_code, /* out */ std::string& error_message);
 
+static void PredictRawTensors(const std::string& name, const std::string& version,
+                              /* in, out */ HttpContext& context,
+                              const std::shared_ptr<ServerEnvironment>& env);
+
 void Predict(const std::string& name,
              const std::string& version,
              const std::string& action,
@@ -51,10 +56,25 @@ void Predict(const std::string& name,
   SupportedContentType response_type = GetResponseContentType(context);
   if (response_type == SupportedContentType::Unknown) {
     GenerateErrorResponse(logger, http::status::bad_request, "Unknown 'Accept' header field in the request", context);
+    return;
+  }
+
+  // Raw tensors are answered with raw tensors unless the client asks for another type
+  if (request_type == SupportedContentType::RawTensors &&
+      (context.request.find("Accept") == context.request.end() || context.request["Accept"] == "*/*")) {
+    response_type = SupportedContentType::RawTensors;
+  }
+  if (request_type == SupportedContentType::RawTensors || response_type == SupportedContentType::RawTensors) {
+    if (request_type != response_type) {
+      GenerateErrorResponse(logger, http::status::bad_request,
+                            "Raw tensor payloads must be used for both the request and the response", context);
+      return;
+    }
+    PredictRawTensors(effective_name, effective_version, context, env);
+    return;
   }
 
   // Deserialize the payload
-  auto body = context.request.body();
   PredictRequest predict_request{};
   http::status error_code;
   std::string error_message;
@@ -96,12 +116,55 @@ void Predict(const std::string& name,
   if (!context.client_request_id.empty()) {
     context.response.insert(util::MS_CLIENT_REQUEST_ID_HEADER, context.client_request_id);
   }
-  context.response.body() = response_body;
+  context.response.body() = std::move(response_body);
   context.response.result(http::status::ok);
 };
 
+// The body is wrapped as the input tensors and the response body written from the output tensors,
+// without a PredictRequest or PredictResponse in between
+static void PredictRawTensors(const std::string& name, const std::string& version,
+                              HttpContext& context,
+                              const std::shared_ptr<ServerEnvironment>& env) {
+  auto logger = env->GetLogger(context.request_id);
+
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  MemBufferArray buffers;
+  std::vector<std::string> input_names;
+  std::vector<Ort::Value> input_values;
+  try {
+    RawTensorPayloadToMLValues(context.request.body(), *memory_info, buffers, input_names, input_values);
+  } catch (const Ort::Exception& e) {
+    GenerateErrorResponse(logger, http::status::bad_request, e.what(), context);
+    return;
+  }
+
+  Executor executor(env.get(), context.request_id);
+  std::vector<std::string> output_names;
+  std::vector<Ort::Value> outputs;
+  auto status = executor.Predict(name, version, std::move(input_names), std::move(input_values), output_names, outputs);
+  if (!status.ok()) {
+    GenerateErrorResponse(logger, GetHttpStatusCode((status)), status.error_message(), context);
+    return;
+  }
+
+  std::string& response_body = context.response.body();
+  try {
+    MLValuesToRawTensorPayload(output_names, outputs, response_body);
+  } catch (const Ort::Exception& e) {
+    GenerateErrorResponse(logger, http::status::internal_server_error, e.what(), context);
+    return;
+  }
+
+  context.response.set(http::field::content_type, RAW_TENSORS_CONTENT_TYPE);
+  context.response.insert(util::MS_REQUEST_ID_HEADER, context.request_id);
+  if (!context.client_request_id.empty()) {
+    context.response.insert(util::MS_CLIENT_REQUEST_ID_HEADER, context.client_request_id);
+  }
+  context.response.result(http::status::ok);
+}
+
 static bool ParseRequestPayload(const HttpContext& context, SupportedContentType request_type, PredictRequest& predictRequest, http::status& error_code, std::string& error_message) {
-  auto body = context.request.body();
+  const auto& body = context.request.body();
   protobufutil::Status status;
   switch (request_type) {
     case SupportedContentType::Json: {
@@ -18,6 +18,8 @@ static std::unordered_set<std::string> protobuf_mime_types{
     "application/vnd.google.protobuf",
     "application/x-protobuf"};
 
+const std::string RAW_TENSORS_CONTENT_TYPE = "application/vnd.onnxruntime.tensors";
+
 boost::beast::http::status GetHttpStatusCode(const protobufutil::Status& status) {
   switch (status.error_code()) {
     case protobufutil::error::Code::OK:
@@ -60,6 +62,8 @@ SupportedContentType GetRequestContentType(const HttpContext& context) {
       return SupportedContentType::Json;
     } else if (protobuf_mime_types.find(context.request["Content-Type"].to_string()) != protobuf_mime_types.end()) {
       return SupportedContentType::PbByteArray;
+    } else if (context.request["Content-Type"] == RAW_TENSORS_CONTENT_TYPE) {
+      return SupportedContentType::RawTensors;
     }
   }
 
@@ -72,6 +76,8 @@ SupportedContentType GetResponseContentType(const HttpContext& context) {
       return SupportedContentType::Json;
     } else if (context.request["Accept"] == "*/*" || protobuf_mime_types.find(context.request["Accept"].to_string()) != protobuf_mime_types.end()) {
       return SupportedContentType::PbByteArray;
+    } else if (context.request["Accept"] == RAW_TENSORS_CONTENT_TYPE) {
+      return SupportedContentType::RawTensors;
     }
   } else {
     return SupportedContentType::PbByteArray;
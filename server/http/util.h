@@ -17,18 +17,23 @@ namespace beast = boost::beast;  // from <boost/beast.hpp>
 enum class SupportedContentType : int {
   Unknown,
   Json,
-  PbByteArray
+  PbByteArray,
+  RawTensors  // see serializing/raw_tensor_payload.h
 };
 
+extern const std::string RAW_TENSORS_CONTENT_TYPE;
+
 // Mapping protobuf status to http status
 boost::beast::http::status GetHttpStatusCode(const google::protobuf::util::Status& status);
 
 // "Content-Type" header field in request is MUST-HAVE.
-// Currently we only support two types of input content type: application/json and application/octet-stream
+// Currently we support three types of input content type: application/json, application/octet-stream and
+// RAW_TENSORS_CONTENT_TYPE
 SupportedContentType GetRequestContentType(const HttpContext& context);
 
 // "Accept" header field in request is OPTIONAL.
-// Currently we only support three types of response content type: */*, application/json and application/octet-stream
+// Currently we support four types of response content type: */*, application/json, application/octet-stream and
+// RAW_TENSORS_CONTENT_TYPE
 SupportedContentType GetResponseContentType(const HttpContext& context);
 
 }  // namespace server
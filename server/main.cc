@@ -58,15 +58,36 @@ int main(int argc, char* argv[]) {
     exit(EXIT_FAILURE);
   }
 
-  const auto env = std::make_shared<server::ServerEnvironment>(config.logging_level, spdlog::sinks_init_list{std::make_shared<spdlog::sinks::stdout_sink_mt>(), std::make_shared<spdlog::sinks::syslog_sink_mt>()});
+  const auto env = std::make_shared<server::ServerEnvironment>(config.logging_level, spdlog::sinks_init_list{std::make_shared<spdlog::sinks::stdout_sink_mt>(), std::make_shared<spdlog::sinks::syslog_sink_mt>()},
+                                                               config.intra_op_threads, config.inter_op_threads);
   auto logger = env->GetAppLogger();
-  logger->info("Model path: {}, ", config.model_path);
-  logger->info("Model name: {}", config.model_name);
-  logger->info("Model version: {}", config.model_version);
+
+  if (config.memory_budget_mb > 0) {
+    env->SetMemoryBudget(static_cast<size_t>(config.memory_budget_mb) * 1024 * 1024);
+    logger->info("Memory budget of the loaded models: {}MB", config.memory_budget_mb);
+  }
+
+  if (config.max_batch_size > 1) {
+    server::BatchingOptions batching_options;
+    batching_options.max_batch_size = static_cast<size_t>(config.max_batch_size);
+    batching_options.max_queue_delay = std::chrono::microseconds(config.max_queue_delay_us);
+    env->SetBatchingOptions(batching_options);
+    logger->info("Batching up to {} rows per run, waiting up to {}us", config.max_batch_size, config.max_queue_delay_us);
+  }
 
   try {
-    env->InitializeModel(config.model_path, config.model_name, config.model_version);
-    logger->debug("Initialize Model Successfully!");
+    if (!config.model_path.empty()) {
+      logger->info("Model path: {}, ", config.model_path);
+      logger->info("Model name: {}", config.model_name);
+      logger->info("Model version: {}", config.model_version);
+      env->InitializeModel(config.model_path, config.model_name, config.model_version, config.model_memory_bytes);
+      logger->debug("Initialize Model Successfully!");
+    }
+
+    for (const auto& model : config.models) {
+      logger->info("Registered model {} version {} at {}", model.name, model.version, model.path);
+      env->RegisterModel(model.path, model.name, model.version, model.memory_bytes);
+    }
   } catch (const Ort::Exception& ex) {
     logger->critical("Initialize Model Failed: {} ---- Error: [{}]", ex.GetOrtErrorCode(), ex.what());
     exit(EXIT_FAILURE);
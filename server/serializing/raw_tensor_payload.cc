@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "raw_tensor_payload.h"
+
+#include <cstring>
+#include <limits>
+
+#include "onnx-ml.pb.h"
+
+#include "converter.h"
+#include "tensorprotoutils.h"
+
+namespace onnxruntime {
+namespace server {
+
+namespace {
+
+constexpr size_t kDataAlignment = 8;
+
+class PayloadReader {
+ public:
+  explicit PayloadReader(const std::string& payload) : payload_(payload) {}
+
+  template <typename T>
+  T Read() {
+    T value;
+    std::memcpy(&value, Take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  const char* Take(size_t length) {
+    if (length > payload_.size() - offset_) {
+      throw Ort::Exception("Raw tensor payload is truncated", OrtErrorCode::ORT_INVALID_ARGUMENT);
+    }
+    const char* data = payload_.data() + offset_;
+    offset_ += length;
+    return data;
+  }
+
+  void SkipPadding() {
+    Take((kDataAlignment - offset_ % kDataAlignment) % kDataAlignment);
+  }
+
+  bool AtEnd() const { return offset_ == payload_.size(); }
+
+  size_t Remaining() const { return payload_.size() - offset_; }
+
+ private:
+  const std::string& payload_;
+  size_t offset_ = 0;
+};
+
+template <typename T>
+void Append(std::string& payload, T value) {
+  payload.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void AppendPadding(std::string& payload) {
+  payload.append((kDataAlignment - payload.size() % kDataAlignment) % kDataAlignment, '\0');
+}
+
+}  // namespace
+
+void RawTensorPayloadToMLValues(const std::string& payload, const OrtMemoryInfo& memory_info,
+                                MemBufferArray& buffers,
+                                std::vector<std::string>& names,
+                                std::vector<Ort::Value>& values) {
+  if (!IsLittleEndianOrder()) {
+    throw Ort::Exception("Raw tensor payloads need a little-endian host", OrtErrorCode::ORT_NOT_IMPLEMENTED);
+  }
+
+  PayloadReader reader(payload);
+  auto tensor_count = reader.Read<uint32_t>();
+  for (uint32_t i = 0; i < tensor_count; ++i) {
+    auto name_length = reader.Read<uint32_t>();
+    std::string name(reader.Take(name_length), name_length);
+
+    auto data_type = reader.Read<int32_t>();
+    size_t element_size = GetElementSizeFromProtoType(data_type);
+    if (element_size == 0) {
+      throw Ort::Exception("Unsupported element type " + std::to_string(data_type) + " of input " + name,
+                           OrtErrorCode::ORT_INVALID_ARGUMENT);
+    }
+
+    // check the rank against the payload before sizing the shape from it
+    auto rank = reader.Read<uint32_t>();
+    if (rank > reader.Remaining() / sizeof(int64_t)) {
+      throw Ort::Exception("Raw tensor payload is truncated", OrtErrorCode::ORT_INVALID_ARGUMENT);
+    }
+    std::vector<int64_t> shape(rank);
+    size_t element_count = 1;
+    for (auto& dim : shape) {
+      dim = reader.Read<int64_t>();
+      if (dim < 0 || (dim > 0 && element_count > std::numeric_limits<size_t>::max() / static_cast<size_t>(dim))) {
+        throw Ort::Exception("Invalid shape of input " + name, OrtErrorCode::ORT_INVALID_ARGUMENT);
+      }
+      element_count *= static_cast<size_t>(dim);
+    }
+
+    auto data_length = reader.Read<uint64_t>();
+    if (element_count > std::numeric_limits<size_t>::max() / element_size ||
+        data_length != element_count * element_size) {
+      throw Ort::Exception("Data length of input " + name + " does not match its shape",
+                           OrtErrorCode::ORT_INVALID_ARGUMENT);
+    }
+    reader.SkipPadding();
+    const char* data = reader.Take(static_cast<size_t>(data_length));
+
+    // The payload offset is aligned, but the payload itself may not be
+    void* tensor_data = const_cast<char*>(data);
+    if (reinterpret_cast<uintptr_t>(data) % element_size != 0) {
+      tensor_data = buffers.AllocNewBuffer(static_cast<size_t>(data_length));
+      std::memcpy(tensor_data, data, static_cast<size_t>(data_length));
+    }
+
+    names.push_back(std::move(name));
+    values.push_back(Ort::Value::CreateTensor(&memory_info, tensor_data, static_cast<size_t>(data_length),
+                                              shape.data(), shape.size(), CApiElementTypeFromProtoType(data_type)));
+  }
+
+  if (!reader.AtEnd()) {
+    throw Ort::Exception("Raw tensor payload has trailing bytes", OrtErrorCode::ORT_INVALID_ARGUMENT);
+  }
+}
+
+void MLValuesToRawTensorPayload(const std::vector<std::string>& names, const std::vector<Ort::Value>& values,
+                                std::string& payload) {
+  if (!IsLittleEndianOrder()) {
+    throw Ort::Exception("Raw tensor payloads need a little-endian host", OrtErrorCode::ORT_NOT_IMPLEMENTED);
+  }
+
+  struct Tensor {
+    int32_t data_type;
+    std::vector<int64_t> shape;
+    size_t data_length;
+  };
+
+  // Size the payload up front so that each tensor is copied exactly once
+  std::vector<Tensor> tensors;
+  tensors.reserve(values.size());
+  size_t payload_size = sizeof(uint32_t);
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (!values[i].IsTensor()) {
+      throw Ort::Exception("Don't support Non-Tensor values", OrtErrorCode::ORT_NOT_IMPLEMENTED);
+    }
+    auto info = values[i].GetTensorTypeAndShapeInfo();
+    int32_t data_type = MLDataTypeToTensorProtoDataType(info.GetElementType());
+    size_t element_size = GetElementSizeFromProtoType(data_type);
+    if (element_size == 0) {
+      throw Ort::Exception("Output " + names[i] + " cannot be written into a raw tensor payload",
+                           OrtErrorCode::ORT_NOT_IMPLEMENTED);
+    }
+    Tensor tensor{data_type, info.GetShape(), info.GetElementCount() * element_size};
+    payload_size += sizeof(uint32_t) + names[i].size() + sizeof(int32_t) + sizeof(uint32_t) +
+                    tensor.shape.size() * sizeof(int64_t) + sizeof(uint64_t) + kDataAlignment - 1 +
+                    tensor.data_length;
+    tensors.push_back(std::move(tensor));
+  }
+
+  payload.clear();
+  payload.reserve(payload_size);
+  Append(payload, static_cast<uint32_t>(values.size()));
+  for (size_t i = 0; i < values.size(); ++i) {
+    const auto& tensor = tensors[i];
+    Append(payload, static_cast<uint32_t>(names[i].size()));
+    payload.append(names[i]);
+    Append(payload, tensor.data_type);
+    Append(payload, static_cast<uint32_t>(tensor.shape.size()));
+    for (auto dim : tensor.shape) {
+      Append(payload, dim);
+    }
+    Append(payload, static_cast<uint64_t>(tensor.data_length));
+    AppendPadding(payload);
+    if (tensor.data_length > 0) {
+      payload.append(values[i].GetTensorData<char>(), tensor.data_length);
+    }
+  }
+}
+
+}  // namespace server
+}  // namespace onnxruntime
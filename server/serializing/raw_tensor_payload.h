@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "onnxruntime_c_api.h"
+#include "onnxruntime_cxx_api.h"
+
+#include "util.h"
+
+namespace onnxruntime {
+namespace server {
+
+/**
+ * Binary payload of named tensors, which requests and responses can use instead of JSON or protobuf so that
+ * tensor data is neither parsed from text nor copied into a TensorProto. All numbers are little-endian:
+ *
+ *   uint32 tensor count, then for each tensor:
+ *   uint32 name length, name bytes,
+ *   int32  element type (onnx::TensorProto_DataType),
+ *   uint32 rank, int64 dims[rank],
+ *   uint64 data length in bytes,
+ *   zero padding up to the next multiple of 8 bytes from the start of the payload,
+ *   data.
+ *
+ * String tensors are not supported.
+ */
+
+// Wraps the tensors of a payload as values pointing into it, so the payload must outlive the values.
+// A tensor whose data is not aligned for its element type is copied into a buffer of the array.
+// Throws Ort::Exception with ORT_INVALID_ARGUMENT if the payload is malformed.
+void RawTensorPayloadToMLValues(const std::string& payload, const OrtMemoryInfo& memory_info,
+                                MemBufferArray& buffers,
+                                /* out */ std::vector<std::string>& names,
+                                /* out */ std::vector<Ort::Value>& values);
+
+// Writes the tensors into a payload, copying the data of each of them once.
+// Throws Ort::Exception with ORT_NOT_IMPLEMENTED for non-tensor values and string tensors.
+void MLValuesToRawTensorPayload(const std::vector<std::string>& names, const std::vector<Ort::Value>& values,
+                                /* out */ std::string& payload);
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -47,16 +47,6 @@ inline std::string MakeString(const char* p_str) {
 
 
 namespace server {
-constexpr bool IsLittleEndianOrder() noexcept {
-#if defined(_WIN32)
-  return true;
-#elif defined(__GNUC__) || defined(__clang__)
-  return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
-#else
-#error server::IsLittleEndianOrder() is not implemented in this environment.
-#endif
-}
-
 std::vector<int64_t> GetTensorShapeFromTensorProto(const onnx::TensorProto& tensor_proto) {
   const auto& dims = tensor_proto.dims();
   std::vector<int64_t> tensor_shape_vec(static_cast<size_t>(dims.size()));
@@ -308,6 +298,55 @@ ONNXTensorElementDataType GetTensorElementType(const onnx::TensorProto& tensor_p
   return CApiElementTypeFromProtoType(tensor_proto.data_type());
 }
 
+#define CASE_ELEMENT_SIZE(X, Y)                              \
+  case onnx::TensorProto_DataType::TensorProto_DataType_##X: \
+    return sizeof(Y);
+
+size_t GetElementSizeFromProtoType(int type) {
+  switch (type) {
+    CASE_ELEMENT_SIZE(FLOAT, float);
+    CASE_ELEMENT_SIZE(DOUBLE, double);
+    CASE_ELEMENT_SIZE(BOOL, bool);
+    CASE_ELEMENT_SIZE(INT8, int8_t);
+    CASE_ELEMENT_SIZE(INT16, int16_t);
+    CASE_ELEMENT_SIZE(INT32, int32_t);
+    CASE_ELEMENT_SIZE(INT64, int64_t);
+    CASE_ELEMENT_SIZE(UINT8, uint8_t);
+    CASE_ELEMENT_SIZE(UINT16, uint16_t);
+    CASE_ELEMENT_SIZE(UINT32, uint32_t);
+    CASE_ELEMENT_SIZE(UINT64, uint64_t);
+    CASE_ELEMENT_SIZE(FLOAT16, uint16_t);
+    CASE_ELEMENT_SIZE(BFLOAT16, uint16_t);
+    default:
+      return 0;
+  }
+}
+
+bool TryWrapRawData(const onnx::TensorProto& tensor_proto, const OrtMemoryInfo& memory_info, Ort::Value& value) {
+  if (!IsLittleEndianOrder() || !tensor_proto.has_raw_data() ||
+      tensor_proto.data_location() == onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+    return false;
+  }
+  size_t element_size = GetElementSizeFromProtoType(tensor_proto.data_type());
+  const std::string& raw_data = tensor_proto.raw_data();
+  if (element_size == 0 || reinterpret_cast<uintptr_t>(raw_data.data()) % element_size != 0) {
+    return false;
+  }
+
+  // Size mismatches are left to the copying path, which reports them
+  size_t expected_size = 0;
+  GetSizeInBytesFromTensorProto<0>(tensor_proto, &expected_size);
+  if (raw_data.size() != expected_size) {
+    return false;
+  }
+
+  std::vector<int64_t> tensor_shape_vec = GetTensorShapeFromTensorProto(tensor_proto);
+  // The session only reads its inputs, so handing it the const buffer is safe
+  value = Ort::Value::CreateTensor(&memory_info, const_cast<char*>(raw_data.data()), raw_data.size(),
+                                   tensor_shape_vec.data(), tensor_shape_vec.size(), GetTensorElementType(tensor_proto));
+  return true;
+}
+
 void TensorProtoToMLValue(const onnx::TensorProto& tensor_proto, const MemBuffer& m, Ort::Value& value) {
   const OrtMemoryInfo& allocator = m.GetAllocInfo();
   ONNXTensorElementDataType ele_type = server::GetTensorElementType(tensor_proto);
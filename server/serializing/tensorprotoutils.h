@@ -15,6 +15,16 @@
 
 namespace onnxruntime {
 namespace server {
+constexpr bool IsLittleEndianOrder() noexcept {
+#if defined(_WIN32)
+  return true;
+#elif defined(__GNUC__) || defined(__clang__)
+  return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#else
+#error server::IsLittleEndianOrder() is not implemented in this environment.
+#endif
+}
+
 // How much memory it will need for putting the content of this tensor into a plain array
 // complex64/complex128 tensors are not supported.
 // The output value could be zero or -1.
@@ -31,6 +41,16 @@ template <typename T>
 void UnpackTensor(const onnx::TensorProto& tensor, const void* raw_data, size_t raw_data_len,
                   /*out*/ T* p_data, int64_t expected_size);
 
+/**
+ * Wraps the raw_data of a TensorProto as a value without copying it, so the TensorProto must outlive the value.
+ * Returns false if the tensor has no raw_data, is a string tensor, or its raw_data is not aligned for its
+ * element type or not in host byte order. TensorProtoToMLValue has to copy the data then.
+ */
+bool TryWrapRawData(const onnx::TensorProto& input, const OrtMemoryInfo& memory_info, /* out */ Ort::Value& value);
+
+// Size of one element of a onnx::TensorProto_DataType, 0 for string and unsupported types
+size_t GetElementSizeFromProtoType(int type);
+
 ONNXTensorElementDataType CApiElementTypeFromProtoType(int type);
 ONNXTensorElementDataType GetTensorElementType(const onnx::TensorProto& tensor_proto);
 }  // namespace server
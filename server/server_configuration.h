@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <thread>
 #include <fstream>
 #include <unordered_map>
+#include <vector>
 
 #include "boost/program_options.hpp"
 #include "onnxruntime_cxx_api.h"
@@ -33,6 +35,14 @@ static std::unordered_map<std::string, OrtLoggingLevel> supported_log_levels{
     {"error", ORT_LOGGING_LEVEL_ERROR},
     {"fatal", ORT_LOGGING_LEVEL_FATAL}};
 
+// A model hosted in addition to the one given by model_path, loaded by its first request
+struct ModelConfiguration {
+  std::string name;
+  std::string version;
+  std::string path;
+  size_t memory_bytes = 0;  // 0 estimates it from the model file
+};
+
 // Wrapper around Boost program_options and should provide all the functionality for options parsing
 // Provides sane default values
 class ServerConfiguration {
@@ -41,22 +51,36 @@ class ServerConfiguration {
   std::string model_path;
   std::string model_name = "default";
   std::string model_version = "1";
+  size_t model_memory_bytes = 0;  // 0 estimates it from the model file
   std::string address = "0.0.0.0";
   unsigned short http_port = 8001;
   unsigned short grpc_port = 50051;
   int num_http_threads = std::thread::hardware_concurrency();
+  int max_batch_size = 1;
+  int max_queue_delay_us = 1000;
+  std::vector<ModelConfiguration> models;
+  int memory_budget_mb = 0;
+  int intra_op_threads = 0;
+  int inter_op_threads = 0;
   OrtLoggingLevel logging_level{};
 
   ServerConfiguration() {
     desc.add_options()("help,h", "Shows a help message and exits");
     desc.add_options()("log_level", po::value(&log_level_str)->default_value(log_level_str), "Logging level. Allowed options (case sensitive): verbose, info, warning, error, fatal");
-    desc.add_options()("model_path", po::value(&model_path)->required(), "Path to ONNX model");
+    desc.add_options()("model_path", po::value(&model_path), "Path to ONNX model");
     desc.add_options()("model_name", po::value(&model_name)->default_value(model_name), "ONNX model name");
     desc.add_options()("model_version", po::value(&model_version)->default_value(model_version), "ONNX model version");
     desc.add_options()("address", po::value(&address)->default_value(address), "The base HTTP address");
     desc.add_options()("http_port", po::value(&http_port)->default_value(http_port), "HTTP port to listen to requests");
     desc.add_options()("num_http_threads", po::value(&num_http_threads)->default_value(num_http_threads), "Number of http threads");
     desc.add_options()("grpc_port", po::value(&grpc_port)->default_value(grpc_port), "GRPC port to listen to requests");
+    desc.add_options()("max_batch_size", po::value(&max_batch_size)->default_value(max_batch_size), "Maximum batch size of a run merging concurrent requests, 1 disables batching");
+    desc.add_options()("model", po::value(&model_specs_)->composing(), "Additional model to host, as NAME:VERSION:PATH. Can be repeated");
+    desc.add_options()("model_memory_mb", po::value(&model_memory_specs_)->composing(), "Memory accounted to a model, as NAME:VERSION:MB. Can be repeated. Defaults to the model file size");
+    desc.add_options()("memory_budget_mb", po::value(&memory_budget_mb)->default_value(memory_budget_mb), "Memory the loaded models may use together, idle models are unloaded to stay within it. 0 for no limit");
+    desc.add_options()("intra_op_threads", po::value(&intra_op_threads)->default_value(intra_op_threads), "Threads of the intra-op thread pool shared by all models. 0 for the default");
+    desc.add_options()("inter_op_threads", po::value(&inter_op_threads)->default_value(inter_op_threads), "Threads of the inter-op thread pool shared by all models. 0 for the default");
+    desc.add_options()("max_queue_delay_us", po::value(&max_queue_delay_us)->default_value(max_queue_delay_us), "Maximum time in microseconds a request waits for others to batch with");
   }
 
   // Parses argc and argv and sets the values for the class
@@ -93,6 +117,62 @@ class ServerConfiguration {
   po::options_description desc{"Allowed options"};
   po::variables_map vm{};
   std::string log_level_str = "info";
+  std::vector<std::string> model_specs_;
+  std::vector<std::string> model_memory_specs_;
+
+  // Splits "NAME:VERSION:VALUE", the value may contain further colons (such as a Windows path)
+  static bool SplitModelSpec(const std::string& spec, std::string& name, std::string& version, std::string& value) {
+    auto first = spec.find(':');
+    auto second = first == std::string::npos ? std::string::npos : spec.find(':', first + 1);
+    if (second == std::string::npos || first == 0 || second == first + 1 || second + 1 == spec.size()) {
+      return false;
+    }
+    name = spec.substr(0, first);
+    version = spec.substr(first + 1, second - first - 1);
+    value = spec.substr(second + 1);
+    return true;
+  }
+
+  Result ParseModels() {
+    models.clear();
+    model_memory_bytes = 0;
+    for (const auto& spec : model_specs_) {
+      ModelConfiguration model;
+      if (!SplitModelSpec(spec, model.name, model.version, model.path)) {
+        PrintHelp(std::cerr, "model must be given as NAME:VERSION:PATH");
+        return Result::ExitFailure;
+      }
+      if (!file_exists(model.path)) {
+        PrintHelp(std::cerr, "model path must be the location of a valid file: " + model.path);
+        return Result::ExitFailure;
+      }
+      models.push_back(model);
+    }
+
+    for (const auto& spec : model_memory_specs_) {
+      std::string name, version, megabytes;
+      if (!SplitModelSpec(spec, name, version, megabytes) ||
+          megabytes.find_first_not_of("0123456789") != std::string::npos) {
+        PrintHelp(std::cerr, "model_memory_mb must be given as NAME:VERSION:MB");
+        return Result::ExitFailure;
+      }
+      const size_t memory_bytes = std::stoull(megabytes) * 1024 * 1024;
+      if (!model_path.empty() && name == model_name && version == model_version) {
+        model_memory_bytes = memory_bytes;
+        continue;
+      }
+      auto model = std::find_if(models.begin(), models.end(), [&](const ModelConfiguration& m) {
+        return m.name == name && m.version == version;
+      });
+      if (model == models.end()) {
+        PrintHelp(std::cerr, "model_memory_mb refers to a model not given with --model_path or --model: " + name + ":" + version);
+        return Result::ExitFailure;
+      }
+      model->memory_bytes = memory_bytes;
+    }
+
+    return Result::ContinueSuccess;
+  }
 
   // Print help and return if there is a bad value
   Result ValidateOptions() {
@@ -103,11 +183,23 @@ class ServerConfiguration {
     } else if (num_http_threads <= 0) {
       PrintHelp(std::cerr, "num_http_threads must be greater than 0");
       return Result::ExitFailure;
-    } else if (!file_exists(model_path)) {
+    } else if (max_batch_size <= 0) {
+      PrintHelp(std::cerr, "max_batch_size must be greater than 0");
+      return Result::ExitFailure;
+    } else if (max_queue_delay_us < 0) {
+      PrintHelp(std::cerr, "max_queue_delay_us must not be negative");
+      return Result::ExitFailure;
+    } else if (memory_budget_mb < 0 || intra_op_threads < 0 || inter_op_threads < 0) {
+      PrintHelp(std::cerr, "memory_budget_mb, intra_op_threads and inter_op_threads must not be negative");
+      return Result::ExitFailure;
+    } else if (model_path.empty() && model_specs_.empty()) {
+      PrintHelp(std::cerr, "model_path or model must be given");
+      return Result::ExitFailure;
+    } else if (!model_path.empty() && !file_exists(model_path)) {
       PrintHelp(std::cerr, "model_path must be the location of a valid file");
       return Result::ExitFailure;
     } else {
-      return Result::ContinueSuccess;
+      return ParseModels();
     }
   }
 
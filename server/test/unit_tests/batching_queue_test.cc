@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "executor.h"
+#include "http/json_handling.h"
+#include "test_server_environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+class BatchingQueueTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const static auto model_file = "testdata/mul_1.onnx";
+
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    BatchingOptions options;
+    options.max_batch_size = 6;
+    options.max_queue_delay = std::chrono::milliseconds(200);
+    env->SetBatchingOptions(options);
+    env->InitializeModel(model_file, "Batched", "version");
+    env->SetBatchingOptions(BatchingOptions{});
+  }
+
+  void TearDown() override {
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->UnloadModel("Batched", "version");
+  }
+};
+
+// mul_1.onnx multiplies X by a [3,2] initializer, so merged requests fail to run and are retried one at a time
+TEST_F(BatchingQueueTest, ConcurrentRequests) {
+  const static auto input_json = R"({"inputs":{"X":{"dims":[3,2],"dataType":1,"floatData":[1,2,3,4,5,6]}},"outputFilter":["Y"]})";
+  const static auto expected = R"({"outputs":{"Y":{"dims":["3","2"],"dataType":1,"floatData":[1,4,9,16,25,36]}}})";
+
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  ASSERT_NE(env->GetModel("Batched", "version")->batching_queue, nullptr);
+
+  std::string bodies[2];
+  bool succeeded[2] = {false, false};
+  auto predict = [&](int i) {
+    onnxruntime::server::Executor executor(env, "RequestId" + std::to_string(i));
+    onnxruntime::server::PredictRequest request{};
+    onnxruntime::server::PredictResponse response{};
+    if (!onnxruntime::server::GetRequestFromJson(input_json, request).ok()) {
+      return;
+    }
+    succeeded[i] = executor.Predict("Batched", "version", request, response).ok();
+    GenerateResponseInJson(response, bodies[i]);
+  };
+
+  std::thread other(predict, 1);
+  predict(0);
+  other.join();
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_TRUE(succeeded[i]);
+    EXPECT_EQ(expected, bodies[i]);
+  }
+
+  auto metrics = env->GetModel("Batched", "version")->batching_queue->GetMetrics();
+  EXPECT_EQ(metrics.requests, 2u);
+  EXPECT_EQ(metrics.runs, 2u);
+  EXPECT_EQ(metrics.batched_rows, 6u);
+}
+
+TEST_F(BatchingQueueTest, InvalidRequest) {
+  const static auto input_json = R"({"inputs":{"X":{"dims":[2,2],"dataType":1,"floatData":[1,2,3,4]}},"outputFilter":["Y"]})";
+
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+
+  onnxruntime::server::Executor executor(env, "RequestId");
+  onnxruntime::server::PredictRequest request{};
+  onnxruntime::server::PredictResponse response{};
+  ASSERT_TRUE(onnxruntime::server::GetRequestFromJson(input_json, request).ok());
+
+  auto prediction_res = executor.Predict("Batched", "version", request, response);
+  EXPECT_FALSE(prediction_res.ok());
+}
+
+// abs_free_dimensions.onnx computes Abs of x with shape [batch, channel, 5], so requests with the same channel count
+// are concatenated into one run and its output is split back
+class BatchingQueueMergeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const static auto model_file = "testdata/abs_free_dimensions.onnx";
+
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    BatchingOptions options;
+    options.max_batch_size = 3;
+    options.max_queue_delay = std::chrono::seconds(5);
+    env->SetBatchingOptions(options);
+    env->InitializeModel(model_file, "Merged", "version");
+    env->SetBatchingOptions(BatchingOptions{});
+  }
+
+  void TearDown() override {
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->UnloadModel("Merged", "version");
+  }
+};
+
+TEST_F(BatchingQueueMergeTest, ConcurrentRequestsRunOnce) {
+  // 1 + 2 rows fill max_batch_size, so the batch runs as soon as both requests are queued
+  const static std::string input_jsons[2] = {
+      R"({"inputs":{"x":{"dims":[1,1,5],"dataType":1,"floatData":[-1,2,-3,4,-5]}},"outputFilter":["y"]})",
+      R"({"inputs":{"x":{"dims":[2,1,5],"dataType":1,"floatData":[6,-7,8,-9,10,-11,12,-13,14,-15]}},"outputFilter":["y"]})"};
+  const static std::string expected[2] = {
+      R"({"outputs":{"y":{"dims":["1","1","5"],"dataType":1,"floatData":[1,2,3,4,5]}}})",
+      R"({"outputs":{"y":{"dims":["2","1","5"],"dataType":1,"floatData":[6,7,8,9,10,11,12,13,14,15]}}})"};
+
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  ASSERT_NE(env->GetModel("Merged", "version")->batching_queue, nullptr);
+
+  std::string bodies[2];
+  bool succeeded[2] = {false, false};
+  auto predict = [&](int i) {
+    onnxruntime::server::Executor executor(env, "RequestId" + std::to_string(i));
+    onnxruntime::server::PredictRequest request{};
+    onnxruntime::server::PredictResponse response{};
+    if (!onnxruntime::server::GetRequestFromJson(input_jsons[i], request).ok()) {
+      return;
+    }
+    succeeded[i] = executor.Predict("Merged", "version", request, response).ok();
+    GenerateResponseInJson(response, bodies[i]);
+  };
+
+  std::thread other(predict, 1);
+  predict(0);
+  other.join();
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_TRUE(succeeded[i]);
+    EXPECT_EQ(expected[i], bodies[i]);
+  }
+
+  auto metrics = env->GetModel("Merged", "version")->batching_queue->GetMetrics();
+  EXPECT_EQ(metrics.requests, 2u);
+  EXPECT_EQ(metrics.runs, 1u);
+  EXPECT_EQ(metrics.batched_rows, 3u);
+  EXPECT_EQ(metrics.max_batch_rows, 3u);
+}
+
+TEST(BatchingQueueDisabledTest, NoQueueByDefault) {
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  env->InitializeModel("testdata/mul_1.onnx", "Unbatched", "version");
+  EXPECT_EQ(env->GetModel("Unbatched", "version")->batching_queue, nullptr);
+  env->UnloadModel("Unbatched", "version");
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include <spdlog/sinks/stdout_sinks.h>
+
+#include "environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+// Each test gets its own environment, so that its memory budget and models are not seen by other tests
+class ModelHostingTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const static auto model_file = "testdata/mul_1.onnx";
+
+    env_.SetMemoryBudget(3 * 1024 * 1024 / 2);
+    env_.RegisterModel(model_file, "First", "1", 1024 * 1024);
+    env_.RegisterModel(model_file, "Second", "1", 1024 * 1024);
+  }
+
+  onnxruntime::server::ServerEnvironment env_{
+      ORT_LOGGING_LEVEL_WARNING, spdlog::sinks_init_list{std::make_shared<spdlog::sinks::stdout_sink_st>()}};
+};
+
+TEST_F(ModelHostingTest, LoadedOnFirstUse) {
+  EXPECT_FALSE(env_.IsModelLoaded("First", "1"));
+  EXPECT_EQ(env_.GetLoadedModelsMemory(), 0u);
+
+  auto model = env_.GetModel("First", "1");
+  ASSERT_NE(model, nullptr);
+  EXPECT_TRUE(env_.IsModelLoaded("First", "1"));
+  EXPECT_EQ(model->output_names, std::vector<std::string>{"Y"});
+  EXPECT_EQ(env_.GetLoadedModelsMemory(), 1024u * 1024u);
+  EXPECT_EQ(env_.GetModel("First", "1"), model);
+}
+
+TEST_F(ModelHostingTest, IdleModelUnloaded) {
+  env_.GetModel("First", "1");
+  env_.GetModel("Second", "1");
+
+  EXPECT_FALSE(env_.IsModelLoaded("First", "1"));
+  EXPECT_TRUE(env_.IsModelLoaded("Second", "1"));
+  EXPECT_EQ(env_.GetLoadedModelsMemory(), 1024u * 1024u);
+}
+
+TEST_F(ModelHostingTest, ModelInUseNotUnloaded) {
+  auto first = env_.GetModel("First", "1");
+  auto second = env_.GetModel("Second", "1");
+
+  EXPECT_TRUE(env_.IsModelLoaded("First", "1"));
+  EXPECT_TRUE(env_.IsModelLoaded("Second", "1"));
+  EXPECT_EQ(env_.GetLoadedModelsMemory(), 2u * 1024u * 1024u);
+}
+
+TEST_F(ModelHostingTest, UnknownModel) {
+  EXPECT_THROW(env_.GetModel("Third", "1"), Ort::Exception);
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "executor.h"
+#include "serializing/raw_tensor_payload.h"
+#include "test_server_environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+namespace {
+
+template <typename T>
+void Append(std::string& payload, T value) {
+  payload.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Payload with a single [3,2] input X
+template <typename T>
+std::string MakePayload(int32_t data_type, const std::vector<T>& data) {
+  std::string payload;
+  Append<uint32_t>(payload, 1);
+  Append<uint32_t>(payload, 1);
+  payload.append("X");
+  Append<int32_t>(payload, data_type);
+  Append<uint32_t>(payload, 2);
+  Append<int64_t>(payload, 3);
+  Append<int64_t>(payload, 2);
+  Append<uint64_t>(payload, data.size() * sizeof(T));
+  payload.append((8 - payload.size() % 8) % 8, '\0');
+  payload.append(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T));
+  return payload;
+}
+
+// Payload with the [3,2] float input X of mul_1.onnx
+std::string MakeMulPayload(const std::vector<float>& data) {
+  return MakePayload(onnx::TensorProto_DataType_FLOAT, data);
+}
+
+}  // namespace
+
+TEST(RawTensorPayloadTests, WrapsPayloadWithoutCopy) {
+  std::string payload = MakeMulPayload({1, 2, 3, 4, 5, 6});
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  MemBufferArray buffers;
+  std::vector<std::string> names;
+  std::vector<Ort::Value> values;
+  RawTensorPayloadToMLValues(payload, *memory_info, buffers, names, values);
+
+  ASSERT_EQ(names, std::vector<std::string>{"X"});
+  auto info = values[0].GetTensorTypeAndShapeInfo();
+  EXPECT_EQ(info.GetElementType(), ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT);
+  EXPECT_EQ(info.GetShape(), (std::vector<int64_t>{3, 2}));
+  EXPECT_EQ(values[0].GetTensorData<char>(), payload.data() + payload.size() - 6 * sizeof(float));
+}
+
+TEST(RawTensorPayloadTests, RoundTrip) {
+  std::string payload = MakeMulPayload({1, 2, 3, 4, 5, 6});
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  MemBufferArray buffers;
+  std::vector<std::string> names;
+  std::vector<Ort::Value> values;
+  RawTensorPayloadToMLValues(payload, *memory_info, buffers, names, values);
+
+  std::string written;
+  MLValuesToRawTensorPayload(names, values, written);
+  EXPECT_EQ(payload, written);
+}
+
+TEST(RawTensorPayloadTests, Float16RoundTrip) {
+  // 1, 2, 3, 4, 5, 6 as IEEE half-precision bits
+  std::string payload = MakePayload<uint16_t>(onnx::TensorProto_DataType_FLOAT16,
+                                              {0x3c00, 0x4000, 0x4200, 0x4400, 0x4500, 0x4600});
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  MemBufferArray buffers;
+  std::vector<std::string> names;
+  std::vector<Ort::Value> values;
+  RawTensorPayloadToMLValues(payload, *memory_info, buffers, names, values);
+
+  EXPECT_EQ(values[0].GetTensorTypeAndShapeInfo().GetElementType(), ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16);
+  EXPECT_EQ(values[0].GetTensorData<char>(), payload.data() + payload.size() - 6 * sizeof(uint16_t));
+
+  std::string written;
+  MLValuesToRawTensorPayload(names, values, written);
+  EXPECT_EQ(payload, written);
+}
+
+TEST(RawTensorPayloadTests, MalformedPayloads) {
+  std::string payload = MakeMulPayload({1, 2, 3, 4, 5, 6});
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  MemBufferArray buffers;
+  std::vector<std::string> names;
+  std::vector<Ort::Value> values;
+
+  EXPECT_THROW(RawTensorPayloadToMLValues(payload.substr(0, payload.size() - 1), *memory_info, buffers, names, values),
+               Ort::Exception);
+  EXPECT_THROW(RawTensorPayloadToMLValues(payload + '\0', *memory_info, buffers, names, values), Ort::Exception);
+
+  std::string string_tensor = payload;
+  int32_t string_type = onnx::TensorProto_DataType_STRING;
+  std::memcpy(&string_tensor[9], &string_type, sizeof(string_type));
+  EXPECT_THROW(RawTensorPayloadToMLValues(string_tensor, *memory_info, buffers, names, values), Ort::Exception);
+
+  // a rank that the payload cannot hold is rejected without allocating the shape
+  std::string huge_rank = payload;
+  uint32_t rank = 0xffffffff;
+  std::memcpy(&huge_rank[13], &rank, sizeof(rank));
+  EXPECT_THROW(RawTensorPayloadToMLValues(huge_rank, *memory_info, buffers, names, values), Ort::Exception);
+}
+
+TEST(RawTensorPayloadTests, ExecutorRunsWrappedInputs) {
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+  env->InitializeModel("testdata/mul_1.onnx", "Raw", "version");
+
+  std::string payload = MakeMulPayload({1, 2, 3, 4, 5, 6});
+  Ort::MemoryInfo memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  MemBufferArray buffers;
+  std::vector<std::string> input_names;
+  std::vector<Ort::Value> input_values;
+  RawTensorPayloadToMLValues(payload, *memory_info, buffers, input_names, input_values);
+
+  {
+    onnxruntime::server::Executor executor(env, "RequestId");
+    std::vector<std::string> output_names;
+    std::vector<Ort::Value> outputs;
+    auto status = executor.Predict("Raw", "version", std::move(input_names), std::move(input_values), output_names, outputs);
+    ASSERT_TRUE(status.ok());
+
+    ASSERT_EQ(output_names, std::vector<std::string>{"Y"});
+    const float* y = outputs[0].GetTensorData<float>();
+    EXPECT_EQ(std::vector<float>(y, y + 6), (std::vector<float>{1, 4, 9, 16, 25, 36}));
+  }
+
+  env->UnloadModel("Raw", "version");
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -98,6 +98,89 @@ TEST(ConfigParsingTests, WrongLoggingLevel) {
   EXPECT_EQ(res, Result::ExitFailure);
 }
 
+TEST(ConfigParsingTests, Batching) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--max_batch_size"), const_cast<char*>("16"),
+      const_cast<char*>("--max_queue_delay_us"), const_cast<char*>("500")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(7, test_argv);
+  EXPECT_EQ(res, Result::ContinueSuccess);
+  EXPECT_EQ(config.max_batch_size, 16);
+  EXPECT_EQ(config.max_queue_delay_us, 500);
+}
+
+TEST(ConfigParsingTests, MultipleModels) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model"), const_cast<char*>("first:1:testdata/mul_1.onnx"),
+      const_cast<char*>("--model"), const_cast<char*>("second:2:testdata/mul_1.onnx"),
+      const_cast<char*>("--model_memory_mb"), const_cast<char*>("second:2:8"),
+      const_cast<char*>("--memory_budget_mb"), const_cast<char*>("64")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(9, test_argv);
+  EXPECT_EQ(res, Result::ContinueSuccess);
+  EXPECT_EQ(config.model_path, "");
+  EXPECT_EQ(config.memory_budget_mb, 64);
+  ASSERT_EQ(config.models.size(), 2u);
+  EXPECT_EQ(config.models[0].name, "first");
+  EXPECT_EQ(config.models[0].version, "1");
+  EXPECT_EQ(config.models[0].path, "testdata/mul_1.onnx");
+  EXPECT_EQ(config.models[0].memory_bytes, 0u);
+  EXPECT_EQ(config.models[1].name, "second");
+  EXPECT_EQ(config.models[1].version, "2");
+  EXPECT_EQ(config.models[1].memory_bytes, 8u * 1024 * 1024);
+}
+
+TEST(ConfigParsingTests, ModelPathMemory) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--model_name"), const_cast<char*>("primary"),
+      const_cast<char*>("--model_memory_mb"), const_cast<char*>("primary:1:16")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(7, test_argv);
+  EXPECT_EQ(res, Result::ContinueSuccess);
+  EXPECT_EQ(config.model_memory_bytes, 16u * 1024 * 1024);
+  EXPECT_TRUE(config.models.empty());
+}
+
+TEST(ConfigParsingTests, UnknownModelMemory) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--model_memory_mb"), const_cast<char*>("other:1:16")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(5, test_argv);
+  EXPECT_EQ(res, Result::ExitFailure);
+}
+
+TEST(ConfigParsingTests, WrongModelSpec) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model"), const_cast<char*>("testdata/mul_1.onnx")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(3, test_argv);
+  EXPECT_EQ(res, Result::ExitFailure);
+}
+
+TEST(ConfigParsingTests, WrongMaxBatchSize) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--max_batch_size"), const_cast<char*>("0")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(5, test_argv);
+  EXPECT_EQ(res, Result::ExitFailure);
+}
+
 }  // namespace test
 }  // namespace server
 }  // namespace onnxruntime
\ No newline at end of file